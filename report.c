@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 
 // --- Library Declarations (assumed implemented elsewhere) ---
@@ -9,9 +10,27 @@ typedef struct utf8_string {
     unsigned char* data;
     unsigned int length;
     unsigned int capacity;
+    uint64_t hash;
+    struct utf8_buffer* shared;
+    unsigned int flags;
 } utf8_string;
 typedef utf8_string utf8_slice;
 
+//NOTE: Zero copy read-only slice over a string literal. The length comes from
+//sizeof, so embedded NULL bytes are kept and strlen is never called.
+//The "" prefix rejects anything that is not a literal at compile time.
+#define UTF8_LIT(lit) ((utf8_slice){                  \
+        .data = (unsigned char*)("" lit),             \
+        .length = sizeof(lit) - 1,                    \
+        .capacity = 0,                                \
+        .hash = 0,                                    \
+        .shared = NULL,                               \
+        .flags = utf8_lit_flags("" lit, sizeof(lit) - 1) })
+#define UTF8_LIT_CHARS(lit) utf8_lit_chars("" lit, sizeof(lit) - 1)
+
+unsigned int utf8_lit_flags(const char* lit, unsigned int n);
+unsigned int utf8_lit_chars(const char* lit, unsigned int n);
+
 int fputs_len(const unsigned char* str, unsigned int len, FILE* stream);
 unsigned int decode_utf8_char(unsigned char* Input);
 void print_utf8(utf8_string* utf8_str);
@@ -30,6 +49,7 @@ void delete_byte(utf8_string* src, unsigned int from, unsigned int till);
 void delete_char(utf8_string* src, unsigned int from, unsigned int till);
 void insert (utf8_string* dest, utf8_string* src, unsigned int location);
 int seek_char(utf8_string* src, unsigned int gap);
+utf8_slice slice_byte_shared(utf8_string* src, unsigned int from, unsigned int till);
 // --- End Library Declarations ---
 
 /* Production Readiness Report for UTF-8 Library */
@@ -65,6 +85,15 @@ void generate_report() {
     utf8_concat_literal(&report, parent2_unchanged ? "PASS\n" : "FAIL\n");
     utf8_free(&parent2);
 
+    // Shared slices pin the parent storage, the parent copies on write
+    utf8_string parent3 = from("Parent");
+    utf8_slice pinned = slice_byte_shared(&parent3, 0, 3);
+    utf8_concat_literal(&parent3, "Modified");
+    utf8_free(&parent3);
+    utf8_concat_literal(&report, "3.C: Shared Slice Safety: ");
+    utf8_concat_literal(&report, (pinned.length == 4 && memcmp(pinned.data, cmp.data, 4) == 0) ? "PASS\n" : "FAIL\n");
+    utf8_free(&pinned);
+
     // 4. Test error propagation
     utf8_string bad_str = from("\xED\xA0\x80");  // Invalid surrogate
     int pos = seek_char(&bad_str, 1);
@@ -103,43 +132,44 @@ void generate_report() {
 // Build and print an essay that showcases our UTF-8 library with emoji and kaomoji.
 void build_and_print_essay() {
     // Create the base essay using the UTF-8 library.
+    // Sections are appended from literal slices: no strlen and no temporary copies.
     utf8_string essay = from("UTF-8 Library Development Essay\n");
     
     // Append the introduction with some emoji.
-    utf8_concat_literal(&essay, "\nIntroduction:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nIntroduction:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "A robust UTF-8 library must offer a clear API, efficient memory management, and comprehensive error handling. "
-        "Our library provides functions like from(), utf8_concat(), decode_utf8_char(), and slice_char() to handle UTF-8 data reliably 😊.\n");
+        "Our library provides functions like from(), utf8_concat(), decode_utf8_char(), and slice_char() to handle UTF-8 data reliably 😊.\n"));
 
     // Append a section on API design with a kaomoji.
-    utf8_concat_literal(&essay, "\nAPI Design:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nAPI Design:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "The API is designed with modular functions that perform specific tasks. For example, decode_utf8_char() decodes one Unicode codepoint, "
-        "and insert() allows for text insertion. This separation of concerns simplifies usage and maintenance ¯\\_(ツ)_/¯.\n");
+        "and insert() allows for text insertion. This separation of concerns simplifies usage and maintenance ¯\\_(ツ)_/¯.\n"));
 
     // Append a section on memory management with an emoji.
-    utf8_concat_literal(&essay, "\nMemory Management:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nMemory Management:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "Dynamic memory allocation is handled by functions like from() and utf8_concat(). It is essential to check allocation failures and free memory "
-        "properly using utf8_free(). This ensures no memory leaks occur and that the system is binary-safe 😎.\n");
+        "properly using utf8_free(). This ensures no memory leaks occur and that the system is binary-safe 😎.\n"));
 
     // Append a section on error handling.
-    utf8_concat_literal(&essay, "\nError Handling:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nError Handling:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "Error handling is implemented by returning the replacement character U+FFFD for invalid sequences. This mechanism detects errors such as "
-        "truncated sequences, overlong encodings, and invalid continuation bytes, ensuring the library behaves reliably 🚫.\n");
+        "truncated sequences, overlong encodings, and invalid continuation bytes, ensuring the library behaves reliably 🚫.\n"));
 
     // Append a section on testing and benchmarking.
-    utf8_concat_literal(&essay, "\nTesting and Benchmarking:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nTesting and Benchmarking:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "A suite of unit tests, integration tests, and regression tests ensures that each function works as expected. Benchmarking critical routines "
-        "helps identify performance bottlenecks and maintain high efficiency 📊.\n");
+        "helps identify performance bottlenecks and maintain high efficiency 📊.\n"));
 
     // Append the conclusion.
-    utf8_concat_literal(&essay, "\nConclusion:\n");
-    utf8_concat_literal(&essay,
+    utf8_concat(&essay, &UTF8_LIT("\nConclusion:\n"));
+    utf8_concat(&essay, &UTF8_LIT(
         "By following best practices in API design, memory management, error handling, and thorough testing, the UTF-8 library becomes robust, "
-        "efficient, and production-ready. Happy coding! 🎉\n");
+        "efficient, and production-ready. Happy coding! 🎉\n"));
 
     // Demonstrate additional operations:
     // Decode the first codepoint.
@@ -8,7 +8,7 @@ rm -rf coverage_report
 
 # Compile with coverage instrumentation and debug info
 echo "Compiling with coverage flags..."
-gcc -fsanitize=address -fprofile-arcs -ftest-coverage -Wall -Werror -g utf8_string.c test_utf8.c -o utf8_tests -lgcov
+gcc -fsanitize=address -fprofile-arcs -ftest-coverage -Wall -Werror -g utf8_string.c test_utf8.c -o utf8_tests -lgcov -lpthread
 
 # Check if compilation succeeded
 if [ ! -f "utf8_tests" ]; then
@@ -320,6 +320,858 @@ void test_delete_operations() {
     utf8_free(&s10);
 }
 
+/*******************************
+ * 12. Formatted Append Tests
+ *******************************/
+void test_appendf() {
+    test_header("Formatted Append");
+
+    utf8_string s = from("");
+    int n = utf8_appendf(&s, "%d-%s-%05.2f", 42, "abc", 3.14159);
+    test_assert(utf8_compare(&s, "42-abc-03.14"), "appendf: basic conversions");
+    test_assert(n == 12, "appendf: returns appended byte count");
+    utf8_free(&s);
+
+    // %S takes utf8_string / utf8_slice
+    utf8_string base = from("Hello 世界");
+    utf8_slice world = slice_byte(&base, 6, 11);
+    utf8_string out = from("[");
+    utf8_appendf(&out, "%S|%S]", &base, &world);
+    test_assert(utf8_compare(&out, "[Hello 世界|世界]"), "appendf: %S with string and slice");
+    utf8_free(&out);
+
+    // Width and precision count codepoints
+    utf8_string w = from("");
+    utf8_appendf(&w, "[%4S][%-4s][%.1S]", &world, "€", &world);
+    test_assert(utf8_compare(&w, "[  世界][€   ][世]"), "appendf: codepoint width and precision");
+    utf8_free(&w);
+
+    // Growth past the initial reservation
+    utf8_string big = from("x");
+    for (int i = 0; i < 200; i++) utf8_appendf(&big, "%08x", i);
+    test_assert(big.length == 1 + 8 * 200, "appendf: repeated growth");
+    test_assert(big.capacity >= big.length, "appendf: capacity is sufficient");
+    utf8_free(&big);
+
+    // %S may be a slice of the destination while it grows
+    utf8_string self = from("hello");
+    for (int i = 0; i < 4; i++) {
+        utf8_slice ell = slice_byte(&self, 1, 3);     // Plain slices go stale on growth, take a fresh one
+        utf8_appendf(&self, "%S!", &ell);
+    }
+    test_assert(utf8_compare(&self, "helloell!ell!ell!ell!"), "appendf: %S slice of destination");
+    utf8_free(&self);
+
+    // A failed call leaves nothing behind
+    utf8_string keep = from("ok");
+    test_assert(utf8_appendf(&keep, "-%d-%q", 7) == -1 && utf8_compare(&keep, "ok"), "appendf: partial output rolled back on error");
+    utf8_free(&keep);
+
+    // Writes through a slice are refused
+    test_assert(utf8_appendf(&world, "%d", 1) == -1, "appendf: slice write rejected");
+
+    // Empty views are slices too, only owned strings grow
+    utf8_slice empty_lit = UTF8_LIT("");
+    utf8_slice empty_view = slice_byte(&base, 3, 2);
+    utf8_string tail = from("!");
+    utf8_concat(&empty_lit, &tail);
+    test_assert(empty_lit.length == 0 && empty_lit.capacity == 0, "concat: empty literal write rejected");
+    test_assert(empty_view.length == 0 && utf8_appendf(&empty_view, "x") == -1, "appendf: empty slice write rejected");
+    utf8_string owned = from("");
+    utf8_concat(&owned, &tail);
+    test_assert(utf8_compare(&owned, "!"), "concat: empty owned string grows");
+    utf8_free(&owned); utf8_free(&tail);
+    utf8_free(&base);
+}
+
+/*******************************
+ * 13. Hashing & Interning Tests
+ *******************************/
+void test_hash_intern() {
+    test_header("Hashing & Interning");
+
+    utf8_string a = from("identifier_ü");
+    utf8_string b = from("identifier_ü");
+    utf8_string c = from("identifier_u");
+    test_assert(utf8_hash(&a) == utf8_hash(&b), "hash: equal contents hash equal");
+    test_assert(utf8_hash(&a) != utf8_hash(&c), "hash: different contents differ");
+    test_assert(a.hash != 0, "hash: cached in struct");
+    utf8_concat_literal(&a, "x");
+    test_assert(a.hash == 0, "hash: cache reset on mutation");
+
+    // Slices hash by their content
+    utf8_string longer = from("xxidentifier_üxx");
+    utf8_slice mid = slice_byte(&longer, 2, 14);
+    test_assert(utf8_hash(&mid) == utf8_hash(&b), "hash: slice hashes its view");
+
+    // Lengths around the 4/16/48 byte paths
+    int distinct = 1;
+    for (unsigned int len = 1; len < 100; len++) {
+        unsigned char buf[100] = {0};
+        uint64_t h0 = utf8_hash_bytes(buf, len, 0);
+        buf[len - 1] = 1;
+        if (utf8_hash_bytes(buf, len, 0) == h0 || utf8_hash_bytes(buf, len - 1, 0) == h0) distinct = 0;
+    }
+    test_assert(distinct, "hash: last byte and length affect hash");
+
+    utf8_intern_pool pool;
+    utf8_intern_init(&pool, 4);
+    utf8_intern_pool huge;
+    test_assert(utf8_intern_init(&huge, 0xFFFFFFFFu) == -1, "intern: oversized initial capacity rejected");
+    utf8_string* h1 = utf8_intern_literal(&pool, "key");
+    utf8_string* h2 = utf8_intern(&pool, &c);
+    utf8_string* h3 = utf8_intern_literal(&pool, "key");
+    utf8_string* h4 = utf8_intern_literal(&pool, "identifier_u");
+    test_assert(h1 == h3, "intern: same literal gives same handle");
+    test_assert(h2 == h4, "intern: string and literal share handle");
+    test_assert(h1 != h2 && utf8_compare(h1, "key"), "intern: distinct contents");
+
+    // Force table growth, handles stay stable
+    char name[16];
+    for (int i = 0; i < 500; i++) {
+        snprintf(name, sizeof(name), "id%d", i);
+        utf8_intern_literal(&pool, name);
+    }
+    test_assert(pool.count == 502, "intern: grows past initial capacity");
+    test_assert(utf8_intern_literal(&pool, "key") == h1, "intern: handle survives growth");
+    utf8_intern_free(&pool);
+
+    utf8_free(&a);
+    utf8_free(&b);
+    utf8_free(&c);
+    utf8_free(&longer);
+}
+
+/*******************************
+ * 14. Column Tests
+ *******************************/
+void test_column() {
+    test_header("String Column");
+
+    utf8_column col;
+    utf8_column_init(&col, 2, 4);
+    utf8_string s = from("世界");
+    utf8_column_append_literal(&col, "alpha");
+    utf8_column_append(&col, &s);
+    utf8_column_append_literal(&col, "");
+    for (int i = 0; i < 100; i++) utf8_column_append_literal(&col, "🍣x");
+    test_assert(col.count == 103, "column: append grows rows");
+    test_assert(col.offsets[0] == 0 && col.offsets[3] == 11, "column: Arrow offsets");
+
+    utf8_slice row = utf8_column_get(&col, 1);
+    test_assert(utf8_compare(&row, "世界"), "column: zero copy row access");
+    row = utf8_column_get(&col, 2);
+    test_assert(row.length == 0, "column: empty row");
+    row = utf8_column_get(&col, 103);
+    test_assert(row.data == NULL, "column: out of bounds row");
+
+    test_assert(utf8_column_validate(&col) == -1, "column: all rows valid");
+    unsigned int counts[103];
+    utf8_column_char_counts(&col, counts);
+    test_assert(counts[0] == 5 && counts[1] == 2 && counts[2] == 0 && counts[102] == 2, "column: char counts");
+
+    uint64_t hashes[103];
+    utf8_column_hashes(&col, hashes);
+    test_assert(hashes[1] == utf8_hash(&s), "column: hash matches utf8_hash");
+    test_assert(utf8_column_find(&col, &s) == 1, "column: find row");
+    utf8_string missing = from("beta");
+    test_assert(utf8_column_find(&col, &missing) == -1, "column: find missing row");
+
+    // A sequence split across two rows is valid as a buffer but not as rows
+    utf8_column_append_literal(&col, "a\xE2");
+    utf8_column_append_literal(&col, "\x82\xAC");
+    test_assert(utf8_column_validate(&col) == 103, "column: split sequence detected");
+    utf8_column_free(&col);
+
+    utf8_column_init(&col, 0, 0);
+    utf8_column_append_literal(&col, "ok");
+    utf8_column_append_literal(&col, "bad\xC0\xAF");
+    test_assert(utf8_column_validate(&col) == 1, "column: invalid row detected");
+    utf8_column_free(&col);
+
+    // Re-appending a row of the same column while it grows
+    utf8_column_init(&col, 1, 4);
+    utf8_column_append_literal(&col, "日本語");
+    for (int i = 0; i < 6; i++) {
+        utf8_slice row = utf8_column_get(&col, col.count - 1);
+        utf8_column_append(&col, &row);
+    }
+    utf8_slice last = utf8_column_get(&col, 6);
+    test_assert(col.count == 7 && utf8_compare(&last, "日本語"), "column: self append survives realloc");
+    utf8_column_free(&col);
+
+    test_assert(utf8_validate(&s) && utf8_count_chars(&s) == 2, "validate and count chars");
+    utf8_free(&s);
+    utf8_free(&missing);
+}
+
+/*******************************
+ * 15. Edit Script Tests
+ *******************************/
+void test_apply_edits() {
+    test_header("Edit Script");
+
+    utf8_string s = from("Dear NAME, your ID is 1234 ¢€.");
+    utf8_string name = from("Zoë");
+    utf8_string mask = from("****");
+    utf8_edit edits[] = {
+        {5, 4, &name},      // NAME -> Zoë
+        {22, 4, &mask},     // 1234 -> ****
+        {27, 1, NULL},      // delete ¢
+        {30, 0, &mask},     // insert at end
+    };
+    test_assert(utf8_apply_edits(&s, edits, 4) == 0, "edits: applied");
+    test_assert(utf8_compare(&s, "Dear Zoë, your ID is **** €.****"), "edits: content");
+    test_assert(s.capacity == s.length, "edits: exact output size");
+
+    // Insert before the first character
+    utf8_edit front[] = {{0, 0, &mask}};
+    utf8_apply_edits(&s, front, 1);
+    test_assert(utf8_compare(&s, "****Dear Zoë, your ID is **** €.****"), "edits: insert at start");
+
+    // Overlapping or unsorted edits are rejected
+    utf8_edit overlap[] = {{2, 3, NULL}, {4, 1, NULL}};
+    test_assert(utf8_apply_edits(&s, overlap, 2) == -1, "edits: overlap rejected");
+    utf8_edit beyond[] = {{100, 0, &mask}};
+    test_assert(utf8_apply_edits(&s, beyond, 1) == -1, "edits: out of bounds rejected");
+    test_assert(utf8_compare(&s, "****Dear Zoë, your ID is **** €.****"), "edits: untouched on error");
+
+    // Replacement may be a slice of the edited string
+    utf8_slice head = slice_byte(&s, 0, 3);
+    utf8_edit self[] = {{4, 4, &head}};
+    utf8_apply_edits(&s, self, 1);
+    test_assert(utf8_compare(&s, "******** Zoë, your ID is **** €.****"), "edits: self slice replacement");
+
+    // Empty views are refused, an empty owned string takes inserts
+    utf8_slice empty_lit = UTF8_LIT("");
+    utf8_column col;
+    utf8_column_init(&col, 1, 0);
+    utf8_column_append_literal(&col, "");
+    utf8_slice empty_row = utf8_column_get(&col, 0);
+    utf8_edit put[] = {{0, 0, &mask}};
+    test_assert(utf8_apply_edits(&empty_lit, put, 1) == -1 && empty_lit.length == 0, "edits: empty literal write rejected");
+    test_assert(utf8_apply_edits(&empty_row, put, 1) == -1 && empty_row.length == 0, "edits: empty column row write rejected");
+    utf8_string owned = from("");
+    test_assert(utf8_apply_edits(&owned, put, 1) == 0 && utf8_compare(&owned, "****"), "edits: empty owned string");
+    utf8_free(&owned);
+    utf8_column_free(&col);
+
+    utf8_free(&s);
+    utf8_free(&name);
+    utf8_free(&mask);
+}
+
+/*******************************
+ * 16. Replace Tests
+ *******************************/
+void test_replace() {
+    test_header("Replace");
+
+    utf8_string s = from("a世b世世c");
+    utf8_string needle = from("世");
+    utf8_string longer = from("<world>");
+    utf8_string shorter = from("_");
+
+    utf8_string r1 = utf8_replace_all(&s, &needle, &longer);
+    test_assert(utf8_compare(&r1, "a<world>b<world><world>c"), "replace_all: grows");
+    test_assert(r1.capacity == r1.length, "replace_all: exact presize");
+    utf8_free(&r1);
+
+    utf8_string r2 = utf8_replace_all(&s, &longer, &needle);
+    test_assert(utf8_compare(&r2, "a世b世世c"), "replace_all: no match copies");
+    utf8_free(&r2);
+
+    utf8_string aaa = from("aaaa");
+    utf8_string aa = from("aa");
+    utf8_string r3 = utf8_replace_all(&aaa, &aa, &shorter);
+    test_assert(utf8_compare(&r3, "__"), "replace_all: non-overlapping matches");
+    utf8_free(&r3);
+
+    test_assert(utf8_replace_all_in_place(&s, &needle, &shorter) == 3, "replace_all_in_place: count");
+    test_assert(utf8_compare(&s, "a_b__c"), "replace_all_in_place: content");
+    test_assert(utf8_replace_all_in_place(&s, &shorter, &longer) == -1, "replace_all_in_place: longer rejected");
+
+    utf8_string text = from("naïve café ß");
+    unsigned int from_cps[] = {0xEF, 0xE9, 0xDF, ' '};
+    unsigned int to_cps[]   = {'i', 'e', 0x1E9E, 0x3000};
+    utf8_string r4 = utf8_replace_codepoints(&text, from_cps, to_cps, 4);
+    test_assert(utf8_compare(&r4, "naive　cafe　ẞ"), "replace_codepoints: mixed widths");
+    test_assert(r4.capacity == r4.length, "replace_codepoints: exact presize");
+    utf8_free(&r4);
+
+    test_assert(utf8_replace_codepoints_in_place(&text, from_cps, to_cps, 4) == -1, "replace_codepoints_in_place: growth rejected");
+    test_assert(utf8_replace_codepoints_in_place(&text, from_cps, to_cps, 2) == 2, "replace_codepoints_in_place: count");
+    test_assert(utf8_compare(&text, "naive cafe ß"), "replace_codepoints_in_place: content");
+
+    // Maps longer than the ASCII table, the first of repeated sources wins
+    unsigned int big_from[300], big_to[300];
+    for (unsigned int i = 0; i < 300; i++) {
+        big_from[i] = (i < 200) ? 0x100 + i : 0x20 + (i - 200) % 80;
+        big_to[i] = (i < 200) ? 'A' + i % 26 : '#';
+    }
+    big_from[299] = 0x100;
+    utf8_string accents = from("ĀāŁ ǅ!");
+    utf8_string r5 = utf8_replace_codepoints(&accents, big_from, big_to, 300);
+    test_assert(utf8_compare(&r5, "ABN#P#"), "replace_codepoints: 300 mappings");
+    test_assert(utf8_replace_codepoints_in_place(&accents, big_from, big_to, 300) == 6 && utf8_compare(&accents, "ABN#P#"), "replace_codepoints_in_place: 300 mappings");
+    utf8_free(&r5);
+    utf8_free(&accents);
+
+    // Empty views are refused
+    utf8_slice empty_lit = UTF8_LIT("");
+    utf8_slice empty_view = slice_byte(&s, 2, 1);
+    test_assert(utf8_replace_all_in_place(&empty_lit, &needle, &shorter) == -1, "replace_all_in_place: empty literal rejected");
+    test_assert(utf8_replace_codepoints_in_place(&empty_view, from_cps, to_cps, 2) == -1, "replace_codepoints_in_place: empty slice rejected");
+
+    unsigned char buf[4];
+    test_assert(encode_utf8_char(0x1F355, buf) == 4 && decode_utf8_char(buf) == 0x1F355, "encode_utf8_char: round trip");
+    test_assert(encode_utf8_char(0xD800, buf) == 0, "encode_utf8_char: surrogate rejected");
+
+    utf8_free(&s);
+    utf8_free(&needle);
+    utf8_free(&longer);
+    utf8_free(&shorter);
+    utf8_free(&aaa);
+    utf8_free(&aa);
+    utf8_free(&text);
+}
+
+/*******************************
+ * 17. Shared Slice Tests
+ *******************************/
+void test_shared_slices() {
+    test_header("Shared Slices");
+
+    utf8_string parent = from("Parent 世界");
+    utf8_slice pinned = slice_byte_shared(&parent, 7, 12);
+    utf8_slice whole = utf8_share(&parent);
+    test_assert(pinned.data == parent.data + 7, "shared: slice is zero copy");
+    test_assert(utf8_compare(&pinned, "世界"), "shared: slice content");
+
+    // Growth copies on write, slices keep the old storage
+    unsigned char* before = parent.data;
+    for (int i = 0; i < 100; i++) utf8_concat_literal(&parent, "Modified");
+    test_assert(parent.data != before, "shared: owner copied on write");
+    test_assert(utf8_compare(&pinned, "世界"), "shared: slice survives parent growth");
+    test_assert(utf8_compare(&whole, "Parent 世界"), "shared: whole view survives");
+
+    // Slices survive the owner being freed
+    utf8_free(&parent);
+    test_assert(utf8_compare(&pinned, "世界"), "shared: slice survives parent free");
+
+    // Slice of a pinned slice, writes through slices are refused
+    utf8_slice inner = slice_byte_shared(&whole, 0, 5);
+    test_assert(utf8_compare(&inner, "Parent"), "shared: slice of a shared slice");
+    utf8_concat_literal(&inner, "x");
+    test_assert(inner.length == 6, "shared: write through slice refused");
+    utf8_free(&whole);
+    utf8_free(&pinned);
+    test_assert(utf8_compare(&inner, "Parent"), "shared: last reference keeps storage");
+    utf8_free(&inner);
+
+    // Sole owner after all slices are gone keeps its storage without copying
+    utf8_string solo = from("solo");
+    utf8_slice tmp = slice_byte_shared(&solo, 0, 1);
+    utf8_free(&tmp);
+    before = solo.data;
+    utf8_string lower_s = from("s");
+    utf8_string upper_s = from("S");
+    utf8_replace_all_in_place(&solo, &lower_s, &upper_s);
+    test_assert(solo.data == before && utf8_compare(&solo, "Solo"), "shared: no copy once unshared");
+    utf8_free(&lower_s);
+    utf8_free(&upper_s);
+    utf8_free(&solo);
+
+    // Plain slices can not be pinned
+    utf8_string plain = from("plain");
+    utf8_slice view = slice_byte(&plain, 0, 2);
+    utf8_slice bad = slice_byte_shared(&view, 0, 1);
+    test_assert(bad.data == NULL, "shared: plain slice can not be pinned");
+    utf8_free(&plain);
+}
+
+/*******************************
+ * 18. Sanitize Tests
+ *******************************/
+void test_sanitize() {
+    test_header("Sanitize");
+
+    // Each maximal invalid subpart becomes one U+FFFD
+    utf8_string s = from("a\xC0\xAF" "b\xE2\x82" "c\xED\xA0\x80" "d\xF0\x9F\x8D");
+    int n = utf8_sanitize(&s);
+    test_assert(n == 7, "sanitize: replacement count");
+    test_assert(utf8_compare(&s, "a\uFFFD\uFFFD" "b\uFFFD" "c\uFFFD\uFFFD\uFFFD" "d\uFFFD"), "sanitize: maximal subparts");
+    test_assert(s.flags & UTF8_VALIDATED, "sanitize: result flagged as validated");
+    test_assert(utf8_validate(&s), "sanitize: result is valid");
+    test_assert(seek_char(&s, 3) == 7, "sanitize: seek_char on validated string");
+    utf8_free(&s);
+
+    // Three byte subparts are replaced in place
+    utf8_string p = from("0123456789012345678901234567890123456789012345678901234567890123456789\xF0\x9F\x8Dz");
+    unsigned char* before = p.data;
+    test_assert(utf8_sanitize(&p) == 1, "sanitize: long ASCII prefix");
+    test_assert(p.data == before && p.length == 74, "sanitize: in place");
+    utf8_free(&p);
+
+    // Valid input is untouched and flagged
+    utf8_string v = from("Grüße 🍣");
+    before = v.data;
+    test_assert(utf8_sanitize(&v) == 0 && v.data == before, "sanitize: valid input untouched");
+    test_assert(v.flags & UTF8_VALIDATED, "sanitize: valid input flagged");
+    utf8_concat_literal(&v, "\xFF");
+    test_assert(!(v.flags & UTF8_VALIDATED), "sanitize: flag cleared on mutation");
+    utf8_free(&v);
+
+    // Pinned slices keep the original bytes
+    utf8_string shared = from("x\xFFy");
+    utf8_slice pin = utf8_share(&shared);
+    utf8_sanitize(&shared);
+    test_assert(utf8_compare(&shared, "x\uFFFDy") && utf8_compare(&pin, "x\xFFy"), "sanitize: copy on write");
+    utf8_free(&pin);
+    utf8_free(&shared);
+}
+
+/*******************************
+ * 19. Literal Slice Tests
+ *******************************/
+void test_literals() {
+    test_header("Literal Slices");
+
+    utf8_slice nul = UTF8_LIT("A\0B");
+    test_assert(nul.length == 3, "literal: embedded NULL kept");
+    test_assert(nul.capacity == 0 && nul.shared == NULL, "literal: read-only view");
+
+    utf8_slice greet = UTF8_LIT("Grüße 🍣");
+    test_assert(greet.length == 12 && UTF8_LIT_CHARS("Grüße 🍣") == 7, "literal: length and char count");
+    test_assert(greet.flags & UTF8_VALIDATED, "literal: valid literal flagged");
+    test_assert(!(UTF8_LIT("\xC0\xAF").flags & UTF8_VALIDATED), "literal: invalid literal not flagged");
+    test_assert(!(UTF8_LIT("\xE2\x82").flags & UTF8_VALIDATED), "literal: truncated literal not flagged");
+
+    // Writes through the literal are refused, appends to owned strings work
+    utf8_concat_literal(&greet, "x");
+    test_assert(greet.length == 12, "literal: write refused");
+    utf8_string s = from("");
+    utf8_concat(&s, &UTF8_LIT("A\0B"));
+    utf8_concat(&s, &greet);
+    test_assert(s.length == 15 && s.data[1] == 0 && s.data[2] == 'B', "literal: concat without strlen");
+    utf8_free(&greet);  // No-op for slices
+    utf8_free(&s);
+}
+
+/*******************************
+ * 20. Case Mapping Tests
+ *******************************/
+void test_case_mapping() {
+    test_header("Case Mapping");
+
+    utf8_string s = from("Hello, WORLD! The quick brown fox jumps over the lazy dog. Ÿ ΣΑΣ Привет Ǆ ǅ ß");
+    utf8_string lower = utf8_to_lower(&s);
+    utf8_string upper = utf8_to_upper(&s);
+    test_assert(utf8_compare(&lower, "hello, world! the quick brown fox jumps over the lazy dog. ÿ σασ привет ǆ ǆ ß"), "to_lower: ASCII and BMP scripts");
+    test_assert(utf8_compare(&upper, "HELLO, WORLD! THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG. Ÿ ΣΑΣ ПРИВЕТ Ǆ Ǆ ß"), "to_upper: ASCII and BMP scripts");
+
+    // Size changing mappings: Ⱥ (2 bytes) lowers to ⱥ (3 bytes), ı (2 bytes) uppers to I
+    utf8_string grow = from("ȺıK𐐀");
+    utf8_string g1 = utf8_to_lower(&grow);
+    utf8_string g2 = utf8_to_upper(&grow);
+    test_assert(utf8_compare(&g1, "ⱥık𐐨"), "to_lower: length changing and supplementary");
+    test_assert(utf8_compare(&g2, "ȺIK𐐀"), "to_upper: length changing");
+
+    utf8_string fold_src = from("Straße ẞ ΣΊΣΥΦΟΣ ﬁ");
+    utf8_string folded = utf8_casefold(&fold_src);
+    test_assert(utf8_compare(&folded, "strasse ss σίσυφοσ fi"), "casefold: full folding");
+
+    utf8_string a = from("STRASSE and some longer ASCII text");
+    utf8_string b = from("straße AND SOME LONGER ascii TEXT");
+    utf8_string c = from("strasse and some longer ascii texts");
+    test_assert(utf8_casecmp(&a, &b) == 0, "casecmp: equal under folding");
+    test_assert(utf8_casecmp(&a, &c) < 0 && utf8_casecmp(&c, &a) > 0, "casecmp: prefix orders first");
+    utf8_string d = from("apple");
+    utf8_string e = from("BANANA");
+    test_assert(utf8_casecmp(&d, &e) < 0, "casecmp: caseless order");
+
+    utf8_string bad = from("A\xFF");
+    utf8_string bad_lower = utf8_to_lower(&bad);
+    test_assert(utf8_compare(&bad_lower, "a\xFF"), "to_lower: invalid bytes copied");
+
+    utf8_free(&s); utf8_free(&lower); utf8_free(&upper);
+    utf8_free(&grow); utf8_free(&g1); utf8_free(&g2);
+    utf8_free(&fold_src); utf8_free(&folded);
+    utf8_free(&a); utf8_free(&b); utf8_free(&c); utf8_free(&d); utf8_free(&e);
+    utf8_free(&bad); utf8_free(&bad_lower);
+}
+
+/*******************************
+ * 21. Normalization Tests
+ *******************************/
+void test_normalization() {
+    test_header("Normalization");
+
+    // Already normalized input is left in place, no copy
+    utf8_string nfc = from("café, naïve façade");
+    unsigned char* before = nfc.data;
+    test_assert(utf8_quick_check(&nfc, UTF8_NFC) == UTF8_QC_YES, "quick_check: precomposed text is NFC");
+    test_assert(utf8_normalize(&nfc, UTF8_NFC) == 0 && nfc.data == before, "normalize: NFC input untouched");
+    test_assert(utf8_quick_check(&nfc, UTF8_NFD) == UTF8_QC_NO, "quick_check: precomposed text is not NFD");
+
+    // e + COMBINING ACUTE composes to é
+    utf8_string decomposed = from("cafe\xCC\x81");
+    test_assert(utf8_quick_check(&decomposed, UTF8_NFC) == UTF8_QC_MAYBE, "quick_check: combining mark is MAYBE");
+    test_assert(utf8_normalize(&decomposed, UTF8_NFC) == 1, "normalize: NFC rewrites");
+    test_assert(utf8_compare(&decomposed, "caf\xC3\xA9"), "normalize: NFC composes");
+    test_assert(utf8_normalize(&decomposed, UTF8_NFD) == 1 && utf8_compare(&decomposed, "cafe\xCC\x81"), "normalize: NFD decomposes");
+
+    // Marks are sorted by combining class: dot below (220) before acute (230)
+    utf8_string marks = from("a\xCC\x81\xCC\xA3");
+    test_assert(utf8_quick_check(&marks, UTF8_NFD) == UTF8_QC_NO, "quick_check: marks out of order");
+    utf8_normalize(&marks, UTF8_NFD);
+    test_assert(utf8_compare(&marks, "a\xCC\xA3\xCC\x81"), "normalize: canonical ordering");
+    utf8_normalize(&marks, UTF8_NFC);
+    test_assert(utf8_compare(&marks, "\xE1\xBA\xA1\xCC\x81"), "normalize: composes past reordered marks");
+
+    // Hangul is decomposed and composed arithmetically
+    utf8_string hangul = from("한");
+    utf8_normalize(&hangul, UTF8_NFD);
+    test_assert(utf8_compare(&hangul, "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB"), "normalize: Hangul NFD");
+    utf8_normalize(&hangul, UTF8_NFC);
+    test_assert(utf8_compare(&hangul, "한"), "normalize: Hangul NFC");
+
+    // Compatibility forms
+    utf8_string compat = from("ﬁ①");
+    test_assert(utf8_normalize(&compat, UTF8_NFC) == 0, "normalize: ligature is NFC");
+    utf8_normalize(&compat, UTF8_NFKC);
+    test_assert(utf8_compare(&compat, "fi1"), "normalize: NFKC folds compatibility characters");
+    utf8_string long_s = from("\xE1\xBA\x9B\xCC\xA3");
+    utf8_string long_s2 = to_owned(&long_s);
+    utf8_normalize(&long_s, UTF8_NFKD);
+    utf8_normalize(&long_s2, UTF8_NFC);
+    test_assert(utf8_compare(&long_s, "s\xCC\xA3\xCC\x87"), "normalize: NFKD");
+    test_assert(utf8_compare(&long_s2, "\xE1\xBA\x9B\xCC\xA3"), "normalize: NFC keeps compatibility characters");
+
+    // MAYBE settled exactly
+    utf8_string x_acute = from("x\xCC\x81");
+    test_assert(utf8_is_normalized(&x_acute, UTF8_NFC) == 1, "is_normalized: mark without composite");
+    utf8_string e_acute = from("e\xCC\x81");
+    test_assert(utf8_is_normalized(&e_acute, UTF8_NFC) == 0, "is_normalized: composable pair");
+
+    // Chunked input, split inside a sequence and between base and mark
+    utf8_normalizer nz;
+    utf8_string out = from("");
+    utf8_string c1 = from("cafe\xCC");
+    utf8_string c2 = from("\x81 ok ");
+    utf8_string c3 = from("한");
+    utf8_normalizer_init(&nz, UTF8_NFC);
+    test_assert(utf8_normalizer_feed(&nz, &c1, &out) == 0 && utf8_compare(&out, "caf"), "normalizer: holds back the unfinished base");
+    test_assert(utf8_normalizer_feed(&nz, &c2, &out) == 0, "normalizer: completes split sequence");
+    test_assert(utf8_normalizer_feed(&nz, &c3, &out) == 0 && utf8_normalizer_finish(&nz, &out) == 0, "normalizer: finish");
+    test_assert(utf8_compare(&out, "caf\xC3\xA9 ok 한"), "normalizer: chunked NFC");
+    utf8_normalizer_free(&nz);
+
+    // Errors
+    utf8_string bad = from("e\xCC\x81\xFF");
+    test_assert(utf8_normalize(&bad, UTF8_NFC) == -1, "normalize: rejects invalid UTF-8");
+    utf8_string parent = from("e\xCC\x81!");
+    utf8_slice slice = slice_byte(&parent, 0, 2);
+    test_assert(utf8_normalize(&slice, UTF8_NFC) == -1 && utf8_compare(&parent, "e\xCC\x81!"), "normalize: refuses slice writes");
+
+    utf8_free(&nfc); utf8_free(&decomposed); utf8_free(&marks); utf8_free(&hangul);
+    utf8_free(&compat); utf8_free(&long_s); utf8_free(&long_s2);
+    utf8_free(&x_acute); utf8_free(&e_acute);
+    utf8_free(&out); utf8_free(&c1); utf8_free(&c2); utf8_free(&c3);
+    utf8_free(&bad); utf8_free(&parent);
+}
+
+/*******************************
+ * 22. Grapheme Cluster Tests
+ *******************************/
+void test_graphemes() {
+    test_header("Grapheme Clusters");
+
+    utf8_string ascii = from("Hello\r\nWorld\r\n");
+    test_assert(count_graphemes(&ascii) == 12, "count_graphemes: ASCII with CR LF");
+
+    // Arabic letters with harakat: 21 codepoints, 12 clusters
+    utf8_string arabic = from("ٱلسَّلَامُ عَلَيْكُمْ");
+    test_assert(utf8_count_chars(&arabic) == 21 && count_graphemes(&arabic) == 12, "count_graphemes: Arabic combining marks");
+    utf8_slice word = slice_grapheme(&arabic, 0, 5);
+    test_assert(utf8_compare(&word, "ٱلسَّلَامُ"), "slice_grapheme: keeps marks with their letter");
+    utf8_slice third = slice_grapheme(&arabic, 2, 2);
+    test_assert(utf8_compare(&third, "سَّ"), "slice_grapheme: single cluster with two marks");
+
+    // Emoji ZWJ sequence, skin tone modifier, flags
+    utf8_string emoji = from("a👨‍👩‍👧b👍🏽🇧🇩🇺🇸");
+    test_assert(count_graphemes(&emoji) == 6, "count_graphemes: ZWJ, modifier and flags");
+    utf8_slice family = slice_grapheme(&emoji, 1, 1);
+    test_assert(utf8_compare(&family, "👨‍👩‍👧"), "slice_grapheme: ZWJ sequence kept whole");
+    utf8_slice flag = slice_grapheme(&emoji, 5, 9);
+    test_assert(utf8_compare(&flag, "🇺🇸"), "slice_grapheme: regional indicator pairs, clipped");
+
+    // Iterator over decomposed Latin and Hangul jamo
+    utf8_string mixed = from("e\xCC\x81x\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB!");
+    unsigned int ends[8];
+    unsigned int steps = 0;
+    for (unsigned int i = 0, next; i < mixed.length && steps < 8; i = next) {
+        next = utf8_next_grapheme(&mixed, i);
+        ends[steps++] = next;
+    }
+    test_assert(steps == 4 && ends[0] == 3 && ends[1] == 4 && ends[2] == 13 && ends[3] == 14, "utf8_next_grapheme: marks and jamo");
+
+    // Non-emoji pictographs join through ZWJ (GB11), Prepend binds forward (GB9b)
+    utf8_slice stars = UTF8_LIT("\xE2\x98\x85\xE2\x80\x8D\xF0\x9F\x8C\xA2x");     // U+2605 ZWJ U+1F322 x
+    test_assert(count_graphemes(&stars) == 2 && utf8_next_grapheme(&stars, 0) == 10, "count_graphemes: Extended_Pictographic ZWJ sequence");
+    utf8_slice prepend = UTF8_LIT("\xF0\x91\xA8\xBA\xF0\x9F\x98\x80");     // U+11A3A U+1F600
+    test_assert(count_graphemes(&prepend) == 1, "count_graphemes: Prepend cluster");
+    utf8_slice kannada = UTF8_LIT("\xE0\xB2\x95\xE0\xB3\x80\xE0\xB2\x95");     // KA, II (SpacingMark), KA
+    test_assert(count_graphemes(&kannada) == 2, "count_graphemes: SpacingMark joins its base");
+
+    utf8_string bad = from("a\xFF\xCC\x81");
+    test_assert(count_graphemes(&bad) == 3, "count_graphemes: invalid byte stands alone");
+    test_assert(slice_grapheme(&ascii, 20, 21).data == NULL, "slice_grapheme: out of range");
+
+    utf8_free(&ascii); utf8_free(&arabic); utf8_free(&emoji);
+    utf8_free(&mixed); utf8_free(&bad);
+}
+
+/*******************************
+ * 23. Display Width Tests
+ *******************************/
+void test_display_width() {
+    test_header("Display Width");
+
+    utf8_string ascii = from("Hello, world");
+    utf8_string cjk = from("日本語abc");
+    utf8_string marks = from("cafe\xCC\x81!");
+    utf8_string mixed = from("ＡＢ\xE2\x80\x8B\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB👍");
+    test_assert(utf8_display_width(&ascii) == ascii.length, "display_width: ASCII is byte length");
+    test_assert(utf8_display_width(&cjk) == 9, "display_width: wide CJK");
+    test_assert(utf8_display_width(&marks) == 5, "display_width: combining mark is zero width");
+    test_assert(utf8_display_width(&mixed) == 8, "display_width: fullwidth, ZWSP, jamo and emoji");
+    utf8_string shy = from("a\xC2\xAD" "b\xCD\xB8");
+    test_assert(utf8_display_width(&shy) == 4, "display_width: soft hyphen and unassigned are one column");
+
+    test_assert(utf8_truncate_to_width(&ascii, 5) == 5 && utf8_compare(&ascii, "Hello"), "truncate_to_width: ASCII");
+    test_assert(utf8_truncate_to_width(&ascii, 80) == 5 && ascii.length == 5, "truncate_to_width: already fits");
+    utf8_slice view = slice_byte(&cjk, 0, cjk.length - 1);
+    test_assert(utf8_truncate_to_width(&view, 5) == 4 && utf8_compare(&view, "日本"), "truncate_to_width: drops half fitting wide char");
+    test_assert(utf8_compare(&cjk, "日本語abc"), "truncate_to_width: slice leaves parent alone");
+    test_assert(utf8_truncate_to_width(&cjk, 7) == 7 && utf8_compare(&cjk, "日本語a"), "truncate_to_width: wide then ASCII");
+    test_assert(utf8_truncate_to_width(&marks, 4) == 4 && utf8_compare(&marks, "cafe\xCC\x81"), "truncate_to_width: keeps trailing mark");
+
+    utf8_string bad = from("ab\xFF\xFF" "cd");
+    test_assert(utf8_display_width(&bad) == 6, "display_width: invalid bytes take a column each");
+
+    utf8_free(&ascii); utf8_free(&cjk); utf8_free(&marks); utf8_free(&mixed); utf8_free(&shy); utf8_free(&bad);
+}
+
+/*******************************
+ * 24. JSON Escaping Tests
+ *******************************/
+void test_json() {
+    test_header("JSON Escaping");
+
+    utf8_string raw = from("say \"hi\"\\\n\t\x01 é 😀");
+    utf8_string json = from("{\"msg\":\"");
+    test_assert(utf8_append_json_escaped(&json, &raw) == 0, "append_json_escaped: returns 0");
+    utf8_concat_literal(&json, "\"}");
+    test_assert(utf8_compare(&json, "{\"msg\":\"say \\\"hi\\\"\\\\\\n\\t\\u0001 é 😀\"}"), "append_json_escaped: quotes, backslash, controls");
+
+    // Clean 32-byte blocks around a single quote
+    utf8_string long_raw = from("The quick brown fox jumps over the lazy dog, \"twice\" and then once more for good measure.");
+    utf8_string long_json = from("");
+    utf8_append_json_escaped(&long_json, &long_raw);
+    test_assert(utf8_compare(&long_json, "The quick brown fox jumps over the lazy dog, \\\"twice\\\" and then once more for good measure."), "append_json_escaped: long clean runs");
+
+    utf8_string bad = from("a\xFF" "b\xE2\x82");
+    utf8_string bad_json = from("");
+    utf8_append_json_escaped(&bad_json, &bad);
+    test_assert(utf8_compare(&bad_json, "a\xEF\xBF\xBD" "b\xEF\xBF\xBD"), "append_json_escaped: invalid UTF-8 replaced");
+
+    // Source may be the destination itself or a view into it, across reallocs
+    utf8_string self = from("a\"b\n");
+    utf8_slice view = slice_byte(&self, 0, 3);
+    test_assert(utf8_append_json_escaped(&self, &view) == 0, "append_json_escaped: view of destination");
+    test_assert(utf8_append_json_escaped(&self, &self) == 0, "append_json_escaped: destination as source");
+    test_assert(utf8_compare(&self, "a\"b\na\\\"b\\na\\\"b\\na\\\\\\\"b\\\\n"), "append_json_escaped: self content");
+    utf8_free(&self);
+
+    utf8_string escaped = from("\\\"\\\\\\/\\b\\f\\n\\r\\t\\u00e9\\u20AC\\ud83d\\ude00 end");
+    utf8_string plain = utf8_json_unescape(&escaped);
+    test_assert(utf8_compare(&plain, "\"\\/\b\f\n\r\té€😀 end"), "json_unescape: simple escapes and surrogate pair");
+    test_assert(plain.flags & UTF8_VALIDATED, "json_unescape: result flagged valid");
+
+    utf8_string lone = from("\\ud800x\\udc00\xC0");
+    utf8_string lone_out = utf8_json_unescape(&lone);
+    test_assert(utf8_compare(&lone_out, "\xEF\xBF\xBDx\xEF\xBF\xBD\xEF\xBF\xBD"), "json_unescape: lone surrogates and invalid bytes");
+
+    utf8_string malformed = from("abc\\x");
+    utf8_string malformed_out = utf8_json_unescape(&malformed);
+    test_assert(malformed_out.data == NULL, "json_unescape: rejects unknown escape");
+    utf8_string short_u = from("\\u12");
+    utf8_string short_out = utf8_json_unescape(&short_u);
+    test_assert(short_out.data == NULL, "json_unescape: rejects truncated \\u");
+
+    // Round trip
+    utf8_string back_src = slice_byte(&json, 8, json.length - 3);
+    utf8_string back = utf8_json_unescape(&back_src);
+    test_assert(back.length == raw.length && memcmp(back.data, raw.data, raw.length) == 0, "json: round trip");
+
+    utf8_free(&raw); utf8_free(&json); utf8_free(&long_raw); utf8_free(&long_json);
+    utf8_free(&bad); utf8_free(&bad_json); utf8_free(&escaped); utf8_free(&plain);
+    utf8_free(&lone); utf8_free(&lone_out); utf8_free(&malformed); utf8_free(&short_u);
+    utf8_free(&back);
+}
+
+/*******************************
+ * 25. Legacy Encoding Tests
+ *******************************/
+void test_legacy_encodings() {
+    test_header("Latin-1 / Windows-1252");
+
+    utf8_string latin = utf8_from_latin1("caf\xE9 \xFF\0!", 8);
+    test_assert(latin.length == 10 && memcmp(latin.data, "café ÿ\0!", 10) == 0, "from_latin1: high bytes widened, NULL kept");
+    test_assert(latin.capacity == latin.length && (latin.flags & UTF8_VALIDATED), "from_latin1: exact size, flagged valid");
+
+    utf8_string cp = utf8_from_cp1252("\x80 \x93quoted\x94 \x81 \x99", 14);
+    test_assert(utf8_compare(&cp, "€ “quoted” \xC2\x81 ™") && cp.capacity == cp.length, "from_cp1252: 0x80-0x9F table");
+
+    // Every byte survives a round trip, with long ASCII runs in between
+    char all[256 + 64];
+    for (int i = 0; i < 256; i++) all[i] = (char)i;
+    memset(all + 256, 'x', 64);
+    utf8_string wide = utf8_from_latin1(all, sizeof(all));
+    utf8_string narrow = utf8_to_latin1(&wide, 1);
+    test_assert(narrow.length == sizeof(all) && memcmp(narrow.data, all, sizeof(all)) == 0, "latin1: round trip of all bytes");
+    utf8_string wide2 = utf8_from_cp1252(all, sizeof(all));
+    utf8_string narrow2 = utf8_to_cp1252(&wide2, 1);
+    test_assert(narrow2.length == sizeof(all) && memcmp(narrow2.data, all, sizeof(all)) == 0, "cp1252: round trip of all bytes");
+
+    utf8_string euro = from("5 € and ™");
+    utf8_string strict = utf8_to_latin1(&euro, 1);
+    utf8_string lossy = utf8_to_latin1(&euro, 0);
+    utf8_string win = utf8_to_cp1252(&euro, 1);
+    test_assert(strict.data == NULL, "to_latin1: lossless mode rejects €");
+    test_assert(lossy.length == 9 && memcmp(lossy.data, "5 ? and ?", 9) == 0, "to_latin1: lossy mode substitutes");
+    test_assert(win.length == 9 && memcmp(win.data, "5 \x80 and \x99", 9) == 0, "to_cp1252: maps € and ™");
+
+    utf8_string bad = from("a\xFF");
+    utf8_string bad_strict = utf8_to_cp1252(&bad, 1);
+    test_assert(bad_strict.data == NULL, "to_cp1252: lossless mode rejects invalid UTF-8");
+
+    // Empty input still gives an owned string that utf8_free releases
+    utf8_string none = utf8_from_latin1("", 0);
+    utf8_slice empty = UTF8_LIT("");
+    utf8_string none_back = utf8_to_cp1252(&empty, 1);
+    test_assert(none.data && none.length == 0 && none.capacity > 0, "from_latin1: empty input is owned");
+    test_assert(none_back.data && none_back.length == 0 && none_back.capacity > 0, "to_cp1252: empty input is owned");
+    utf8_free(&none); utf8_free(&none_back);
+
+    utf8_free(&latin); utf8_free(&cp); utf8_free(&wide); utf8_free(&narrow);
+    utf8_free(&wide2); utf8_free(&narrow2); utf8_free(&euro); utf8_free(&lossy);
+    utf8_free(&win); utf8_free(&bad);
+}
+
+/*******************************
+ * 26. Edit Distance Tests
+ *******************************/
+void test_edit_distance() {
+    test_header("Edit Distance");
+
+    utf8_string mixed = from("aé😀\xFF");
+    unsigned int cps[8];
+    unsigned int count = utf8_to_codepoints(&mixed, cps);
+    test_assert(count == 4 && cps[0] == 'a' && cps[1] == 0xE9 && cps[2] == 0x1F600 && cps[3] == 0xFFFD, "to_codepoints: bulk decode");
+
+    utf8_string kitten = from("kitten");
+    utf8_string sitting = from("sitting");
+    utf8_string cafe1 = from("café");
+    utf8_string cafe2 = from("cafe");
+    utf8_string jp1 = from("日本語のテキスト");
+    utf8_string jp2 = from("日本人のテキスト");
+    utf8_slice empty = UTF8_LIT("");
+    test_assert(utf8_edit_distance(&kitten, &sitting) == 3, "edit_distance: kitten / sitting");
+    test_assert(utf8_edit_distance(&cafe1, &cafe2) == 1, "edit_distance: counts codepoints, not bytes");
+    test_assert(utf8_edit_distance(&jp1, &jp2) == 1, "edit_distance: CJK substitution");
+    test_assert(utf8_edit_distance(&empty, &kitten) == 6 && utf8_edit_distance(&kitten, &kitten) == 0, "edit_distance: empty and equal");
+
+    // Longer than one 64-bit block on both sides
+    utf8_string long_a = from("");
+    utf8_string long_b = from("");
+    for (int i = 0; i < 40; i++) {
+        utf8_concat_literal(&long_a, "αβγ");
+        utf8_concat_literal(&long_b, (i % 10 == 3) ? "αγ" : "αβγ");
+    }
+    utf8_concat_literal(&long_b, "δ");
+    test_assert(utf8_edit_distance(&long_a, &long_b) == 5, "edit_distance: blocked, 120 codepoints");
+
+    test_assert(utf8_edit_distance_bounded(&kitten, &sitting, 3) == 3, "bounded: within k");
+    test_assert(utf8_edit_distance_bounded(&kitten, &sitting, 2) == 3, "bounded: over k gives k + 1");
+    test_assert(utf8_edit_distance_bounded(&empty, &long_a, 10) == 11, "bounded: length difference exits early");
+    test_assert(utf8_edit_distance_bounded(&long_a, &long_b, 4) == 5, "bounded: blocked early exit");
+
+    utf8_free(&mixed); utf8_free(&kitten); utf8_free(&sitting); utf8_free(&cafe1); utf8_free(&cafe2);
+    utf8_free(&jp1); utf8_free(&jp2); utf8_free(&long_a); utf8_free(&long_b);
+}
+
+/*******************************
+ * 27. Compare and Sort Tests
+ *******************************/
+void test_sort() {
+    test_header("Compare and Sort");
+
+    utf8_string a = from("apple");
+    utf8_string b = from("apple");
+    utf8_slice prefix = UTF8_LIT("app");
+    utf8_slice upper = UTF8_LIT("\xC3\xA9");     // U+00E9 sorts after every ASCII letter
+    test_assert(utf8_eq(&a, &b) && utf8_cmp(&a, &b) == 0, "eq/cmp: equal contents");
+    test_assert(!utf8_eq(&a, &prefix) && utf8_cmp(&prefix, &a) < 0 && utf8_cmp(&a, &prefix) > 0, "cmp: proper prefix sorts first");
+    test_assert(utf8_cmp(&a, &upper) < 0, "cmp: byte order is codepoint order");
+    utf8_hash(&a);
+    utf8_hash(&b);
+    test_assert(utf8_eq(&a, &b), "eq: cached hashes agree");
+
+    utf8_slice words[] = {
+        UTF8_LIT("pear"), UTF8_LIT("日本"), UTF8_LIT(""), UTF8_LIT("apple"), UTF8_LIT("app"),
+        UTF8_LIT("apple"), UTF8_LIT("été"), UTF8_LIT("a\0b"), UTF8_LIT("a"), UTF8_LIT("applesauce pie")
+    };
+    unsigned int n = sizeof(words) / sizeof(words[0]);
+    words[3].flags = 7;     // Marks the first "apple" to check stability
+    test_assert(utf8_sort(words, n, 1) == 0, "sort: small array");
+    int ordered = 1;
+    for (unsigned int i = 1; i < n; i++) ordered &= utf8_cmp(&words[i - 1], &words[i]) <= 0;
+    test_assert(ordered && words[0].length == 0 && words[n - 1].data[0] == 0xE6, "sort: byte order, empty first");
+    test_assert(words[4].flags == 7 && words[5].flags != 7, "sort: stable for equal strings");
+
+    // Enough strings for radix passes, long shared prefixes and several threads
+    unsigned int count = 3000;
+    utf8_string* many = (utf8_string*)malloc(count * sizeof(utf8_string));
+    unsigned int seed = 12345;
+    for (unsigned int i = 0; i < count; i++) {
+        many[i] = from("shared/prefix/");
+        unsigned int len = (seed >> 16) % 12;
+        for (unsigned int k = 0; k < len; k++) {
+            seed = seed * 1103515245u + 12345u;
+            char c[2] = { (char)('a' + (seed >> 16) % 4), 0 };
+            utf8_concat_literal(&many[i], (seed >> 20) % 7 ? c : "ä");
+        }
+        seed = seed * 1103515245u + 12345u;
+    }
+    utf8_string* copy = (utf8_string*)malloc(count * sizeof(utf8_string));
+    memcpy(copy, many, count * sizeof(utf8_string));
+    test_assert(utf8_sort(many, count, 1) == 0 && utf8_sort(copy, count, 4) == 0, "sort: single and multi threaded");
+    int sorted = 1, same = 1;
+    for (unsigned int i = 0; i < count; i++) {
+        if (i) sorted &= utf8_cmp(&many[i - 1], &many[i]) <= 0;
+        same &= many[i].data == copy[i].data;
+    }
+    test_assert(sorted, "sort: radix result ordered");
+    test_assert(same, "sort: threads give the same stable order");
+
+    for (unsigned int i = 0; i < count; i++) utf8_free(&many[i]);
+    free(many);
+    free(copy);
+    utf8_free(&a); utf8_free(&b);
+}
+
 int main() {
     printf("Starting Comprehensive UTF-8 Library Tests\n");
 
@@ -336,6 +1188,22 @@ int main() {
     test_special_encodings();
     test_invalid_input();
     test_iterative_print();
+    test_appendf();
+    test_hash_intern();
+    test_column();
+    test_apply_edits();
+    test_replace();
+    test_shared_slices();
+    test_sanitize();
+    test_literals();
+    test_case_mapping();
+    test_normalization();
+    test_graphemes();
+    test_display_width();
+    test_json();
+    test_legacy_encodings();
+    test_edit_distance();
+    test_sort();
 
     printf("\nTest Summary:\n");
     printf("Total Tests: %d\n", test_count);
@@ -0,0 +1,506 @@
+#!/usr/bin/env python3
+"""Generates utf8_unicode_tables.h from the Unicode Character Database.
+
+Usage:
+    python3 tools/gen_unicode_tables.py <ucd-14.0.0-dir> > utf8_unicode_tables.h
+
+The directory is the unpacked UCD.zip of the Unicode version in the header
+(https://www.unicode.org/Public/14.0.0/ucd/). It must contain UnicodeData.txt,
+SpecialCasing.txt, CaseFolding.txt, CompositionExclusions.txt,
+DerivedNormalizationProps.txt, EastAsianWidth.txt,
+auxiliary/GraphemeBreakProperty.txt and emoji/emoji-data.txt.
+"""
+
+import os
+import sys
+
+UNICODE_VERSION = "14.0.0"
+MAX_CP = 0x110000
+
+HANGUL_S_BASE = 0xAC00
+HANGUL_L_BASE = 0x1100
+HANGUL_V_BASE = 0x1161
+HANGUL_T_BASE = 0x11A7
+HANGUL_V_COUNT = 21
+HANGUL_T_COUNT = 28
+HANGUL_S_COUNT = 11172
+
+#NOTE: Unassigned codepoints in these blocks are still displayed wide.
+CJK_RESERVED = ((0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD))
+#NOTE: Hangul medial vowels and final consonants, drawn on top of the leading consonant.
+HANGUL_JAMO_ZERO = ((0x1160, 0x11FF), (0xD7B0, 0xD7FF))
+
+GCB_NAMES = {
+    "CR": "CR", "LF": "LF", "Control": "CONTROL", "Extend": "EXTEND", "ZWJ": "ZWJ",
+    "Regional_Indicator": "RI", "Prepend": "PREPEND", "SpacingMark": "SPACINGMARK",
+    "L": "L", "V": "V", "T": "T",
+}
+
+
+def ucd_lines(path):
+    """Yields the ';' separated fields of every data line, comments stripped."""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                yield [field.strip() for field in line.split(";")]
+
+
+def cp_range(field):
+    first, _, last = field.partition("..")
+    return int(first, 16), int(last or first, 16)
+
+
+def cps(field):
+    return [int(x, 16) for x in field.split()]
+
+
+class UnicodeData:
+    def __init__(self, path):
+        self.category = {}
+        self.ccc = {}
+        self.decomp = {}        #NOTE: cp -> (compat, [codepoints]), one level only
+        self.upper = {}
+        self.lower = {}
+        self.title = {}
+        first = None
+        for f in ucd_lines(path):
+            cp = int(f[0], 16)
+            if f[1].endswith(", First>"):
+                first = cp
+                continue
+            start = first if f[1].endswith(", Last>") else cp
+            first = None
+            for c in range(start, cp + 1):
+                self.category[c] = f[2]
+                if int(f[3]):
+                    self.ccc[c] = int(f[3])
+            if f[5]:
+                compat = f[5].startswith("<")
+                self.decomp[cp] = (compat, cps(f[5].split(">", 1)[1] if compat else f[5]))
+            for table, field in ((self.upper, f[12]), (self.lower, f[13]), (self.title, f[14])):
+                if field:
+                    table[cp] = int(field, 16)
+
+
+def read_special_casing(path):
+    """Unconditional full mappings: cp -> (lower, title, upper)."""
+    special = {}
+    for f in ucd_lines(path):
+        if len(f) > 4 and f[4]:
+            continue        #NOTE: Language or context dependent, not applied
+        special[int(f[0], 16)] = (cps(f[1]), cps(f[2]), cps(f[3]))
+    return special
+
+
+def read_case_folding(path):
+    simple, full = {}, {}
+    for f in ucd_lines(path):
+        if f[1] == "C":
+            simple[int(f[0], 16)] = int(f[2], 16)
+        elif f[1] == "F":
+            full[int(f[0], 16)] = cps(f[2])
+    return simple, full
+
+
+def read_property(path, wanted=None):
+    """Maps property value -> set of codepoints, for lines "range ; value"
+    or "range ; property ; value" (then keyed by (property, value))."""
+    props = {}
+    for f in ucd_lines(path):
+        first, last = cp_range(f[0])
+        key = f[1] if len(f) == 2 else (f[1], f[2])
+        if wanted and (key if len(f) == 2 else key[0]) not in wanted:
+            continue
+        props.setdefault(key, set()).update(range(first, last + 1))
+    return props
+
+
+def case_tables(ud, special, fold_simple):
+    lower, upper = {}, {}
+    for cp in range(MAX_CP):
+        s = special.get(cp)
+        lo = s[0] if s else [ud.lower.get(cp, cp)]
+        if lo != [cp]:
+            lower[cp] = lo[0]
+        up = s[2] if s else [ud.upper.get(cp, cp)]
+        if len(up) > 1:
+            up = s[1] if len(s[1]) == 1 else None
+        if up and up != [cp]:
+            upper[cp] = up[0]
+    return compress_case(lower), compress_case(upper), compress_case(fold_simple)
+
+
+def compress_case(mapping):
+    """Runs of consecutive codepoints with the same delta, then runs of every
+    other codepoint (alt = 1)."""
+    items = sorted(mapping.items())
+    rows = []
+    i = 0
+    while i < len(items):
+        cp, to = items[i]
+        delta = to - cp
+        j = i
+        while j + 1 < len(items) and items[j + 1][0] == items[j][0] + 1 and items[j + 1][1] - items[j + 1][0] == delta:
+            j += 1
+        if j > i:
+            rows.append((cp, items[j][0], delta, 0))
+            i = j + 1
+            continue
+        while j + 1 < len(items) and items[j + 1][0] == items[j][0] + 2 and items[j + 1][1] - items[j + 1][0] == delta:
+            j += 1
+        rows.append((cp, items[j][0], delta, 1 if j > i else 0))
+        i = j + 1
+    return rows
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def hangul_decompose(cp):
+    s = cp - HANGUL_S_BASE
+    out = [HANGUL_L_BASE + s // (HANGUL_V_COUNT * HANGUL_T_COUNT),
+           HANGUL_V_BASE + (s % (HANGUL_V_COUNT * HANGUL_T_COUNT)) // HANGUL_T_COUNT]
+    if s % HANGUL_T_COUNT:
+        out.append(HANGUL_T_BASE + s % HANGUL_T_COUNT)
+    return out
+
+
+def full_decomposition(ud, cp, compat):
+    if is_hangul_syllable(cp):
+        return hangul_decompose(cp)
+    d = ud.decomp.get(cp)
+    if not d or (d[0] and not compat):
+        return [cp]
+    out = []
+    for c in d[1]:
+        out += full_decomposition(ud, c, compat)
+    return out
+
+
+def canonical_order(seq, ud):
+    """Stable sort of each run of non-starters by combining class."""
+    out = list(seq)
+    i = 0
+    while i < len(out):
+        if not ud.ccc.get(out[i]):
+            i += 1
+            continue
+        j = i
+        while j < len(out) and ud.ccc.get(out[j]):
+            j += 1
+        out[i:j] = sorted(out[i:j], key=lambda c: ud.ccc[c])
+        i = j
+    return out
+
+
+def norm_tables(ud, exclusions, norm_props):
+    canon, compat = {}, {}
+    for cp in sorted(ud.decomp):
+        d = canonical_order(full_decomposition(ud, cp, False), ud)
+        kd = canonical_order(full_decomposition(ud, cp, True), ud)
+        if d != [cp]:
+            canon[cp] = d
+        if kd != [cp] and kd != d:
+            compat[cp] = kd
+
+    #NOTE: Full_Composition_Exclusion is the explicit list plus singletons and
+    #non-starter decompositions; cross-checked against the derived property.
+    excluded = set(exclusions)
+    for cp, (is_compat, d) in ud.decomp.items():
+        if is_compat:
+            continue
+        if len(d) == 1 or ud.ccc.get(cp) or ud.ccc.get(d[0]):
+            excluded.add(cp)
+    derived = norm_props.get("Full_Composition_Exclusion", set())
+    if excluded != derived:
+        sys.exit("Full_Composition_Exclusion mismatch: %s" % sorted(excluded ^ derived)[:10])
+
+    pairs = {}
+    for cp, (is_compat, d) in ud.decomp.items():
+        if not is_compat and len(d) == 2 and cp not in excluded:
+            pairs[(d[0], d[1])] = cp
+
+    qc_bits = ((("NFD_QC", "N"), 0x01), (("NFKD_QC", "N"), 0x02), (("NFC_QC", "N"), 0x04),
+               (("NFC_QC", "M"), 0x08), (("NFKC_QC", "N"), 0x10))
+    qc = {}
+    for key, bit in qc_bits:
+        for cp in norm_props.get(key, ()):
+            qc[cp] = qc.get(cp, 0) | bit
+
+    rows = []
+    for cp in range(MAX_CP):
+        key = (ud.ccc.get(cp, 0), qc.get(cp, 0))
+        if key == (0, 0):
+            continue
+        if rows and rows[-1][1] == cp - 1 and rows[-1][2] == key:
+            rows[-1][1] = cp
+        else:
+            rows.append([cp, cp, key])
+
+    decomp, pool = [], []
+    for cp in sorted(set(canon) | set(compat)):
+        for flag, table in ((0, canon), (1, compat)):
+            if cp in table:
+                decomp.append((cp, len(pool), len(table[cp]), flag))
+                pool += table[cp]
+    if len(pool) >= 0x10000 or max(d[2] for d in decomp) > 0xFF:
+        sys.exit("decomposition pool does not fit utf8_decomp")
+    return rows, decomp, pool, sorted(pairs.items())
+
+
+def grapheme_table(gcb, ext_pict):
+    prop = {}
+    for value, members in gcb.items():
+        if value in ("LV", "LVT"):
+            continue        #NOTE: Computed from the Hangul syllable formula
+        for cp in members:
+            prop[cp] = GCB_NAMES[value]
+    for cp in ext_pict:
+        if cp in prop:
+            sys.exit("Extended_Pictographic U+%04X is not Other" % cp)
+        prop[cp] = "EXT_PICT"
+    rows = []
+    for cp in sorted(prop):
+        if rows and rows[-1][1] == cp - 1 and rows[-1][2] == prop[cp]:
+            rows[-1][1] = cp
+        else:
+            rows.append([cp, cp, prop[cp]])
+    return rows
+
+
+def width_tables(ud, eaw):
+    wide = eaw.get("W", set()) | eaw.get("F", set())
+
+    def width(cp):
+        if cp == 0xAD:
+            return 1        #NOTE: Soft hyphen, the one Cf that terminals draw
+        category = ud.category.get(cp, "Cn")
+        if category in ("Mn", "Me", "Cf"):
+            return 0
+        if any(a <= cp <= b for a, b in HANGUL_JAMO_ZERO):
+            return 0
+        if cp in wide:
+            return 2
+        if category == "Cn" and any(a <= cp <= b for a, b in CJK_RESERVED):
+            return 2
+        return 1
+
+    blocks, stage1, stage2 = {}, [], []
+    for block in range(MAX_CP >> 8):
+        bits = bytearray(64)
+        for k in range(256):
+            bits[k >> 2] |= width((block << 8) + k) << ((k & 3) * 2)
+        key = bytes(bits)
+        if key not in blocks:
+            blocks[key] = len(stage2)
+            stage2.append(key)
+        stage1.append(blocks[key])
+    if len(stage2) > 256:
+        sys.exit("too many width blocks for an unsigned char stage1")
+    return stage1, stage2
+
+
+def emit(header, entries, width=104):
+    out = [header]
+    line = "   "
+    for entry in entries:
+        entry = " " + entry + ","
+        if len(line) + len(entry) > width:
+            out.append(line)
+            line = "   "
+        line += entry
+    out.append(line)
+    out.append("};")
+    return "\n".join(out)
+
+
+def emit_case(name, rows):
+    return emit("static const utf8_case_range %s[] = {" % name, ["{0x%X, 0x%X, %d, %d}" % r for r in rows])
+
+
+def emit_width(stage1, stage2):
+    out = ["static const unsigned char utf8_width_stage1[0x110000 >> 8] = {"]
+    for i in range(0, len(stage1), 16):
+        out.append("    " + " ".join("0x%02X," % v for v in stage1[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("static const unsigned char utf8_width_stage2[][64] = {")
+    for block in stage2:
+        for i in range(0, 64, 16):
+            row = " ".join("0x%02X," % v for v in block[i:i + 16])
+            if i == 0:
+                out.append("    {" + row)
+            else:
+                out.append("     " + row + ("}," if i == 48 else ""))
+    out.append("};")
+    return "\n".join(out)
+
+
+HEADER = """\
+//NOTE: Unicode property tables for utf8_string.c.
+//Generated from the Unicode Character Database %s (UnicodeData.txt,
+//SpecialCasing.txt, CaseFolding.txt, CompositionExclusions.txt,
+//DerivedNormalizationProps.txt, GraphemeBreakProperty.txt, emoji-data.txt and
+//EastAsianWidth.txt) by tools/gen_unicode_tables.py.
+//Do not edit the data by hand.
+
+#ifndef UTF8_UNICODE_TABLES_H
+#define UTF8_UNICODE_TABLES_H
+
+//NOTE: Case mapping. Codepoints first..last map to codepoint + delta.
+//alt = 1 means only every other codepoint (same parity as first) is mapped,
+//which covers the upper/lower pairs of Latin Extended, Cyrillic, etc.
+typedef struct utf8_case_range {
+    unsigned int first;
+    unsigned int last;
+    int delta;
+    unsigned char alt;
+} utf8_case_range;
+
+//NOTE: Full case folds that expand to more than one codepoint (ß -> ss).
+typedef struct utf8_fold_special {
+    unsigned int cp;
+    unsigned int to[3];     //NOTE: 0 terminated when shorter than 3
+} utf8_fold_special;
+"""
+
+NORM_HEADER = """\
+//NOTE: Normalization properties. ccc is the canonical combining class and qc
+//holds the quick-check bits below. Codepoints not listed have ccc 0 and pass
+//every quick check. Hangul syllables are decomposed and composed in code,
+//they have no entries in the decomposition and composition tables.
+#define UTF8_QC_NFD_NO      0x01
+#define UTF8_QC_NFKD_NO     0x02
+#define UTF8_QC_NFC_NO      0x04
+#define UTF8_QC_NFC_MAYBE   0x08    //NOTE: Same set for NFKC, may combine with the previous starter
+#define UTF8_QC_NFKC_NO     0x10
+
+typedef struct utf8_norm_range {
+    unsigned int first;
+    unsigned int last;
+    unsigned char ccc;
+    unsigned char qc;
+} utf8_norm_range;
+
+//NOTE: Full decompositions, already applied recursively. The codepoints are
+//utf8_decomp_pool[offset .. offset + len). A codepoint has a canonical entry
+//(compat = 0), a compatibility entry (compat = 1), or both in that order.
+typedef struct utf8_decomp {
+    unsigned int cp;
+    unsigned short offset;
+    unsigned char len;
+    unsigned char compat;
+} utf8_decomp;
+
+//NOTE: Primary composites, sorted by (first, second). Excluded compositions are left out.
+typedef struct utf8_compose_pair {
+    unsigned int first;
+    unsigned int second;
+    unsigned int composite;
+} utf8_compose_pair;
+"""
+
+GRAPHEME_HEADER = """\
+//NOTE: Grapheme_Cluster_Break values (UAX #29). Extended_Pictographic is
+//folded in as one more value since those codepoints are all Other.
+//Codepoints not listed are Other. Hangul syllables (LV, LVT) are computed.
+#define UTF8_GCB_OTHER          0
+#define UTF8_GCB_CR             1
+#define UTF8_GCB_LF             2
+#define UTF8_GCB_CONTROL        3
+#define UTF8_GCB_EXTEND         4
+#define UTF8_GCB_ZWJ            5
+#define UTF8_GCB_RI             6
+#define UTF8_GCB_PREPEND        7
+#define UTF8_GCB_SPACINGMARK    8
+#define UTF8_GCB_L              9
+#define UTF8_GCB_V              10
+#define UTF8_GCB_T              11
+#define UTF8_GCB_LV             12
+#define UTF8_GCB_LVT            13
+#define UTF8_GCB_EXT_PICT       14
+
+typedef struct utf8_grapheme_range {
+    unsigned int first;
+    unsigned int last;
+    unsigned char prop;
+} utf8_grapheme_range;
+"""
+
+WIDTH_HEADER = """\
+//NOTE: Display width in terminal columns, 2 bits per codepoint. stage1 picks
+//a 256 codepoint block, stage2 holds the deduplicated blocks, 4 codepoints per byte.
+//0: combining marks (Mn, Me), format characters (Cf) and Hangul medial/final jamo.
+//U+00AD SOFT HYPHEN is Cf but stays 1, as in wcwidth, since terminals print it
+//as a visible hyphen.
+//2: East Asian Wide and Fullwidth, including unassigned CJK ideograph ranges.
+//1: everything else, Ambiguous and other unassigned codepoints included."""
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: %s <ucd-%s-dir>" % (sys.argv[0], UNICODE_VERSION))
+    ucd = sys.argv[1]
+
+    def path(name):
+        return os.path.join(ucd, name)
+
+    ud = UnicodeData(path("UnicodeData.txt"))
+    special = read_special_casing(path("SpecialCasing.txt"))
+    fold_simple, fold_full = read_case_folding(path("CaseFolding.txt"))
+    exclusions = [cp_range(f[0])[0] for f in ucd_lines(path("CompositionExclusions.txt"))]
+    norm_props = read_property(path("DerivedNormalizationProps.txt"),
+                               {"Full_Composition_Exclusion", "NFD_QC", "NFKD_QC", "NFC_QC", "NFKC_QC"})
+    gcb = read_property(path("auxiliary/GraphemeBreakProperty.txt"))
+    ext_pict = read_property(path("emoji/emoji-data.txt"), {"Extended_Pictographic"})["Extended_Pictographic"]
+    eaw = read_property(path("EastAsianWidth.txt"))
+
+    lower, upper, fold = case_tables(ud, special, fold_simple)
+    if max(len(v) for v in fold_full.values()) > 3:
+        sys.exit("full case fold longer than utf8_fold_special.to")
+    norm_rows, decomp, pool, pairs = norm_tables(ud, exclusions, norm_props)
+    grapheme = grapheme_table(gcb, ext_pict)
+    stage1, stage2 = width_tables(ud, eaw)
+
+    out = [HEADER % UNICODE_VERSION]
+    out.append("//NOTE: Simple lowercase mapping (U+0130 uses the first codepoint of its full mapping).")
+    out.append(emit_case("utf8_lower_table", lower))
+    out.append("")
+    out.append("//NOTE: Simple uppercase mapping. Characters whose uppercase is longer than one")
+    out.append("//codepoint use their single codepoint titlecase form when it exists.")
+    out.append(emit_case("utf8_upper_table", upper))
+    out.append("")
+    out.append("//NOTE: Single codepoint case folds (CaseFolding.txt status C).")
+    out.append(emit_case("utf8_fold_table", fold))
+    out.append("")
+    out.append("//NOTE: Multi codepoint case folds (CaseFolding.txt status F).")
+    out.append(emit("static const utf8_fold_special utf8_fold_special_table[] = {",
+                    ["{0x%X, {0x%X, 0x%X, 0x%X}}" % ((cp,) + tuple(to + [0] * (3 - len(to))))
+                     for cp, to in sorted(fold_full.items())]))
+    out.append("")
+    out.append(NORM_HEADER)
+    out.append(emit("static const utf8_norm_range utf8_norm_table[] = {",
+                    ["{0x%X, 0x%X, %d, 0x%02X}" % (first, last, ccc, qc) for first, last, (ccc, qc) in norm_rows]))
+    out.append("")
+    out.append(emit("static const utf8_decomp utf8_decomp_table[] = {", ["{0x%X, %d, %d, %d}" % d for d in decomp]))
+    out.append("")
+    out.append(emit("static const unsigned int utf8_decomp_pool[] = {", ["0x%X" % cp for cp in pool]))
+    out.append("")
+    out.append(emit("static const utf8_compose_pair utf8_compose_table[] = {",
+                    ["{0x%X, 0x%X, 0x%X}" % (a, b, c) for (a, b), c in pairs]))
+    out.append("")
+    out.append(GRAPHEME_HEADER)
+    out.append(emit("static const utf8_grapheme_range utf8_grapheme_table[] = {",
+                    ["{0x%X, 0x%X, UTF8_GCB_%s}" % tuple(r) for r in grapheme]))
+    out.append("")
+    out.append(WIDTH_HEADER)
+    out.append(emit_width(stage1, stage2))
+    out.append("")
+    out.append("#endif")
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,6 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "utf8_unicode_tables.h"
 #define UTF8_Tail 0b00111111
 //NOTE: � is U+FFD -> 0xEF 0xBF 0xBD
 //Binary: 11101111 10111111 10111101
@@ -14,13 +20,88 @@
 #endif
 
 
+#define UTF8_VALIDATED 0x1      //NOTE: flags bit, content is known to be well-formed
+
 typedef struct utf8_string {
     unsigned char* data;
     unsigned int length;
     unsigned int capacity;
+    uint64_t hash;          //NOTE: Cached utf8_hash, 0 when not computed yet
+    struct utf8_buffer* shared;     //NOTE: Reference counted storage, NULL for plain strings
+    unsigned int flags;     //NOTE: UTF8_VALIDATED, cleared on mutation
 } utf8_string;
 typedef utf8_string utf8_slice;
 
+//NOTE: Zero copy read-only slice over a string literal. The length comes from
+//sizeof, so embedded NULL bytes are kept and strlen is never called.
+//The "" prefix rejects anything that is not a literal at compile time.
+#define UTF8_LIT(lit) ((utf8_slice){                  \
+        .data = (unsigned char*)("" lit),             \
+        .length = sizeof(lit) - 1,                    \
+        .capacity = 0,                                \
+        .hash = 0,                                    \
+        .shared = NULL,                               \
+        .flags = utf8_lit_flags("" lit, sizeof(lit) - 1) })
+#define UTF8_LIT_CHARS(lit) utf8_lit_chars("" lit, sizeof(lit) - 1)
+
+//NOTE: Validity and codepoint count of a literal. utf8_lit_flags runs utf8_next,
+//the one Table 3-7 decoder of the library, over the literal's bytes. gcc -O3
+//folds UTF8_LIT_CHARS to a constant where the definition is visible (this file,
+//or any file with -flto), the validity scan stays a short loop. The count is not
+//stored in the slice, utf8_string has no field for it.
+unsigned int utf8_lit_flags(const char* lit, unsigned int n);
+unsigned int utf8_lit_chars(const char* lit, unsigned int n);
+
+//NOTE: Interning table. Canonical strings are owned by the pool,
+//so equal contents share one handle and compare by pointer.
+typedef struct utf8_intern_pool {
+    utf8_string** slots;    //NOTE: Open addressing, NULL marks an empty slot
+    unsigned int mask;      //NOTE: Slot count - 1, slot count is a power of two
+    unsigned int count;
+    pthread_rwlock_t lock;
+} utf8_intern_pool;
+
+//NOTE: Many strings in one buffer. Row i is data[offsets[i] .. offsets[i+1]),
+//the same layout as an Arrow Utf8 array. Only the 32-bit offsets of Utf8 are
+//implemented, not the 64-bit LargeUtf8 ones, since lengths and capacities are
+//32-bit throughout the library. A column holds at most 4 GiB of row data,
+//appends past that fail.
+typedef struct utf8_column {
+    unsigned char* data;
+    uint32_t* offsets;      //NOTE: count + 1 entries, offsets[0] == 0
+    unsigned int count;
+    unsigned int capacity;
+    unsigned int offsets_capacity;
+} utf8_column;
+
+//NOTE: One step of an edit script. Replaces `count` characters starting at
+//character `from`. count 0 inserts, a NULL replacement deletes.
+typedef struct utf8_edit {
+    unsigned int from;
+    unsigned int count;
+    utf8_string* replacement;
+} utf8_edit;
+
+//NOTE: Normalization forms and quick-check answers
+#define UTF8_NFC        0
+#define UTF8_NFD        1
+#define UTF8_NFKC       2
+#define UTF8_NFKD       3
+#define UTF8_QC_NO      0
+#define UTF8_QC_YES     1
+#define UTF8_QC_MAYBE   2
+
+//NOTE: Incremental normalizer for chunked input. Output is written once no
+//later chunk can change it, everything after the last stable starter is held back.
+typedef struct utf8_normalizer {
+    int form;
+    unsigned int* pending;      //NOTE: Decomposed, canonically ordered codepoints
+    unsigned int count;
+    unsigned int capacity;
+    unsigned char partial[4];   //NOTE: Sequence split between two chunks
+    unsigned int partial_len;
+} utf8_normalizer;
+
 
 int fputs_len(const unsigned char* str, unsigned int len, FILE* stream);
 unsigned int decode_utf8_char(unsigned char* Input);
@@ -43,6 +124,63 @@ void delete_byte(utf8_string* src, unsigned int from, unsigned int till);
 void delete_char(utf8_string* src, unsigned int from, unsigned int till);
 void insert (utf8_string* dest, utf8_string* src, unsigned int location);   //NOTE: Slice volatile
 int seek_char(utf8_string* src, unsigned int gap);
+utf8_slice slice_byte_shared(utf8_string* src, unsigned int from, unsigned int till);
+utf8_slice utf8_share(utf8_string* src);
+int utf8_reserve(utf8_string* s, unsigned int additional);     //NOTE: Slice volatile
+int utf8_appendf(utf8_string* dest, const char* fmt, ...);      //NOTE: Slice volatile
+int utf8_vappendf(utf8_string* dest, const char* fmt, va_list ap);
+uint64_t utf8_hash_bytes(const unsigned char* data, unsigned int len, uint64_t seed);
+uint64_t utf8_hash(utf8_string* s);
+int utf8_intern_init(utf8_intern_pool* pool, unsigned int initial_capacity);
+utf8_string* utf8_intern(utf8_intern_pool* pool, utf8_string* s);
+utf8_string* utf8_intern_literal(utf8_intern_pool* pool, char* input);
+void utf8_intern_free(utf8_intern_pool* pool);
+int utf8_validate(utf8_string* s);
+unsigned int utf8_count_chars(utf8_string* s);
+int utf8_column_init(utf8_column* col, unsigned int rows, unsigned int bytes);
+int utf8_column_append(utf8_column* col, utf8_string* s);
+int utf8_column_append_literal(utf8_column* col, char* s);
+utf8_slice utf8_column_get(utf8_column* col, unsigned int index);     //NOTE: Slice volatile
+int utf8_column_validate(utf8_column* col);
+void utf8_column_char_counts(utf8_column* col, unsigned int* out);
+void utf8_column_hashes(utf8_column* col, uint64_t* out);
+int utf8_column_find(utf8_column* col, utf8_string* needle);
+void utf8_column_free(utf8_column* col);
+int utf8_apply_edits(utf8_string* s, utf8_edit* edits, unsigned int n);     //NOTE: Slice volatile
+int encode_utf8_char(unsigned int codepoint, unsigned char* Output);
+utf8_string utf8_replace_all(utf8_string* src, utf8_string* needle, utf8_string* replacement);
+int utf8_replace_all_in_place(utf8_string* s, utf8_string* needle, utf8_string* replacement);
+utf8_string utf8_replace_codepoints(utf8_string* src, const unsigned int* from_cps, const unsigned int* to_cps, unsigned int n);
+int utf8_replace_codepoints_in_place(utf8_string* s, const unsigned int* from_cps, const unsigned int* to_cps, unsigned int n);
+int utf8_sanitize(utf8_string* s);     //NOTE: Slice volatile
+utf8_string utf8_to_lower(utf8_string* src);
+utf8_string utf8_to_upper(utf8_string* src);
+utf8_string utf8_casefold(utf8_string* src);
+int utf8_casecmp(utf8_string* a, utf8_string* b);
+int utf8_quick_check(utf8_string* s, int form);
+int utf8_is_normalized(utf8_string* s, int form);
+int utf8_normalize(utf8_string* s, int form);     //NOTE: Slice volatile
+int utf8_normalizer_init(utf8_normalizer* nz, int form);
+int utf8_normalizer_feed(utf8_normalizer* nz, utf8_string* chunk, utf8_string* out);
+int utf8_normalizer_finish(utf8_normalizer* nz, utf8_string* out);
+void utf8_normalizer_free(utf8_normalizer* nz);
+unsigned int utf8_next_grapheme(utf8_string* src, unsigned int byte_pos);
+unsigned int count_graphemes(utf8_string* src);
+utf8_slice slice_grapheme(utf8_string* src, unsigned int from, unsigned int till);
+unsigned int utf8_display_width(utf8_string* s);
+unsigned int utf8_truncate_to_width(utf8_string* s, unsigned int max_width);
+int utf8_append_json_escaped(utf8_string* dst, utf8_string* src);     //NOTE: Slice volatile
+utf8_string utf8_json_unescape(utf8_string* src);
+utf8_string utf8_from_latin1(const char* input, unsigned int len);
+utf8_string utf8_from_cp1252(const char* input, unsigned int len);
+utf8_string utf8_to_latin1(utf8_string* src, int lossless);
+utf8_string utf8_to_cp1252(utf8_string* src, int lossless);
+unsigned int utf8_to_codepoints(utf8_string* s, unsigned int* out);
+long long utf8_edit_distance(utf8_string* a, utf8_string* b);
+long long utf8_edit_distance_bounded(utf8_string* a, utf8_string* b, unsigned int k);
+int utf8_eq(utf8_string* a, utf8_string* b);
+int utf8_cmp(utf8_string* a, utf8_string* b);
+int utf8_sort(utf8_string* items, unsigned int count, unsigned int threads);
 
 //NOTE: Handle Overlong Encoding   -- Too man bytes for '/' [X]
 //NOTE: Handle Surrogates Pairs    -- UTF-16 Only           [X]
@@ -165,7 +303,7 @@ int num_byte(unsigned char* Input){
 //  -> Find character
 //  -> Genarate
 //  -> Show to stdout
-//TODO: A printf like functionality would we nice addition.
+//NOTE: For printf like formatting into a utf8_string, see utf8_appendf.
 void print_utf8(utf8_string* utf8_str) {
     fputs_len( utf8_str->data, utf8_str->length, stdout);
 }
@@ -184,6 +322,70 @@ int fputs_len(const unsigned char* str, unsigned int len, FILE* stream) {
     return len;  // Return the number of characters written
 }
 
+//NOTE: Every mutation goes through here so cached properties never go stale.
+static void utf8_invalidate_cache(utf8_string* s) {
+    s->hash = 0;
+    s->flags = 0;
+}
+
+//NOTE: Owned strings always have capacity > 0, empty ones included, so capacity 0
+//marks a view (slice, literal, column row) whatever its length. Only a NULL string
+//owns nothing to write through and may grow into a fresh allocation.
+static int utf8_check_writable(utf8_string* s){
+    if (s->capacity == 0 && s->data) {
+        fprintf(stderr, "Invalid write through slice\n");
+        return -1;
+    }
+    return 0;
+}
+
+//NOTE: Storage shared between an owner and pinned slices.
+//The owner copies on write while any slice still holds a reference.
+typedef struct utf8_buffer {
+    atomic_uint refs;
+    unsigned char* base;
+} utf8_buffer;
+
+static void utf8_release(utf8_buffer* buf){
+    if (atomic_fetch_sub(&buf->refs, 1) == 1) {
+        free(buf->base);
+        free(buf);
+    }
+}
+
+//NOTE: Frees plain storage or drops the reference to shared storage.
+static void utf8_drop_buffer(utf8_string* s){
+    if (s->shared) utf8_release(s->shared);
+    else free(s->data);
+    s->shared = NULL;
+}
+
+//NOTE: Called before every in place write. Pinned slices keep the old bytes,
+//the owner continues on a private copy. Returns -1 for writes through a slice.
+static int utf8_make_unique(utf8_string* s){
+    if (!s->shared) return 0;
+    if (s->capacity == 0) {
+        fprintf(stderr, "Invalid write through slice\n");
+        return -1;
+    }
+    if (atomic_load(&s->shared->refs) == 1) {
+        //NOTE: Only the owner is left, keep the storage
+        free(s->shared);
+        s->shared = NULL;
+        return 0;
+    }
+    unsigned char* copy = (unsigned char*)malloc(s->capacity);
+    if (!copy) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    memcpy(copy, s->data, s->length);
+    utf8_release(s->shared);
+    s->shared = NULL;
+    s->data = copy;
+    return 0;
+}
+
 //NOTE: Failed interop avoided because string is taken from the first NULL byte.
 // Using NULL bytes to break the system should not be possible.
 //FIXME: NULL is INVALID []
@@ -192,10 +394,13 @@ utf8_string from(char* input) {
     int len = strlen(input);    //works for string literal
     dbg("input size -> %u\n", len);
     utf8_string s;
-    s.data = (unsigned char*)malloc(len);
+    s.data = (unsigned char*)malloc(len ? len : 1);   //NOTE: from("") is owned too, capacity 0 means slice
     memcpy(s.data, input, len);
     s.length = len; // Wont keep NULL
-    s.capacity = len;
+    s.capacity = len ? len : 1;
+    s.hash = 0;
+    s.shared = NULL;
+    s.flags = 0;
     dbg("s.data     -> ");
     dbg_utf8(&s);
     dbg("\n");
@@ -206,26 +411,13 @@ utf8_string from(char* input) {
 
 
 void utf8_concat(utf8_string* s1, utf8_string* s2) {
-    //NOTE: Handles Invalid Slice writes
-    if(s1->capacity == 0){
-            fprintf(stderr, "Invalid write through slice\n");
-    }
-    int new_size = s1->length + s2->length;
-
-    if( new_size > s1->capacity){
-        unsigned int new_cap = new_size * 3/2 ;    //NOTE: Increase by 1.5x for geometric growth
-        unsigned char* new_data = (unsigned char*)realloc(s1->data, new_size);         
-        if (!new_data){ //NOTE: Handle realloc failure
-            fprintf(stderr, "Memory allocation failed\n");
-            return;
-        }
-        s1->data = new_data;
-        s1->capacity = new_cap;
-        //FIXME: Possible free pointer use may occur after reallocaion through slice access.
-    }
+    //NOTE: Handles Invalid Slice writes and geometric growth
+    if (utf8_reserve(s1, s2->length) != 0) return;
+    //FIXME: Possible free pointer use may occur after reallocaion through slice access.
 
     memcpy(s1->data + s1->length, s2->data, s2->length);
     s1->length = s1->length + s2->length;
+    utf8_invalidate_cache(s1);
     //NOTE:Avoid using s1->length = strlen(data) because,
     //uneven capacity and length strings might cause prooblem
     dbg("s1.data     -> ");
@@ -236,20 +428,13 @@ void utf8_concat(utf8_string* s1, utf8_string* s2) {
 } 
 
 void utf8_concat_literal(utf8_string* s1, char* s2) {
-    //NOTE: Handles Invalid Slice writes
-    if(s1->capacity == 0){
-            fprintf(stderr, "Invalid write through slice. capacity : %u\n", s1->capacity);
-    }
     int len2 = strlen(s2);
-    int new_size = s1->length + len2; 
-
-    if( new_size > s1->capacity){
-        s1->capacity = new_size;
-        s1->data = (unsigned char*)realloc(s1->data, new_size);
-    }
+    //NOTE: Handles Invalid Slice writes and geometric growth
+    if (utf8_reserve(s1, len2) != 0) return;
 
     memcpy(s1->data + s1->length, s2, len2);
     s1->length = s1->length + len2;
+    utf8_invalidate_cache(s1);
     //NOTE:Avoid using s1->length = strlen(data) because,
     //uneven capacity and length strings might cause prooblem
     dbg("s1.data     -> ");
@@ -264,6 +449,14 @@ void utf8_push_str_literal(utf8_string* s, char* utf8_char) {
 }
 
 void utf8_free(utf8_string* s) {
+    if(s->shared){  //NOTE: Owner and pinned slices each drop one reference
+        utf8_release(s->shared);
+        s->shared = NULL;
+        s->data = NULL;
+        s->length = 0;
+        s->capacity = 0;
+        return;
+    }
     if(s->capacity == 0){   //NOTE: No risk of double free.
         s->data = NULL;
         s->length = 0;
@@ -290,6 +483,9 @@ void utf8_iterate_print( utf8_string* s){
 utf8_slice slice_byte(utf8_string* src, unsigned int from, unsigned int till){
     utf8_string slice = *src;
     slice.capacity = 0;
+    slice.hash = 0;
+    slice.shared = NULL;    //NOTE: Plain slices do not pin storage, see slice_byte_shared
+    slice.flags = 0;        //NOTE: A byte range may cut a sequence
     //NOTE: Buffer overflow / Invalid Memory Access Checked
     if( till  > src->length ){
         printf("slice_byte : Error: Bufferflow\n");
@@ -312,7 +508,10 @@ utf8_slice slice_char(utf8_string* src, unsigned int from, unsigned int till){
         utf8_slice slice = { 
         .data = NULL,
         .length = 0,
-        .capacity = 0
+        .capacity = 0,
+        .hash = 0,
+        .shared = NULL,
+        .flags = 0
     };
         return slice;
     }
@@ -339,9 +538,74 @@ void align_next(utf8_string* src, unsigned int byte_pos) {
     fprintf(stderr, "Out of bounds byte position\n");
 }
 
+//NOTE: Turns the storage of src into shared storage (once) and takes a reference.
+//Returns NULL when src can not be pinned (a plain slice).
+static utf8_buffer* utf8_pin(utf8_string* src){
+    if (!src->shared) {
+        if (src->capacity == 0) {
+            fprintf(stderr, "utf8_pin : Error: Plain slices can not be shared, use to_owned\n");
+            return NULL;
+        }
+        utf8_buffer* buf = (utf8_buffer*)malloc(sizeof(utf8_buffer));
+        if (!buf) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return NULL;
+        }
+        atomic_init(&buf->refs, 1);     //NOTE: The owner's reference
+        buf->base = src->data;
+        src->shared = buf;
+    }
+    atomic_fetch_add(&src->shared->refs, 1);
+    return src->shared;
+}
+
+//NOTE: Same range rules as slice_byte, bytes from..till inclusive. The slice pins
+//the storage, so it stays valid when the parent grows, changes or is freed.
+//Release it with utf8_free.
+utf8_slice slice_byte_shared(utf8_string* src, unsigned int from, unsigned int till){
+    utf8_slice slice = {
+        .data = NULL,
+        .length = 0,
+        .capacity = 0,
+        .hash = 0,
+        .shared = NULL,
+        .flags = 0
+    };
+    //NOTE: Buffer overflow / Invalid Memory Access Checked
+    if( till >= src->length || from > till ){
+        printf("slice_byte_shared : Error: Bufferflow\n");
+        return slice;
+    }
+    slice.shared = utf8_pin(src);
+    if (!slice.shared) return slice;
+    slice.data = src->data + from;
+    slice.length = till - from + 1;
+    return slice;
+}
+
+//NOTE: Pinned view of the whole string. O(1), no copy.
+utf8_slice utf8_share(utf8_string* src){
+    if (src->length == 0) {
+        utf8_slice empty = {
+            .data = NULL,
+            .length = 0,
+            .capacity = 0,
+            .hash = 0,
+            .shared = NULL,
+            .flags = 0
+        };
+        return empty;
+    }
+    utf8_slice slice = slice_byte_shared(src, 0, src->length - 1);
+    slice.hash = src->hash;
+    slice.flags = src->flags;
+    return slice;
+}
+
 
 //TODO: to_owned.slice  [X]
 //TODO: first_match     []
+//TODO: replace_all     [X]
 //TODO: seek_char       [X]
 //TODO: delete_byte     [X]
 //TODO: delete_char     [X]
@@ -350,14 +614,19 @@ void align_next(utf8_string* src, unsigned int byte_pos) {
 
 utf8_string to_owned(utf8_string* slice){
     utf8_string string;
-    string.data = (unsigned char*)malloc(slice->length); 
+    string.data = (unsigned char*)malloc(slice->length ? slice->length : 1);
     //FIXME: Handle Allocation failure
-    memcpy(string.data, slice->data, slice->length);
+    if (slice->length) memcpy(string.data, slice->data, slice->length);
     string.length = slice->length;
-    string.capacity = slice->length;
+    string.capacity = slice->length ? slice->length : 1;
+    string.hash = slice->hash;  //NOTE: Same content, same hash
+    string.shared = NULL;
+    string.flags = slice->flags;
     return string;
 }
 
+static unsigned int utf8_lead_len(unsigned char lead);
+
 int seek_char(utf8_string* src, unsigned int gap){
     //NOTE: NULL input and NULL data check
     if( !src || !src->data || !gap) return 0;
@@ -367,7 +636,8 @@ int seek_char(utf8_string* src, unsigned int gap){
     for(int i=0;i<gap;i++){ 
 
         if( seek >= src->length) return -1;  //NOTE: Object out of bound. Can be used to count how many UTF-8 character is in a utf8_string.
-        int bytes = num_byte(&src->data[seek]);
+        //NOTE: Validated strings skip the per character checks
+        int bytes = (src->flags & UTF8_VALIDATED) ? (int)utf8_lead_len(src->data[seek]) : num_byte(&src->data[seek]);
         if (bytes == 0xFFFD){   // num_byte returns 0xFFFD on Error;
             fprintf(stderr, "Invalid UTF-8 encoding encountered\n"); 
             //NOTE: Wondering if I should use this on other functions
@@ -389,9 +659,11 @@ void delete_byte(utf8_string* src, unsigned int from, unsigned int till){
     fprintf(stderr, "Out of bounds byte position\n");
     return;
     }
+    if (utf8_make_unique(src) != 0) return;
     utf8_slice slice_2 = slice_byte(src, till + 1,src->length); //NOTE: till + 1 for the next byte from till(th) byte
     memmove(src->data + from, slice_2.data, src->length - till);
     src->length = src->length - (till - from + 1); //NOTE: FIXED length indexing
+    utf8_invalidate_cache(src);
 }
 
 void delete_char(utf8_string* src, unsigned int from, unsigned int till){
@@ -404,6 +676,7 @@ void delete_char(utf8_string* src, unsigned int from, unsigned int till){
         fprintf(stderr, "Out of bounds byte position\n");
         return;
     }
+    if (utf8_make_unique(src) != 0) return;
  
     int pos_head = seek_char(src, from);
     int pos_tail = seek_char(src, till + 1); //NOTE: The next character from till
@@ -418,16 +691,15 @@ void delete_char(utf8_string* src, unsigned int from, unsigned int till){
     dbg("deleted_char.capacity -> %u\n", src->capacity);
 
     src->length = src->length - (pos_tail - pos_head);
+    utf8_invalidate_cache(src);
 
 }
 
 void insert (utf8_string* dest, utf8_string* src, unsigned int location){
     //NOTE: Handles Invalid Slice writes
-    if(dest->capacity == 0){
-            fprintf(stderr, "Invalid write through slice\n");
-    }
+    if (utf8_check_writable(dest) != 0) return;
     //NOTE: Here string slices can be inserted. But, can't be inserted to a slice.
-
+    if (utf8_make_unique(dest) != 0) return;
 
     int new_size = dest->length + src->length;
 
@@ -443,6 +715,7 @@ void insert (utf8_string* dest, utf8_string* src, unsigned int location){
     memcpy(dest->data + pos_insert, src->data, src->length);
     // Update length
     dest->length += src->length;
+    utf8_invalidate_cache(dest);
     //NOTE:Avoid using s1->length = strlen(data) because,
     //uneven capacity and length strings might cause prooblem
     dbg("dest.data     -> ");
@@ -453,6 +726,2606 @@ void insert (utf8_string* dest, utf8_string* src, unsigned int location){
 
 
 }
+
+//NOTE: Grows an owned string so that `additional` more bytes fit after length.
+//Returns 0 on success, -1 on slice writes or allocation failure.
+int utf8_reserve(utf8_string* s, unsigned int additional){
+    //NOTE: Handles Invalid Slice writes, empty views included
+    if (utf8_check_writable(s) != 0) return -1;
+    if (utf8_make_unique(s) != 0) return -1;
+    unsigned int new_size = s->length + additional;
+    if( new_size <= s->capacity) return 0;
+
+    unsigned int new_cap = new_size + new_size / 2;    //NOTE: Increase by 1.5x for geometric growth
+    unsigned char* new_data = (unsigned char*)realloc(s->data, new_cap);
+    if (!new_data){ //NOTE: Handle realloc failure
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    s->data = new_data;
+    s->capacity = new_cap;
+    return 0;
+}
+
+//NOTE: Byte length implied by a lead byte. No validation, stray bytes count as 1.
+static unsigned int utf8_lead_len(unsigned char lead){
+    if (lead < 0b11000000) return 1;
+    if (lead < 0b11100000) return 2;
+    if (lead < 0b11110000) return 3;
+    if (lead < 0b11111000) return 4;
+    return 1;
+}
+
+static int utf8_append_bytes(utf8_string* dest, const unsigned char* bytes, unsigned int len){
+    if (utf8_reserve(dest, len) != 0) return -1;
+    memcpy(dest->data + dest->length, bytes, len);
+    dest->length += len;
+    return 0;
+}
+
+//NOTE: %s and %S conversions. Width and precision are counted in codepoints, not bytes.
+static int utf8_append_padded(utf8_string* dest, const unsigned char* str, unsigned int len,
+                              int left, int width, int precision){
+    unsigned int chars = 0;
+    unsigned int end = 0;
+    while (end < len && (precision < 0 || chars < (unsigned int)precision)) {
+        end += utf8_lead_len(str[end]);
+        chars++;
+    }
+    if (end > len) end = len;   //NOTE: Truncated sequence at the end
+    unsigned int pad = (width > 0 && (unsigned int)width > chars) ? (unsigned int)width - chars : 0;
+
+    //NOTE: %S may be a slice of dest, keep its offset so it survives the realloc below
+    uintptr_t base = (uintptr_t)dest->data;
+    int inside = end && base && (uintptr_t)str >= base && (uintptr_t)str < base + dest->capacity;
+    unsigned int src_offset = inside ? (unsigned int)((uintptr_t)str - base) : 0;
+    if (utf8_reserve(dest, end + pad) != 0) return -1;
+    if (inside) str = dest->data + src_offset;
+    if (!left) {
+        memset(dest->data + dest->length, ' ', pad);
+        dest->length += pad;
+    }
+    memcpy(dest->data + dest->length, str, end);
+    dest->length += end;
+    if (left) {
+        memset(dest->data + dest->length, ' ', pad);
+        dest->length += pad;
+    }
+    return 0;
+}
+
+//NOTE: Formats one conversion straight into the spare capacity.
+//Only formats a second time when the measured result did not fit.
+static int utf8_append_spec(utf8_string* dest, const char* spec, ...){
+    va_list ap, retry;
+    va_start(ap, spec);
+    va_copy(retry, ap);
+    unsigned int spare = dest->capacity - dest->length;
+    int n = vsnprintf((char*)dest->data + dest->length, spare, spec, ap);
+    va_end(ap);
+    if (n >= 0 && (unsigned int)n >= spare) {  //NOTE: vsnprintf needs room for its NULL byte
+        if (utf8_reserve(dest, n + 1) == 0) n = vsnprintf((char*)dest->data + dest->length, n + 1, spec, retry);
+        else n = -1;
+    }
+    va_end(retry);
+    if (n < 0) return -1;
+    dest->length += n;
+    return 0;
+}
+
+//NOTE: A %S or %s argument may point into dest as it was when the call started.
+//Earlier growth may have moved that buffer, so such pointers are rebased onto
+//the current one. The bytes before the start length are the same in both.
+static const unsigned char* utf8_rebase_arg(utf8_string* dest, const unsigned char* p,
+                                            const unsigned char* entry, unsigned int entry_cap){
+    uintptr_t base = (uintptr_t)entry;
+    if (!base || (uintptr_t)p < base || (uintptr_t)p >= base + entry_cap) return p;
+    return dest->data + ((uintptr_t)p - base);
+}
+
+//NOTE: printf like formatting appended to dest.
+//Extra conversion: %S takes a utf8_string* (or utf8_slice*).
+//Returns the number of bytes appended, -1 on error.
+int utf8_appendf(utf8_string* dest, const char* fmt, ...){
+    va_list ap;
+    va_start(ap, fmt);
+    int n = utf8_vappendf(dest, fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+int utf8_vappendf(utf8_string* dest, const char* fmt, va_list ap){
+    if (!dest || !fmt) return -1;
+    unsigned int start = dest->length;
+    uint64_t hash = dest->hash;
+    const unsigned char* entry = dest->data;
+    unsigned int entry_cap = dest->capacity;
+    unsigned int flags = dest->flags;
+    //NOTE: Literal text of the format is the usual lower bound. Also rejects slices.
+    if (utf8_reserve(dest, strlen(fmt)) != 0) return -1;
+    utf8_invalidate_cache(dest);
+
+    const char* p = fmt;
+    while (*p) {
+        const char* run = p;
+        while (*p && *p != '%') p++;
+        if (p > run && utf8_append_bytes(dest, (const unsigned char*)run, p - run) != 0) goto fail;
+        if (!*p) break;
+        p++;
+        if (*p == '%') {
+            if (utf8_append_bytes(dest, (const unsigned char*)"%", 1) != 0) goto fail;
+            p++;
+            continue;
+        }
+
+        //NOTE: Rebuild the conversion with '*' arguments resolved.
+        char spec[48];
+        int k = 0;
+        int left = 0;
+        spec[k++] = '%';
+        while (*p && strchr("-+ #0", *p)) {
+            if (*p == '-') left = 1;
+            if (k < 8) spec[k++] = *p;
+            p++;
+        }
+        int width = -1;
+        if (*p == '*') {
+            width = va_arg(ap, int);
+            if (width < 0) {
+                left = 1;
+                width = -width;
+                if (k < 8) spec[k++] = '-';
+            }
+            p++;
+        } else {
+            while (*p >= '0' && *p <= '9') width = (width < 0 ? 0 : width * 10) + (*p++ - '0');
+        }
+        int precision = -1;
+        if (*p == '.') {
+            p++;
+            precision = 0;
+            if (*p == '*') {
+                precision = va_arg(ap, int);    //NOTE: Negative means omitted
+                p++;
+            } else {
+                while (*p >= '0' && *p <= '9') precision = precision * 10 + (*p++ - '0');
+            }
+        }
+        char length[3] = "";
+        if (*p == 'h' || *p == 'l') {
+            length[0] = *p++;
+            if (*p == length[0]) length[1] = *p++;
+        } else if (*p && strchr("jztL", *p)) {
+            length[0] = *p++;
+        }
+        char conv = *p;
+        if (!conv) {
+            fprintf(stderr, "utf8_appendf : Error: Incomplete format specifier\n");
+            goto fail;
+        }
+        p++;
+        if (width >= 0) k += snprintf(spec + k, sizeof(spec) - k, "%d", width);
+        if (precision >= 0) k += snprintf(spec + k, sizeof(spec) - k, ".%d", precision);
+        snprintf(spec + k, sizeof(spec) - k, "%s%c", length, conv);
+
+        int err = 0;
+        switch (conv) {
+            case 'S': {
+                utf8_string* s = va_arg(ap, utf8_string*);
+                if (!s) err = utf8_append_padded(dest, (const unsigned char*)"(null)", 6, left, width, precision);
+                else    err = utf8_append_padded(dest, utf8_rebase_arg(dest, s->data, entry, entry_cap), s->data ? s->length : 0, left, width, precision);
+                break;
+            }
+            case 's': {
+                if (length[0]) { err = -1; break; }   //NOTE: Wide strings not supported
+                const char* s = va_arg(ap, const char*);
+                if (!s) s = "(null)";
+                const unsigned char* str = utf8_rebase_arg(dest, (const unsigned char*)s, entry, entry_cap);
+                err = utf8_append_padded(dest, str, strlen((const char*)str), left, width, precision);
+                break;
+            }
+            case 'd': case 'i':
+                if      (length[0] == 'l' && length[1] == 'l') err = utf8_append_spec(dest, spec, va_arg(ap, long long));
+                else if (length[0] == 'l') err = utf8_append_spec(dest, spec, va_arg(ap, long));
+                else if (length[0] == 'j') err = utf8_append_spec(dest, spec, va_arg(ap, intmax_t));
+                else if (length[0] == 'z') err = utf8_append_spec(dest, spec, va_arg(ap, size_t));
+                else if (length[0] == 't') err = utf8_append_spec(dest, spec, va_arg(ap, ptrdiff_t));
+                else err = utf8_append_spec(dest, spec, va_arg(ap, int));   //NOTE: hh and h are promoted to int
+                break;
+            case 'o': case 'u': case 'x': case 'X':
+                if      (length[0] == 'l' && length[1] == 'l') err = utf8_append_spec(dest, spec, va_arg(ap, unsigned long long));
+                else if (length[0] == 'l') err = utf8_append_spec(dest, spec, va_arg(ap, unsigned long));
+                else if (length[0] == 'j') err = utf8_append_spec(dest, spec, va_arg(ap, uintmax_t));
+                else if (length[0] == 'z') err = utf8_append_spec(dest, spec, va_arg(ap, size_t));
+                else if (length[0] == 't') err = utf8_append_spec(dest, spec, va_arg(ap, ptrdiff_t));
+                else err = utf8_append_spec(dest, spec, va_arg(ap, unsigned int));
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                if (length[0] == 'L') err = utf8_append_spec(dest, spec, va_arg(ap, long double));
+                else err = utf8_append_spec(dest, spec, va_arg(ap, double));
+                break;
+            case 'c':
+                if (length[0]) { err = -1; break; }   //NOTE: Wide characters not supported
+                err = utf8_append_spec(dest, spec, va_arg(ap, int));
+                break;
+            case 'p':
+                err = utf8_append_spec(dest, spec, va_arg(ap, void*));
+                break;
+            default:
+                err = -1;
+        }
+        if (err) {
+            fprintf(stderr, "utf8_appendf : Error: Unsupported format specifier %s\n", spec);
+            goto fail;
+        }
+    }
+    dbg("appendf.data     -> ");
+    dbg_utf8(dest);
+    dbg("\n");
+    dbg("appendf.length   -> %u\n", dest->length);
+    dbg("appendf.capacity -> %u\n", dest->capacity);
+    return dest->length - start;
+
+fail:
+    //NOTE: Nothing of a failed call stays appended
+    dest->length = start;
+    dest->hash = hash;
+    dest->flags = flags;
+    return -1;
+}
+
+//NOTE: Mixing follows wyhash (public domain). 128-bit multiply folds both halves.
+static inline uint64_t utf8_mix(uint64_t a, uint64_t b){
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+static inline uint64_t utf8_read64(const unsigned char* p){
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint64_t utf8_read32(const unsigned char* p){
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+uint64_t utf8_hash_bytes(const unsigned char* p, unsigned int len, uint64_t seed){
+    const uint64_t s0 = 0xa0761d6478bd642full, s1 = 0xe7037ed1a0b428dbull;
+    const uint64_t s2 = 0x8ebc6af09c88c6e3ull, s3 = 0x589965cc75374cc3ull;
+    seed ^= utf8_mix(seed ^ s0, s1);
+    uint64_t a = 0, b = 0;
+    if (len <= 16) {
+        if (len >= 4) {
+            //NOTE: Two overlapping 4-byte reads from each end cover 4..16 bytes
+            unsigned int mid = (len >> 3) << 2;
+            a = (utf8_read32(p) << 32) | utf8_read32(p + mid);
+            b = (utf8_read32(p + len - 4) << 32) | utf8_read32(p + len - 4 - mid);
+        } else if (len > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+        }
+    } else {
+        unsigned int i = len;
+        if (i > 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {    //NOTE: Three independent lanes keep the multipliers busy
+                seed = utf8_mix(utf8_read64(p) ^ s1, utf8_read64(p + 8) ^ seed);
+                see1 = utf8_mix(utf8_read64(p + 16) ^ s2, utf8_read64(p + 24) ^ see1);
+                see2 = utf8_mix(utf8_read64(p + 32) ^ s3, utf8_read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = utf8_mix(utf8_read64(p) ^ s1, utf8_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = utf8_read64(p + i - 16);
+        b = utf8_read64(p + i - 8);
+    }
+    a ^= s1;
+    b ^= seed;
+    __uint128_t r = (__uint128_t)a * b;
+    a = (uint64_t)r;
+    b = (uint64_t)(r >> 64);
+    return utf8_mix(a ^ s0 ^ len, b ^ s1);
+}
+
+//NOTE: Hash of the content, cached in s->hash until the next mutation.
+uint64_t utf8_hash(utf8_string* s){
+    if (!s) return 0;
+    if (s->hash) return s->hash;
+    uint64_t h = utf8_hash_bytes(s->data, s->data ? s->length : 0, 0);
+    if (h == 0) h = 1;  //NOTE: 0 is reserved for "not computed"
+    s->hash = h;
+    return h;
+}
+
+int utf8_intern_init(utf8_intern_pool* pool, unsigned int initial_capacity){
+    if (initial_capacity > 0x40000000u) {   //NOTE: 2x the slots must fit in 32 bits
+        fprintf(stderr, "utf8_intern_init : Error: Initial capacity too large\n");
+        return -1;
+    }
+    unsigned int cap = 16;
+    while (cap < initial_capacity * 2) cap <<= 1;   //NOTE: Keep load factor under 0.5
+    pool->slots = (utf8_string**)calloc(cap, sizeof(utf8_string*));
+    if (!pool->slots) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    pool->mask = cap - 1;
+    pool->count = 0;
+    pthread_rwlock_init(&pool->lock, NULL);
+    return 0;
+}
+
+//NOTE: Linear probe. Returns the slot holding s, or the empty slot where it belongs.
+static utf8_string** utf8_intern_probe(utf8_string** slots, unsigned int mask, utf8_string* s, uint64_t h){
+    unsigned int i = (unsigned int)h & mask;
+    while (slots[i]) {
+        utf8_string* c = slots[i];
+        if (c->hash == h && c->length == s->length && memcmp(c->data, s->data, s->length) == 0) break;
+        i = (i + 1) & mask;
+    }
+    return &slots[i];
+}
+
+static int utf8_intern_grow(utf8_intern_pool* pool){
+    if (pool->mask >= 0x7FFFFFFFu) {
+        fprintf(stderr, "utf8_intern : Error: Pool is full\n");
+        return -1;
+    }
+    unsigned int cap = (pool->mask + 1) * 2;
+    utf8_string** slots = (utf8_string**)calloc(cap, sizeof(utf8_string*));
+    if (!slots) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    for (unsigned int i = 0; i <= pool->mask; i++) {
+        utf8_string* c = pool->slots[i];
+        if (c) *utf8_intern_probe(slots, cap - 1, c, c->hash) = c;
+    }
+    free(pool->slots);
+    pool->slots = slots;
+    pool->mask = cap - 1;
+    return 0;
+}
+
+//NOTE: Returns the canonical handle for the content of s. The handle is owned
+//by the pool: do not modify or utf8_free it. Lookups may run concurrently.
+utf8_string* utf8_intern(utf8_intern_pool* pool, utf8_string* s){
+    if (!pool || !s || (!s->data && s->length)) return NULL;
+    uint64_t h = utf8_hash(s);
+
+    pthread_rwlock_rdlock(&pool->lock);
+    utf8_string* found = *utf8_intern_probe(pool->slots, pool->mask, s, h);
+    pthread_rwlock_unlock(&pool->lock);
+    if (found) return found;
+
+    pthread_rwlock_wrlock(&pool->lock);
+    //NOTE: Another thread may have inserted it between the two locks
+    utf8_string** slot = utf8_intern_probe(pool->slots, pool->mask, s, h);
+    if (!*slot) {
+        utf8_string* canon = (utf8_string*)malloc(sizeof(utf8_string));
+        if (canon) {
+            *canon = to_owned(s);
+            canon->hash = h;
+        }
+        if (!canon || !canon->data) {
+            fprintf(stderr, "Memory allocation failed\n");
+            free(canon);
+            pthread_rwlock_unlock(&pool->lock);
+            return NULL;
+        }
+        *slot = canon;
+        pool->count++;
+        if (pool->count * 2 > pool->mask + 1 && utf8_intern_grow(pool) != 0) {
+            //NOTE: Undo the insert, a full table would make utf8_intern_probe loop forever on a miss
+            *slot = NULL;
+            pool->count--;
+            utf8_free(canon);
+            free(canon);
+            pthread_rwlock_unlock(&pool->lock);
+            return NULL;
+        }
+        found = canon;
+    } else {
+        found = *slot;
+    }
+    pthread_rwlock_unlock(&pool->lock);
+    return found;
+}
+
+utf8_string* utf8_intern_literal(utf8_intern_pool* pool, char* input){
+    if (!input) return NULL;
+    //NOTE: Looked up as a borrowed view, only copied on first insertion
+    utf8_slice view = {
+        .data = (unsigned char*)input,
+        .length = strlen(input),
+        .capacity = 0,
+        .hash = 0,
+        .shared = NULL,
+        .flags = 0
+    };
+    return utf8_intern(pool, &view);
+}
+
+void utf8_intern_free(utf8_intern_pool* pool){
+    if (!pool || !pool->slots) return;
+    for (unsigned int i = 0; i <= pool->mask; i++) {
+        if (pool->slots[i]) {
+            utf8_free(pool->slots[i]);
+            free(pool->slots[i]);
+        }
+    }
+    free(pool->slots);
+    pool->slots = NULL;
+    pool->count = 0;
+    pthread_rwlock_destroy(&pool->lock);
+}
+
+//NOTE: Bounded decoder following the well-formed table of Unicode 3.9 (Table 3-7).
+//Returns the sequence length when valid. Otherwise returns -k, where k is the
+//length of the maximal invalid subpart (always >= 1).
+static int utf8_next(const unsigned char* p, unsigned int n, unsigned int* cp){
+    unsigned char b0 = p[0];
+    if (b0 < 0b10000000) {
+        *cp = b0;
+        return 1;
+    }
+    unsigned int need;
+    unsigned int c;
+    unsigned char lo = 0x80, hi = 0xBF;
+    if (b0 >= 0xC2 && b0 <= 0xDF) {
+        need = 1;
+        c = b0 & 0b00011111;
+    } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+        need = 2;
+        c = b0 & 0b00001111;
+        if (b0 == 0xE0) lo = 0xA0;          //NOTE: Overlong
+        else if (b0 == 0xED) hi = 0x9F;     //NOTE: Surrogates
+    } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+        need = 3;
+        c = b0 & 0b00000111;
+        if (b0 == 0xF0) lo = 0x90;          //NOTE: Overlong
+        else if (b0 == 0xF4) hi = 0x8F;     //NOTE: Beyond U+10FFFF
+    } else {
+        return -1;  //NOTE: Stray continuation or invalid lead byte
+    }
+    for (unsigned int i = 1; i <= need; i++) {
+        if (i >= n || p[i] < lo || p[i] > hi) return -(int)i;   //NOTE: Truncated or bad continuation
+        c = (c << 6) | (p[i] & UTF8_Tail);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    *cp = c;
+    return need + 1;
+}
+
+unsigned int utf8_lit_flags(const char* lit, unsigned int n){
+    const unsigned char* p = (const unsigned char*)lit;
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) return 0;
+        i += len;
+    }
+    return UTF8_VALIDATED;
+}
+
+unsigned int utf8_lit_chars(const char* lit, unsigned int n){
+    unsigned int chars = 0;
+    for (unsigned int i = 0; i < n; i++) chars += ((unsigned char)lit[i] & 0b11000000) != 0b10000000;
+    return chars;
+}
+
+#define UTF8_HIGH_BITS 0x8080808080808080ull
+
+//NOTE: Length of the leading ASCII run. Checks 64-byte blocks, then 8 bytes per step.
+static unsigned int utf8_ascii_prefix(const unsigned char* p, unsigned int n){
+    unsigned int i = 0;
+    while (i + 64 <= n) {
+        uint64_t w = 0;
+        for (int k = 0; k < 64; k += 8) w |= utf8_read64(p + i + k);   //NOTE: Unrolled and vectorized at -O2
+        if (w & UTF8_HIGH_BITS) break;
+        i += 64;
+    }
+    while (i + 8 <= n && !(utf8_read64(p + i) & UTF8_HIGH_BITS)) i += 8;
+    while (i < n && p[i] < 0b10000000) i++;
+    return i;
+}
+
+//NOTE: Offset of the first invalid sequence, or n when all bytes are valid.
+static unsigned int utf8_valid_prefix(const unsigned char* p, unsigned int n){
+    unsigned int i = 0;
+    unsigned int cp;
+    while (i < n) {
+        i += utf8_ascii_prefix(p + i, n - i);
+        if (i >= n) break;
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) return i;
+        i += len;
+    }
+    return n;
+}
+
+//NOTE: Codepoints are the bytes that are not continuation bytes (10xxxxxx).
+static unsigned int utf8_count_bytes(const unsigned char* p, unsigned int n){
+    unsigned int i = 0;
+    unsigned int cont = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w = utf8_read64(p + i);
+        cont += __builtin_popcountll(w & ~(w << 1) & UTF8_HIGH_BITS);
+    }
+    for (; i < n; i++) cont += (p[i] & 0b11000000) == 0b10000000;
+    return n - cont;
+}
+
+//NOTE: 1 when the whole string is well-formed UTF-8, 0 otherwise. Caches success in flags.
+int utf8_validate(utf8_string* s){
+    if (!s || !s->data) return s && s->length == 0;
+    if (s->flags & UTF8_VALIDATED) return 1;
+    if (utf8_valid_prefix(s->data, s->length) != s->length) return 0;
+    s->flags |= UTF8_VALIDATED;
+    return 1;
+}
+
+//NOTE: Number of codepoints. Assumes valid input, stray bytes are not checked.
+unsigned int utf8_count_chars(utf8_string* s){
+    if (!s || !s->data) return 0;
+    return utf8_count_bytes(s->data, s->length);
+}
+
+int utf8_column_init(utf8_column* col, unsigned int rows, unsigned int bytes){
+    col->data = (unsigned char*)malloc(bytes ? bytes : 1);
+    col->offsets = (uint32_t*)malloc(sizeof(uint32_t) * (rows + 1));
+    if (!col->data || !col->offsets) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(col->data);
+        free(col->offsets);
+        col->data = NULL;
+        col->offsets = NULL;
+        return -1;
+    }
+    col->offsets[0] = 0;
+    col->count = 0;
+    col->capacity = bytes ? bytes : 1;
+    col->offsets_capacity = rows + 1;
+    return 0;
+}
+
+static int utf8_column_push(utf8_column* col, const unsigned char* bytes, unsigned int len){
+    unsigned int used = col->offsets[col->count];
+    if (len > 0xFFFFFFFFu - used) {     //NOTE: Offsets are uint32
+        fprintf(stderr, "utf8_column_append : Error: Column larger than 4 GiB\n");
+        return -1;
+    }
+    //NOTE: The row may come from utf8_column_get on this column, keep its
+    //offset so it survives the realloc below
+    uintptr_t base = (uintptr_t)col->data;
+    int inside = len && (uintptr_t)bytes >= base && (uintptr_t)bytes < base + col->capacity;
+    unsigned int src_offset = inside ? (unsigned int)((uintptr_t)bytes - base) : 0;
+    if (used + len > col->capacity) {
+        unsigned long long grown = (unsigned long long)(used + len) * 3 / 2;    //NOTE: Increase by 1.5x for geometric growth
+        unsigned int new_cap = grown > 0xFFFFFFFFu ? 0xFFFFFFFFu : (unsigned int)grown;
+        unsigned char* new_data = (unsigned char*)realloc(col->data, new_cap);
+        if (!new_data) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return -1;
+        }
+        col->data = new_data;
+        col->capacity = new_cap;
+    }
+    if (col->count + 2 > col->offsets_capacity) {
+        unsigned int new_cap = col->offsets_capacity * 2;
+        uint32_t* new_offsets = (uint32_t*)realloc(col->offsets, sizeof(uint32_t) * new_cap);
+        if (!new_offsets) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return -1;
+        }
+        col->offsets = new_offsets;
+        col->offsets_capacity = new_cap;
+    }
+    if (inside) bytes = col->data + src_offset;
+    if (len) memcpy(col->data + used, bytes, len);
+    col->count++;
+    col->offsets[col->count] = used + len;
+    return 0;
+}
+
+int utf8_column_append(utf8_column* col, utf8_string* s){
+    return utf8_column_push(col, s->data, s->data ? s->length : 0);
+}
+
+int utf8_column_append_literal(utf8_column* col, char* s){
+    return utf8_column_push(col, (const unsigned char*)s, strlen(s));
+}
+
+//NOTE: Zero copy view of one row. Slice volatile across appends.
+utf8_slice utf8_column_get(utf8_column* col, unsigned int index){
+    utf8_slice slice = {
+        .data = NULL,
+        .length = 0,
+        .capacity = 0,
+        .hash = 0,
+        .shared = NULL,
+        .flags = 0
+    };
+    if (index >= col->count) {
+        printf("utf8_column_get : Error: Index out of bounds\n");
+        return slice;
+    }
+    slice.data = col->data + col->offsets[index];
+    slice.length = col->offsets[index + 1] - col->offsets[index];
+    return slice;
+}
+
+//NOTE: Validates the whole data buffer in one pass. A valid buffer can still
+//split a sequence across rows, so row starts are checked for continuation bytes.
+//Returns the first invalid row, -1 when every row is valid.
+int utf8_column_validate(utf8_column* col){
+    unsigned int total = col->offsets[col->count];
+    unsigned int bad = utf8_valid_prefix(col->data, total);
+    for (unsigned int i = 1; i < col->count && col->offsets[i] < bad; i++) {
+        if ((col->data[col->offsets[i]] & 0b11000000) == 0b10000000) return i - 1;
+    }
+    if (bad == total) return -1;
+    //NOTE: Row holding the first invalid byte
+    unsigned int lo = 0, hi = col->count - 1;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi + 1) / 2;
+        if (col->offsets[mid] <= bad) lo = mid;
+        else hi = mid - 1;
+    }
+    while (col->offsets[lo + 1] == col->offsets[lo]) lo++;  //NOTE: Skip empty rows sharing the offset
+    return lo;
+}
+
+void utf8_column_char_counts(utf8_column* col, unsigned int* out){
+    for (unsigned int i = 0; i < col->count; i++) {
+        out[i] = utf8_count_bytes(col->data + col->offsets[i], col->offsets[i + 1] - col->offsets[i]);
+    }
+}
+
+void utf8_column_hashes(utf8_column* col, uint64_t* out){
+    for (unsigned int i = 0; i < col->count; i++) {
+        uint64_t h = utf8_hash_bytes(col->data + col->offsets[i], col->offsets[i + 1] - col->offsets[i], 0);
+        out[i] = h ? h : 1;     //NOTE: Matches utf8_hash
+    }
+}
+
+//NOTE: First row equal to needle, -1 if none. Lengths come from the offsets,
+//so only rows of the right length touch the data buffer.
+int utf8_column_find(utf8_column* col, utf8_string* needle){
+    unsigned int len = needle->data ? needle->length : 0;
+    for (unsigned int i = 0; i < col->count; i++) {
+        if (col->offsets[i + 1] - col->offsets[i] != len) continue;
+        if (len == 0 || memcmp(col->data + col->offsets[i], needle->data, len) == 0) return i;
+    }
+    return -1;
+}
+
+void utf8_column_free(utf8_column* col){
+    free(col->data);
+    free(col->offsets);
+    col->data = NULL;
+    col->offsets = NULL;
+    col->count = 0;
+    col->capacity = 0;
+    col->offsets_capacity = 0;
+}
+
+//NOTE: Moves pos forward by `chars` codepoints, skipping ASCII runs a word at a time.
+//Returns the new byte position, or n + 1 when the string ends first.
+static unsigned int utf8_skip_chars(const unsigned char* p, unsigned int n, unsigned int pos, unsigned int chars){
+    while (chars > 0) {
+        if (pos >= n) return n + 1;
+        unsigned int run = utf8_ascii_prefix(p + pos, (n - pos < chars) ? n - pos : chars);
+        pos += run;
+        chars -= run;
+        if (chars == 0) break;
+        if (pos >= n) return n + 1;
+        pos += utf8_lead_len(p[pos]);
+        chars--;
+    }
+    return (pos > n) ? n + 1 : pos;     //NOTE: Truncated sequence at the end
+}
+
+//NOTE: Applies every edit in one left to right pass into an exactly sized buffer.
+//Edits must be sorted by `from` and must not overlap. Character positions refer
+//to the original string. Returns 0, or -1 with the string left untouched.
+int utf8_apply_edits(utf8_string* s, utf8_edit* edits, unsigned int n){
+    //NOTE: Handles Invalid Slice writes, empty views included
+    if (utf8_check_writable(s) != 0) return -1;
+    if (n == 0) return 0;
+    unsigned int* bounds = (unsigned int*)malloc(sizeof(unsigned int) * 2 * n);
+    if (!bounds) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+
+    //NOTE: Resolve all character positions to byte positions in a single walk
+    unsigned int char_pos = 0;
+    unsigned int byte_pos = 0;
+    unsigned long long new_size = s->length;
+    for (unsigned int i = 0; i < n; i++) {
+        if (edits[i].from < char_pos) {
+            fprintf(stderr, "utf8_apply_edits : Error: Edits are unsorted or overlapping\n");
+            free(bounds);
+            return -1;
+        }
+        byte_pos = utf8_skip_chars(s->data, s->length, byte_pos, edits[i].from - char_pos);
+        bounds[2 * i] = byte_pos;
+        if (byte_pos <= s->length) byte_pos = utf8_skip_chars(s->data, s->length, byte_pos, edits[i].count);
+        bounds[2 * i + 1] = byte_pos;
+        if (byte_pos > s->length) {
+            fprintf(stderr, "Out of bounds character position\n");
+            free(bounds);
+            return -1;
+        }
+        char_pos = edits[i].from + edits[i].count;
+        new_size -= bounds[2 * i + 1] - bounds[2 * i];
+        if (edits[i].replacement) new_size += edits[i].replacement->length;
+    }
+    if (new_size > 0xFFFFFFFFu) {
+        fprintf(stderr, "utf8_apply_edits : Error: Result too large\n");
+        free(bounds);
+        return -1;
+    }
+
+    unsigned char* out = (unsigned char*)malloc(new_size ? new_size : 1);
+    if (!out) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(bounds);
+        return -1;
+    }
+    //NOTE: Replacements may be slices of s, so the old buffer lives until the end
+    unsigned int w = 0;
+    unsigned int r = 0;
+    for (unsigned int i = 0; i < n; i++) {
+        if (bounds[2 * i] > r) memcpy(out + w, s->data + r, bounds[2 * i] - r);
+        w += bounds[2 * i] - r;
+        if (edits[i].replacement && edits[i].replacement->length) {
+            memcpy(out + w, edits[i].replacement->data, edits[i].replacement->length);
+            w += edits[i].replacement->length;
+        }
+        r = bounds[2 * i + 1];
+    }
+    if (s->length > r) memcpy(out + w, s->data + r, s->length - r);
+    free(bounds);
+
+    utf8_drop_buffer(s);
+    s->data = out;
+    s->length = new_size;
+    s->capacity = new_size ? new_size : 1;
+    utf8_invalidate_cache(s);
+    dbg("edited.data     -> ");
+    dbg_utf8(s);
+    dbg("\n");
+    dbg("edited.length   -> %u\n", s->length);
+    dbg("edited.capacity -> %u\n", s->capacity);
+    return 0;
+}
+
+//NOTE: Inverse of decode_utf8_char. Returns the byte count, 0 for surrogates
+//and codepoints beyond U+10FFFF.
+int encode_utf8_char(unsigned int codepoint, unsigned char* Output){
+    if (codepoint < 0x80) {
+        Output[0] = codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        Output[0] = 0b11000000 | (codepoint >> 6);
+        Output[1] = 0b10000000 | (codepoint & UTF8_Tail);
+        return 2;
+    }
+    if (codepoint >= 0xD800 && codepoint <= 0xDFFF) return 0;  //NOTE: Surrogate Pairs
+    if (codepoint < 0x10000) {
+        Output[0] = 0b11100000 | (codepoint >> 12);
+        Output[1] = 0b10000000 | ((codepoint >> 6) & UTF8_Tail);
+        Output[2] = 0b10000000 | (codepoint & UTF8_Tail);
+        return 3;
+    }
+    if (codepoint <= 0x10FFFF) {
+        Output[0] = 0b11110000 | (codepoint >> 18);
+        Output[1] = 0b10000000 | ((codepoint >> 12) & UTF8_Tail);
+        Output[2] = 0b10000000 | ((codepoint >> 6) & UTF8_Tail);
+        Output[3] = 0b10000000 | (codepoint & UTF8_Tail);
+        return 4;
+    }
+    return 0;
+}
+
+//NOTE: Byte search. memchr finds candidates for the first byte, memcmp confirms.
+//Returns the match offset, or n when there is none.
+static unsigned int utf8_find_bytes(const unsigned char* hay, unsigned int n, const unsigned char* needle, unsigned int m, unsigned int start){
+    if (m == 0 || m > n) return n;
+    unsigned int last = n - m;
+    while (start <= last) {
+        const unsigned char* hit = (const unsigned char*)memchr(hay + start, needle[0], last - start + 1);
+        if (!hit) return n;
+        unsigned int pos = hit - hay;
+        if (memcmp(hit + 1, needle + 1, m - 1) == 0) return pos;
+        start = pos + 1;
+    }
+    return n;
+}
+
+static utf8_string utf8_empty_result(void){
+    utf8_string s = {
+        .data = NULL,
+        .length = 0,
+        .capacity = 0,
+        .hash = 0,
+        .shared = NULL,
+        .flags = 0
+    };
+    return s;
+}
+
+//NOTE: Returns a new owned string with every non-overlapping needle replaced.
+//Matches are counted first, so the result is allocated once at its exact size.
+utf8_string utf8_replace_all(utf8_string* src, utf8_string* needle, utf8_string* replacement){
+    if (!src || !needle || !replacement || needle->length == 0) {
+        fprintf(stderr, "utf8_replace_all : Error: Empty needle\n");
+        return utf8_empty_result();
+    }
+    unsigned int n = src->length, m = needle->length, r = replacement->length;
+    unsigned int matches = 0;
+    for (unsigned int pos = utf8_find_bytes(src->data, n, needle->data, m, 0); pos < n;
+         pos = utf8_find_bytes(src->data, n, needle->data, m, pos + m)) matches++;
+    if (matches == 0) return to_owned(src);
+
+    unsigned long long new_size = (unsigned long long)n - (unsigned long long)matches * m + (unsigned long long)matches * r;
+    if (new_size > 0xFFFFFFFFu) {
+        fprintf(stderr, "utf8_replace_all : Error: Result too large\n");
+        return utf8_empty_result();
+    }
+    utf8_string out = utf8_empty_result();
+    out.data = (unsigned char*)malloc(new_size ? new_size : 1);
+    if (!out.data) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return out;
+    }
+    out.capacity = new_size ? new_size : 1;
+
+    //NOTE: Single streaming copy
+    unsigned int read = 0;
+    unsigned int w = 0;
+    for (unsigned int pos = utf8_find_bytes(src->data, n, needle->data, m, 0); pos < n;
+         pos = utf8_find_bytes(src->data, n, needle->data, m, pos + m)) {
+        memcpy(out.data + w, src->data + read, pos - read);
+        w += pos - read;
+        memcpy(out.data + w, replacement->data, r);
+        w += r;
+        read = pos + m;
+    }
+    memcpy(out.data + w, src->data + read, n - read);
+    out.length = new_size;
+    return out;
+}
+
+//NOTE: In place variant for replacements that are not longer than the needle.
+//The write cursor never passes the read cursor. Returns the number of
+//replacements, -1 if the replacement is longer or s is a slice.
+int utf8_replace_all_in_place(utf8_string* s, utf8_string* needle, utf8_string* replacement){
+    if (!s || !needle || !replacement || needle->length == 0 || replacement->length > needle->length) {
+        fprintf(stderr, "utf8_replace_all_in_place : Error: Replacement must not be longer than needle\n");
+        return -1;
+    }
+    //NOTE: Handles Invalid Slice writes, empty views included
+    if (utf8_check_writable(s) != 0) return -1;
+    unsigned int n = s->length, m = needle->length, r = replacement->length;
+    unsigned int pos = utf8_find_bytes(s->data, n, needle->data, m, 0);
+    if (pos < n && utf8_make_unique(s) != 0) return -1;
+    unsigned int w = pos;
+    unsigned int matches = 0;
+    while (pos < n) {
+        memmove(s->data + w, replacement->data, r);
+        w += r;
+        unsigned int read = pos + m;
+        pos = utf8_find_bytes(s->data, n, needle->data, m, read);
+        memmove(s->data + w, s->data + read, pos - read);
+        w += pos - read;
+        matches++;
+    }
+    if (matches) {
+        s->length = w;
+        utf8_invalidate_cache(s);
+    }
+    return matches;
+}
+
+//NOTE: Lookup for a codepoint map. ASCII goes through a direct table, other
+//sources through a sorted copy searched by bisection. The first mapping of a
+//repeated source wins. Built once per call, sized by n.
+typedef struct utf8_cp_pair {
+    unsigned int cp;
+    unsigned int index;
+} utf8_cp_pair;
+
+typedef struct utf8_cp_map {
+    int ascii[128];
+    utf8_cp_pair* sorted;
+    unsigned int count;
+    unsigned char (*enc)[4];
+    int* enc_len;
+} utf8_cp_map;
+
+static int utf8_cp_pair_cmp(const void* a, const void* b){
+    const utf8_cp_pair* x = (const utf8_cp_pair*)a;
+    const utf8_cp_pair* y = (const utf8_cp_pair*)b;
+    if (x->cp != y->cp) return x->cp < y->cp ? -1 : 1;
+    return x->index < y->index ? -1 : (x->index > y->index);
+}
+
+//NOTE: Index into from_cps for a codepoint, -1 when it is not mapped.
+static int utf8_map_index(const utf8_cp_map* map, unsigned int cp){
+    if (cp < 0x80) return map->ascii[cp];
+    unsigned int lo = 0, hi = map->count;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (map->sorted[mid].cp < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < map->count && map->sorted[lo].cp == cp) ? (int)map->sorted[lo].index : -1;
+}
+
+static void utf8_map_free(utf8_cp_map* map){
+    free(map->sorted);
+    free(map->enc);
+    free(map->enc_len);
+    map->sorted = NULL;
+    map->enc = NULL;
+    map->enc_len = NULL;
+}
+
+static int utf8_map_prepare(utf8_cp_map* map, const unsigned int* from_cps, const unsigned int* to_cps, unsigned int n){
+    memset(map->ascii, -1, sizeof(map->ascii));
+    map->count = 0;
+    map->sorted = (utf8_cp_pair*)malloc((n ? n : 1) * sizeof(utf8_cp_pair));
+    map->enc = (unsigned char (*)[4])malloc((n ? n : 1) * sizeof(*map->enc));
+    map->enc_len = (int*)malloc((n ? n : 1) * sizeof(int));
+    if (!map->sorted || !map->enc || !map->enc_len) {
+        fprintf(stderr, "Memory allocation failed\n");
+        utf8_map_free(map);
+        return -1;
+    }
+    for (unsigned int i = 0; i < n; i++) {
+        map->enc_len[i] = encode_utf8_char(to_cps[i], map->enc[i]);
+        if (map->enc_len[i] == 0) {
+            fprintf(stderr, "utf8_replace_codepoints : Error: Invalid target codepoint U+%04X\n", to_cps[i]);
+            utf8_map_free(map);
+            return -1;
+        }
+        if (from_cps[i] < 0x80) {
+            if (map->ascii[from_cps[i]] < 0) map->ascii[from_cps[i]] = i;
+        } else {
+            map->sorted[map->count].cp = from_cps[i];
+            map->sorted[map->count].index = i;
+            map->count++;
+        }
+    }
+    //NOTE: Ties sort by index, so the search lands on the first mapping
+    qsort(map->sorted, map->count, sizeof(utf8_cp_pair), utf8_cp_pair_cmp);
+    return 0;
+}
+
+//NOTE: Maps each codepoint in from_cps[i] to to_cps[i]. Invalid bytes are copied
+//unchanged. Sized exactly by a counting pass, then filled in one pass.
+utf8_string utf8_replace_codepoints(utf8_string* src, const unsigned int* from_cps, const unsigned int* to_cps, unsigned int n){
+    if (!src || (n && (!from_cps || !to_cps))) return utf8_empty_result();
+    utf8_cp_map map;
+    if (utf8_map_prepare(&map, from_cps, to_cps, n) != 0) return utf8_empty_result();
+
+    unsigned long long new_size = 0;
+    unsigned int cp;
+    for (unsigned int i = 0; i < src->length;) {
+        int len = utf8_next(src->data + i, src->length - i, &cp);
+        if (len < 0) {
+            new_size += -len;
+            i += -len;
+            continue;
+        }
+        int k = utf8_map_index(&map, cp);
+        new_size += (k < 0) ? len : map.enc_len[k];
+        i += len;
+    }
+    if (new_size > 0xFFFFFFFFu) {
+        fprintf(stderr, "utf8_replace_codepoints : Error: Result too large\n");
+        utf8_map_free(&map);
+        return utf8_empty_result();
+    }
+
+    utf8_string out = utf8_empty_result();
+    out.data = (unsigned char*)malloc(new_size ? new_size : 1);
+    if (!out.data) {
+        fprintf(stderr, "Memory allocation failed\n");
+        utf8_map_free(&map);
+        return out;
+    }
+    out.capacity = new_size ? new_size : 1;
+    unsigned int w = 0;
+    for (unsigned int i = 0; i < src->length;) {
+        int len = utf8_next(src->data + i, src->length - i, &cp);
+        int k = (len < 0) ? -1 : utf8_map_index(&map, cp);
+        if (len < 0) len = -len;
+        if (k < 0) {
+            memcpy(out.data + w, src->data + i, len);
+            w += len;
+        } else {
+            memcpy(out.data + w, map.enc[k], map.enc_len[k]);
+            w += map.enc_len[k];
+        }
+        i += len;
+    }
+    out.length = w;
+    utf8_map_free(&map);
+    return out;
+}
+
+//NOTE: In place variant. Every target must encode in no more bytes than its source.
+//Returns the number of replaced codepoints, -1 on error.
+int utf8_replace_codepoints_in_place(utf8_string* s, const unsigned int* from_cps, const unsigned int* to_cps, unsigned int n){
+    if (!s || (n && (!from_cps || !to_cps))) return -1;
+    //NOTE: Handles Invalid Slice writes, empty views included
+    if (utf8_check_writable(s) != 0) return -1;
+    utf8_cp_map map;
+    if (utf8_map_prepare(&map, from_cps, to_cps, n) != 0) return -1;
+    unsigned char from_enc[4];
+    for (unsigned int i = 0; i < n; i++) {
+        if (map.enc_len[i] > encode_utf8_char(from_cps[i], from_enc)) {
+            fprintf(stderr, "utf8_replace_codepoints_in_place : Error: Target longer than source\n");
+            utf8_map_free(&map);
+            return -1;
+        }
+    }
+    if (utf8_make_unique(s) != 0) {
+        utf8_map_free(&map);
+        return -1;
+    }
+
+    unsigned int w = 0;
+    unsigned int cp;
+    int replaced = 0;
+    for (unsigned int i = 0; i < s->length;) {
+        int len = utf8_next(s->data + i, s->length - i, &cp);
+        int k = (len < 0) ? -1 : utf8_map_index(&map, cp);
+        if (len < 0) len = -len;
+        if (k < 0) {
+            memmove(s->data + w, s->data + i, len);
+            w += len;
+        } else {
+            memcpy(s->data + w, map.enc[k], map.enc_len[k]);
+            w += map.enc_len[k];
+            replaced++;
+        }
+        i += len;
+    }
+    utf8_map_free(&map);
+    s->length = w;
+    if (replaced) utf8_invalidate_cache(s);
+    return replaced;
+}
+
+//NOTE: Replaces every maximal invalid subpart with U+FFFD (0xEF 0xBF 0xBD), as
+//recommended by Unicode 3.9 and the WHATWG encoding standard. The valid prefix is
+//skipped in 64-byte ASCII blocks. Works in place unless a replacement would
+//overtake unread input. Flags the result as validated.
+//Returns the number of replacements, -1 on error.
+int utf8_sanitize(utf8_string* s){
+    if (!s) return -1;
+    if (s->flags & UTF8_VALIDATED) return 0;
+    unsigned int n = s->data ? s->length : 0;
+    unsigned int first = n ? utf8_valid_prefix(s->data, n) : 0;
+    if (first == n) {
+        s->flags |= UTF8_VALIDATED;
+        return 0;
+    }
+
+    //NOTE: Counting pass. In place is safe while the write cursor never passes the read cursor.
+    long long delta = 0;
+    int in_place = 1;
+    int replaced = 0;
+    unsigned int cp;
+    for (unsigned int i = first; i < n;) {
+        int len = utf8_next(s->data + i, n - i, &cp);
+        if (len > 0) {
+            i += len;
+            continue;
+        }
+        delta += 3 + len;
+        if (delta > 0) in_place = 0;
+        replaced++;
+        i += -len;
+    }
+    if (n + delta > 0xFFFFFFFFu) {
+        fprintf(stderr, "utf8_sanitize : Error: Result too large\n");
+        return -1;
+    }
+    //NOTE: Handles Invalid Slice writes
+    if (s->capacity == 0) {
+        fprintf(stderr, "Invalid write through slice\n");
+        return -1;
+    }
+
+    unsigned char* out = s->data;
+    if (in_place) {
+        if (utf8_make_unique(s) != 0) return -1;
+        out = s->data;
+    } else {
+        out = (unsigned char*)malloc(n + delta);
+        if (!out) {
+            fprintf(stderr, "Memory allocation failed\n");
+            return -1;
+        }
+        memcpy(out, s->data, first);
+    }
+    unsigned int w = first;
+    for (unsigned int i = first; i < n;) {
+        int len = utf8_next(s->data + i, n - i, &cp);
+        if (len > 0) {
+            memmove(out + w, s->data + i, len);
+            w += len;
+            i += len;
+            continue;
+        }
+        out[w++] = 0xEF;
+        out[w++] = 0xBF;
+        out[w++] = 0xBD;
+        i += -len;
+    }
+    if (!in_place) {
+        utf8_drop_buffer(s);
+        s->data = out;
+        s->capacity = w;
+    }
+    s->length = w;
+    utf8_invalidate_cache(s);
+    s->flags |= UTF8_VALIDATED;
+    return replaced;
+}
+
+//NOTE: Binary search over a range table. Unmapped codepoints map to themselves.
+static unsigned int utf8_case_lookup(const utf8_case_range* table, unsigned int n, unsigned int cp){
+    unsigned int lo = 0, hi = n;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (table[mid].last < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < n && table[lo].first <= cp && (!table[lo].alt || ((cp - table[lo].first) & 1) == 0)) return cp + table[lo].delta;
+    return cp;
+}
+
+static const utf8_fold_special* utf8_fold_special_lookup(unsigned int cp){
+    unsigned int lo = 0, hi = sizeof(utf8_fold_special_table) / sizeof(utf8_fold_special_table[0]);
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (utf8_fold_special_table[mid].cp < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < sizeof(utf8_fold_special_table) / sizeof(utf8_fold_special_table[0]) && utf8_fold_special_table[lo].cp == cp) {
+        return &utf8_fold_special_table[lo];
+    }
+    return NULL;
+}
+
+#define UTF8_CASE_LOWER 0
+#define UTF8_CASE_UPPER 1
+#define UTF8_CASE_FOLD  2
+
+static unsigned int utf8_case_map(unsigned int cp, int mode){
+    if (mode == UTF8_CASE_UPPER) return utf8_case_lookup(utf8_upper_table, sizeof(utf8_upper_table) / sizeof(utf8_upper_table[0]), cp);
+    if (mode == UTF8_CASE_FOLD) return utf8_case_lookup(utf8_fold_table, sizeof(utf8_fold_table) / sizeof(utf8_fold_table[0]), cp);
+    return utf8_case_lookup(utf8_lower_table, sizeof(utf8_lower_table) / sizeof(utf8_lower_table[0]), cp);
+}
+
+//NOTE: Changes case of 8 ASCII bytes at once. Each byte in the A-Z (or a-z)
+//range gets its bit7 set by the two additions, which then flips 0x20.
+//No carries cross bytes because every byte is below 0x80.
+static inline uint64_t utf8_ascii_word_case(uint64_t w, int upper){
+    const uint64_t ones = 0x0101010101010101ull;
+    uint64_t first = upper ? 'a' : 'A';
+    uint64_t last = upper ? 'z' : 'Z';
+    uint64_t ge = w + (0x80 - first) * ones;
+    uint64_t gt = w + (0x80 - last - 1) * ones;
+    uint64_t mask = ge & ~gt & UTF8_HIGH_BITS;
+    return w ^ (mask >> 2);
+}
+
+static inline unsigned char utf8_ascii_byte_case(unsigned char b, int upper){
+    if (upper) return (b >= 'a' && b <= 'z') ? b - 32 : b;
+    return (b >= 'A' && b <= 'Z') ? b + 32 : b;
+}
+
+//NOTE: Converts an ASCII run, 32 bytes per step.
+static void utf8_ascii_case_run(unsigned char* dst, const unsigned char* src, unsigned int n, int upper){
+    unsigned int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint64_t w[4];
+        memcpy(w, src + i, 32);
+        for (int k = 0; k < 4; k++) w[k] = utf8_ascii_word_case(w[k], upper);
+        memcpy(dst + i, w, 32);
+    }
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w = utf8_ascii_word_case(utf8_read64(src + i), upper);
+        memcpy(dst + i, &w, 8);
+    }
+    for (; i < n; i++) dst[i] = utf8_ascii_byte_case(src[i], upper);
+}
+
+static utf8_string utf8_case_convert(utf8_string* src, int mode){
+    utf8_string out = from("");
+    if (!src || !src->data) return out;
+    unsigned int n = src->length;
+    const unsigned char* p = src->data;
+    //NOTE: Exact for ASCII, most other text changes size only slightly
+    if (utf8_reserve(&out, n) != 0) return out;
+
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        if (run) {
+            if (utf8_reserve(&out, run) != 0) return out;
+            utf8_ascii_case_run(out.data + out.length, p + i, run, mode == UTF8_CASE_UPPER);
+            out.length += run;
+            i += run;
+            continue;
+        }
+        if (utf8_reserve(&out, 12) != 0) return out;
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) {  //NOTE: Invalid bytes are copied unchanged
+            memcpy(out.data + out.length, p + i, -len);
+            out.length += -len;
+            i += -len;
+            continue;
+        }
+        i += len;
+        const utf8_fold_special* special = (mode == UTF8_CASE_FOLD) ? utf8_fold_special_lookup(cp) : NULL;
+        if (special) {
+            for (int k = 0; k < 3 && special->to[k]; k++) out.length += encode_utf8_char(special->to[k], out.data + out.length);
+        } else {
+            out.length += encode_utf8_char(utf8_case_map(cp, mode), out.data + out.length);
+        }
+    }
+    return out;
+}
+
+//NOTE: Simple (one to one) case mappings. Return a new owned string.
+utf8_string utf8_to_lower(utf8_string* src){
+    return utf8_case_convert(src, UTF8_CASE_LOWER);
+}
+
+utf8_string utf8_to_upper(utf8_string* src){
+    return utf8_case_convert(src, UTF8_CASE_UPPER);
+}
+
+//NOTE: Full case folding, for caseless matching. ß and ẞ both fold to "ss".
+utf8_string utf8_casefold(utf8_string* src){
+    return utf8_case_convert(src, UTF8_CASE_FOLD);
+}
+
+//NOTE: Yields folded codepoints one at a time, without a folded copy.
+//Invalid bytes are returned as 0x110000 + byte so they sort after every codepoint.
+typedef struct utf8_fold_iter {
+    const unsigned char* p;
+    unsigned int n;
+    unsigned int i;
+    unsigned int pending[2];
+    unsigned int pending_count;
+} utf8_fold_iter;
+
+static long utf8_fold_iter_next(utf8_fold_iter* it){
+    if (it->pending_count) {
+        unsigned int cp = it->pending[0];
+        it->pending[0] = it->pending[1];
+        it->pending_count--;
+        return cp;
+    }
+    if (it->i >= it->n) return -1;
+    unsigned char b = it->p[it->i];
+    if (b < 0x80) {
+        it->i++;
+        return utf8_ascii_byte_case(b, 0);
+    }
+    unsigned int cp;
+    int len = utf8_next(it->p + it->i, it->n - it->i, &cp);
+    if (len < 0) {
+        it->i++;
+        return 0x110000 + b;
+    }
+    it->i += len;
+    const utf8_fold_special* special = utf8_fold_special_lookup(cp);
+    if (!special) return utf8_case_map(cp, UTF8_CASE_FOLD);
+    for (int k = 1; k < 3 && special->to[k]; k++) it->pending[it->pending_count++] = special->to[k];
+    return special->to[0];
+}
+
+//NOTE: Caseless compare by full case folding, folded on the fly.
+//Matching ASCII prefixes are compared 8 bytes at a time.
+//Returns <0, 0 or >0 in folded codepoint order.
+int utf8_casecmp(utf8_string* a, utf8_string* b){
+    utf8_fold_iter x = { a->data, a->data ? a->length : 0, 0, {0, 0}, 0 };
+    utf8_fold_iter y = { b->data, b->data ? b->length : 0, 0, {0, 0}, 0 };
+    for (;;) {
+        if (!x.pending_count && !y.pending_count) {
+            while (x.i + 8 <= x.n && y.i + 8 <= y.n) {
+                uint64_t wx = utf8_read64(x.p + x.i);
+                uint64_t wy = utf8_read64(y.p + y.i);
+                if ((wx | wy) & UTF8_HIGH_BITS) break;
+                if (utf8_ascii_word_case(wx, 0) != utf8_ascii_word_case(wy, 0)) break;
+                x.i += 8;
+                y.i += 8;
+            }
+        }
+        long cx = utf8_fold_iter_next(&x);
+        long cy = utf8_fold_iter_next(&y);
+        if (cx != cy) return (cx < cy) ? -1 : 1;
+        if (cx < 0) return 0;
+    }
+}
+
+//NOTE: Hangul syllables decompose and compose arithmetically (Unicode 3.12).
+#define UTF8_HANGUL_S       0xAC00
+#define UTF8_HANGUL_L       0x1100
+#define UTF8_HANGUL_V       0x1161
+#define UTF8_HANGUL_T       0x11A7
+#define UTF8_HANGUL_L_COUNT 19
+#define UTF8_HANGUL_V_COUNT 21
+#define UTF8_HANGUL_T_COUNT 28
+#define UTF8_HANGUL_N_COUNT (UTF8_HANGUL_V_COUNT * UTF8_HANGUL_T_COUNT)
+#define UTF8_HANGUL_S_COUNT (UTF8_HANGUL_L_COUNT * UTF8_HANGUL_N_COUNT)
+
+#define UTF8_DECOMP_MAX 18      //NOTE: Longest full decomposition (U+FDFA)
+
+static const unsigned char utf8_qc_no_bits[4] = { UTF8_QC_NFC_NO, UTF8_QC_NFD_NO, UTF8_QC_NFKC_NO, UTF8_QC_NFKD_NO };
+
+static const utf8_norm_range* utf8_norm_lookup(unsigned int cp){
+    const unsigned int n = sizeof(utf8_norm_table) / sizeof(utf8_norm_table[0]);
+    if (cp < utf8_norm_table[0].first) return NULL;     //NOTE: ASCII and most of Latin-1
+    unsigned int lo = 0, hi = n;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (utf8_norm_table[mid].last < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < n && utf8_norm_table[lo].first <= cp) return &utf8_norm_table[lo];
+    return NULL;
+}
+
+static unsigned int utf8_ccc(unsigned int cp){
+    const utf8_norm_range* r = utf8_norm_lookup(cp);
+    return r ? r->ccc : 0;
+}
+
+//NOTE: Canonical entry, or for compat the compatibility entry when there is one.
+static const utf8_decomp* utf8_decomp_lookup(unsigned int cp, int compat){
+    const unsigned int n = sizeof(utf8_decomp_table) / sizeof(utf8_decomp_table[0]);
+    unsigned int lo = 0, hi = n;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (utf8_decomp_table[mid].cp < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo >= n || utf8_decomp_table[lo].cp != cp) return NULL;
+    if (compat && lo + 1 < n && utf8_decomp_table[lo + 1].cp == cp) return &utf8_decomp_table[lo + 1];
+    if (!compat && utf8_decomp_table[lo].compat) return NULL;
+    return &utf8_decomp_table[lo];
+}
+
+//NOTE: Primary composite of a pair, 0 when the pair does not compose.
+static unsigned int utf8_compose_lookup(unsigned int a, unsigned int b){
+    if (a - UTF8_HANGUL_L < UTF8_HANGUL_L_COUNT && b - UTF8_HANGUL_V < UTF8_HANGUL_V_COUNT) {
+        return UTF8_HANGUL_S + ((a - UTF8_HANGUL_L) * UTF8_HANGUL_V_COUNT + (b - UTF8_HANGUL_V)) * UTF8_HANGUL_T_COUNT;
+    }
+    if (a - UTF8_HANGUL_S < UTF8_HANGUL_S_COUNT && (a - UTF8_HANGUL_S) % UTF8_HANGUL_T_COUNT == 0
+            && b - UTF8_HANGUL_T - 1 < UTF8_HANGUL_T_COUNT - 1) {
+        return a + (b - UTF8_HANGUL_T);
+    }
+    const unsigned int n = sizeof(utf8_compose_table) / sizeof(utf8_compose_table[0]);
+    unsigned int lo = 0, hi = n;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        const utf8_compose_pair* e = &utf8_compose_table[mid];
+        if (e->first < a || (e->first == a && e->second < b)) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < n && utf8_compose_table[lo].first == a && utf8_compose_table[lo].second == b) return utf8_compose_table[lo].composite;
+    return 0;
+}
+
+//NOTE: Unicode quick check (UAX #15, section 9) in a single pass. ASCII is
+//normalized in every form and is skipped in 64-byte blocks.
+//Returns UTF8_QC_YES, UTF8_QC_NO or UTF8_QC_MAYBE. Invalid UTF-8 answers UTF8_QC_NO.
+int utf8_quick_check(utf8_string* s, int form){
+    if (!s || form < UTF8_NFC || form > UTF8_NFKD) return UTF8_QC_NO;
+    const unsigned char* p = s->data;
+    unsigned int n = p ? s->length : 0;
+    unsigned char no = utf8_qc_no_bits[form];
+    unsigned char maybe = (form == UTF8_NFC || form == UTF8_NFKC) ? UTF8_QC_NFC_MAYBE : 0;
+    int result = UTF8_QC_YES;
+    unsigned int last_ccc = 0;
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        if (run) {
+            last_ccc = 0;
+            i += run;
+            continue;
+        }
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) return UTF8_QC_NO;
+        i += len;
+        const utf8_norm_range* r = utf8_norm_lookup(cp);
+        if (!r) {
+            last_ccc = 0;
+            continue;
+        }
+        if (r->ccc && last_ccc > r->ccc) return UTF8_QC_NO;     //NOTE: Marks out of canonical order
+        if (r->qc & no) return UTF8_QC_NO;
+        if (r->qc & maybe) result = UTF8_QC_MAYBE;
+        last_ccc = r->ccc;
+    }
+    return result;
+}
+
+static int utf8_nz_reserve(utf8_normalizer* nz, unsigned int additional){
+    if (nz->count + additional <= nz->capacity) return 0;
+    unsigned int new_cap = (nz->count + additional) * 2;
+    unsigned int* grown = (unsigned int*)realloc(nz->pending, new_cap * sizeof(unsigned int));
+    if (!grown) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    nz->pending = grown;
+    nz->capacity = new_cap;
+    return 0;
+}
+
+//NOTE: Appends one codepoint. Combining marks are sorted into canonical order
+//on the way in, by a stable insertion that stops at the last starter.
+static void utf8_nz_push(utf8_normalizer* nz, unsigned int cp){
+    unsigned int ccc = utf8_ccc(cp);
+    unsigned int i = nz->count++;
+    if (ccc) {
+        while (i > 0 && utf8_ccc(nz->pending[i - 1]) > ccc) {
+            nz->pending[i] = nz->pending[i - 1];
+            i--;
+        }
+    }
+    nz->pending[i] = cp;
+}
+
+static int utf8_nz_decompose(utf8_normalizer* nz, unsigned int cp){
+    if (utf8_nz_reserve(nz, UTF8_DECOMP_MAX) != 0) return -1;
+    if (cp - UTF8_HANGUL_S < UTF8_HANGUL_S_COUNT) {
+        unsigned int index = cp - UTF8_HANGUL_S;
+        utf8_nz_push(nz, UTF8_HANGUL_L + index / UTF8_HANGUL_N_COUNT);
+        utf8_nz_push(nz, UTF8_HANGUL_V + (index % UTF8_HANGUL_N_COUNT) / UTF8_HANGUL_T_COUNT);
+        if (index % UTF8_HANGUL_T_COUNT) utf8_nz_push(nz, UTF8_HANGUL_T + index % UTF8_HANGUL_T_COUNT);
+        return 0;
+    }
+    const utf8_decomp* d = utf8_decomp_lookup(cp, nz->form >= UTF8_NFKC);
+    if (!d) {
+        utf8_nz_push(nz, cp);
+        return 0;
+    }
+    for (unsigned int k = 0; k < d->len; k++) utf8_nz_push(nz, utf8_decomp_pool[d->offset + k]);
+    return 0;
+}
+
+//NOTE: Canonical composition (Unicode 3.11) of a decomposed, ordered run.
+//A mark composes with the last starter unless a mark of the same or higher
+//class sits between them. Returns the new count.
+static unsigned int utf8_compose_run(unsigned int* c, unsigned int n){
+    if (n == 0) return 0;
+    int starter = utf8_ccc(c[0]) ? -1 : 0;
+    unsigned int last_ccc = utf8_ccc(c[0]);
+    unsigned int w = 1;
+    for (unsigned int i = 1; i < n; i++) {
+        unsigned int ccc = utf8_ccc(c[i]);
+        if (starter >= 0 && (last_ccc == 0 || last_ccc < ccc)) {
+            unsigned int composite = utf8_compose_lookup(c[starter], c[i]);
+            if (composite) {
+                c[starter] = composite;
+                continue;
+            }
+        }
+        if (ccc == 0) starter = w;
+        last_ccc = ccc;
+        c[w++] = c[i];
+    }
+    return w;
+}
+
+//NOTE: Writes the first `end` pending codepoints to out and keeps the rest.
+static int utf8_nz_flush(utf8_normalizer* nz, unsigned int end, utf8_string* out){
+    if (end == 0) return 0;
+    unsigned int n = end;
+    if (nz->form == UTF8_NFC || nz->form == UTF8_NFKC) n = utf8_compose_run(nz->pending, end);
+    if (utf8_reserve(out, n * 4) != 0) return -1;
+    for (unsigned int k = 0; k < n; k++) out->length += encode_utf8_char(nz->pending[k], out->data + out->length);
+    memmove(nz->pending, nz->pending + end, (nz->count - end) * sizeof(unsigned int));
+    nz->count -= end;
+    return 0;
+}
+
+//NOTE: A starter that passes every quick check can not reorder or compose with
+//anything before it, so all pending text is final once one arrives.
+static int utf8_nz_put(utf8_normalizer* nz, unsigned int cp, utf8_string* out){
+    const utf8_norm_range* r = utf8_norm_lookup(cp);
+    if ((!r || (r->ccc == 0 && r->qc == 0)) && utf8_nz_flush(nz, nz->count, out) != 0) return -1;
+    return utf8_nz_decompose(nz, cp);
+}
+
+int utf8_normalizer_init(utf8_normalizer* nz, int form){
+    if (!nz) return -1;
+    if (form < UTF8_NFC || form > UTF8_NFKD) {
+        fprintf(stderr, "utf8_normalizer_init : Error: Unknown form %d\n", form);
+        return -1;
+    }
+    nz->form = form;
+    nz->pending = NULL;
+    nz->count = 0;
+    nz->capacity = 0;
+    nz->partial_len = 0;
+    return 0;
+}
+
+//NOTE: Normalizes the next chunk and appends every finished part to out.
+//Chunks may split a UTF-8 sequence or a base and its marks anywhere.
+//Returns 0 on success, -1 on invalid UTF-8 or write errors.
+int utf8_normalizer_feed(utf8_normalizer* nz, utf8_string* chunk, utf8_string* out){
+    if (!nz || !chunk || !out) return -1;
+    const unsigned char* p = chunk->data;
+    unsigned int n = p ? chunk->length : 0;
+    unsigned int i = 0;
+    unsigned int cp;
+    utf8_invalidate_cache(out);
+
+    //NOTE: Completes the sequence left over from the previous chunk
+    if (nz->partial_len) {
+        unsigned char seq[4];
+        unsigned int have = nz->partial_len;
+        unsigned int need = utf8_lead_len(nz->partial[0]);
+        memcpy(seq, nz->partial, have);
+        while (have < need && i < n) seq[have++] = p[i++];
+        if (have < need) {
+            memcpy(nz->partial, seq, have);
+            nz->partial_len = have;
+            return 0;
+        }
+        if (utf8_next(seq, have, &cp) != (int)have) {
+            fprintf(stderr, "utf8_normalizer_feed : Error: Invalid UTF-8, sanitize first\n");
+            return -1;
+        }
+        nz->partial_len = 0;
+        if (utf8_nz_put(nz, cp, out) != 0) return -1;
+    }
+
+    while (i < n) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        if (run) {
+            //NOTE: ASCII is stable, only its last byte may still take a following mark
+            if (utf8_nz_flush(nz, nz->count, out) != 0) return -1;
+            if (run > 1 && utf8_append_bytes(out, p + i, run - 1) != 0) return -1;
+            if (utf8_nz_reserve(nz, 1) != 0) return -1;
+            nz->pending[nz->count++] = p[i + run - 1];
+            i += run;
+            continue;
+        }
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) {
+            if ((unsigned int)-len == n - i && utf8_lead_len(p[i]) > n - i) {
+                memcpy(nz->partial, p + i, n - i);
+                nz->partial_len = n - i;
+                return 0;
+            }
+            fprintf(stderr, "utf8_normalizer_feed : Error: Invalid UTF-8, sanitize first\n");
+            return -1;
+        }
+        i += len;
+        if (utf8_nz_put(nz, cp, out) != 0) return -1;
+    }
+    return 0;
+}
+
+//NOTE: Writes the held back tail. The normalizer can then take a new stream.
+int utf8_normalizer_finish(utf8_normalizer* nz, utf8_string* out){
+    if (!nz || !out) return -1;
+    if (nz->partial_len) {
+        fprintf(stderr, "utf8_normalizer_finish : Error: Truncated sequence\n");
+        nz->partial_len = 0;
+        nz->count = 0;
+        return -1;
+    }
+    utf8_invalidate_cache(out);
+    return utf8_nz_flush(nz, nz->count, out);
+}
+
+void utf8_normalizer_free(utf8_normalizer* nz){
+    if (!nz) return;
+    free(nz->pending);
+    nz->pending = NULL;
+    nz->count = 0;
+    nz->capacity = 0;
+    nz->partial_len = 0;
+}
+
+//NOTE: Normalizes in place. Input that is already normalized, the common case,
+//is recognized by the quick check and left untouched, nothing is copied.
+//Returns 0 when unchanged, 1 when rewritten, -1 on error.
+int utf8_normalize(utf8_string* s, int form){
+    if (!s) return -1;
+    if (form < UTF8_NFC || form > UTF8_NFKD) {
+        fprintf(stderr, "utf8_normalize : Error: Unknown form %d\n", form);
+        return -1;
+    }
+    int qc = utf8_quick_check(s, form);
+    if (qc == UTF8_QC_YES) return 0;
+    if (!utf8_validate(s)) {
+        fprintf(stderr, "utf8_normalize : Error: Invalid UTF-8, sanitize first\n");
+        return -1;
+    }
+    //NOTE: Handles Invalid Slice writes
+    if (s->capacity == 0) {
+        fprintf(stderr, "Invalid write through slice\n");
+        return -1;
+    }
+
+    utf8_string out = utf8_empty_result();
+    utf8_normalizer nz;
+    utf8_normalizer_init(&nz, form);
+    int ok = utf8_reserve(&out, s->length) == 0
+        && utf8_normalizer_feed(&nz, s, &out) == 0
+        && utf8_normalizer_finish(&nz, &out) == 0;
+    utf8_normalizer_free(&nz);
+    if (!ok) {
+        free(out.data);
+        return -1;
+    }
+    if (qc == UTF8_QC_MAYBE && out.length == s->length && memcmp(out.data, s->data, s->length) == 0) {
+        free(out.data);
+        return 0;
+    }
+    utf8_drop_buffer(s);
+    s->data = out.data;
+    s->length = out.length;
+    s->capacity = out.capacity;
+    utf8_invalidate_cache(s);
+    s->flags |= UTF8_VALIDATED;
+    return 1;
+}
+
+//NOTE: Exact answer. MAYBE from the quick check is settled by normalizing a copy.
+int utf8_is_normalized(utf8_string* s, int form){
+    int qc = utf8_quick_check(s, form);
+    if (qc != UTF8_QC_MAYBE) return qc == UTF8_QC_YES;
+    utf8_string copy = utf8_empty_result();
+    utf8_normalizer nz;
+    if (utf8_normalizer_init(&nz, form) != 0) return 0;
+    int same = utf8_normalizer_feed(&nz, s, &copy) == 0
+        && utf8_normalizer_finish(&nz, &copy) == 0
+        && copy.length == s->length
+        && memcmp(copy.data, s->data, s->length) == 0;
+    utf8_normalizer_free(&nz);
+    free(copy.data);
+    return same;
+}
+
+static unsigned int utf8_gcb(unsigned int cp){
+    if (cp - 0x20 < 0x5F) return UTF8_GCB_OTHER;     //NOTE: Printable ASCII
+    if (cp - UTF8_HANGUL_S < UTF8_HANGUL_S_COUNT) {
+        return ((cp - UTF8_HANGUL_S) % UTF8_HANGUL_T_COUNT) ? UTF8_GCB_LVT : UTF8_GCB_LV;
+    }
+    const unsigned int n = sizeof(utf8_grapheme_table) / sizeof(utf8_grapheme_table[0]);
+    unsigned int lo = 0, hi = n;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (utf8_grapheme_table[mid].last < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < n && utf8_grapheme_table[lo].first <= cp) return utf8_grapheme_table[lo].prop;
+    return UTF8_GCB_OTHER;
+}
+
+//NOTE: Decodes one codepoint and returns its length. Invalid subparts count as
+//Control, so each one stands alone as its own cluster.
+static unsigned int utf8_gcb_next(const unsigned char* p, unsigned int n, unsigned int* prop){
+    unsigned int cp;
+    int len = utf8_next(p, n, &cp);
+    if (len < 0) {
+        *prop = UTF8_GCB_CONTROL;
+        return -len;
+    }
+    *prop = utf8_gcb(cp);
+    return len;
+}
+
+//NOTE: Rules GB3 to GB13 of UAX #29 for the pair (prev, cur). pict_zwj is set
+//after ExtPict Extend* ZWJ, ri is the number of regional indicators ending at prev.
+static int utf8_grapheme_break(unsigned int prev, unsigned int cur, int pict_zwj, unsigned int ri){
+    if (prev == UTF8_GCB_CR && cur == UTF8_GCB_LF) return 0;
+    if (prev == UTF8_GCB_CR || prev == UTF8_GCB_LF || prev == UTF8_GCB_CONTROL) return 1;
+    if (cur == UTF8_GCB_CR || cur == UTF8_GCB_LF || cur == UTF8_GCB_CONTROL) return 1;
+    if (prev == UTF8_GCB_L && (cur == UTF8_GCB_L || cur == UTF8_GCB_V || cur == UTF8_GCB_LV || cur == UTF8_GCB_LVT)) return 0;
+    if ((prev == UTF8_GCB_LV || prev == UTF8_GCB_V) && (cur == UTF8_GCB_V || cur == UTF8_GCB_T)) return 0;
+    if ((prev == UTF8_GCB_LVT || prev == UTF8_GCB_T) && cur == UTF8_GCB_T) return 0;
+    if (cur == UTF8_GCB_EXTEND || cur == UTF8_GCB_ZWJ || cur == UTF8_GCB_SPACINGMARK) return 0;
+    if (prev == UTF8_GCB_PREPEND) return 0;
+    if (prev == UTF8_GCB_ZWJ && cur == UTF8_GCB_EXT_PICT && pict_zwj) return 0;
+    if (prev == UTF8_GCB_RI && cur == UTF8_GCB_RI) return ri % 2 == 0;
+    return 1;
+}
+
+//NOTE: End of the cluster that starts at pos. pos must be a cluster boundary.
+static unsigned int utf8_grapheme_end(const unsigned char* p, unsigned int n, unsigned int pos){
+    if (pos >= n) return n;
+    //NOTE: Fast path, ASCII followed by ASCII is a cluster of its own except CR LF
+    if (p[pos] < 0b10000000 && (pos + 1 == n || p[pos + 1] < 0b10000000)) {
+        return pos + 1 + (p[pos] == '\r' && pos + 1 < n && p[pos + 1] == '\n');
+    }
+    unsigned int prev, cur;
+    unsigned int i = pos + utf8_gcb_next(p + pos, n - pos, &prev);
+    int pict = (prev == UTF8_GCB_EXT_PICT);     //NOTE: 1 after ExtPict Extend*, 2 after a following ZWJ
+    unsigned int ri = (prev == UTF8_GCB_RI);
+    while (i < n) {
+        //NOTE: ASCII only joins a cluster after CR or Prepend
+        if (p[i] < 0b10000000 && prev != UTF8_GCB_CR && prev != UTF8_GCB_PREPEND) break;
+        unsigned int len = utf8_gcb_next(p + i, n - i, &cur);
+        if (utf8_grapheme_break(prev, cur, pict == 2, ri)) break;
+        if (cur == UTF8_GCB_EXT_PICT) pict = 1;
+        else if (cur == UTF8_GCB_ZWJ && pict == 1) pict = 2;
+        else if (cur != UTF8_GCB_EXTEND || pict != 1) pict = 0;
+        ri = (cur == UTF8_GCB_RI) ? ri + 1 : 0;
+        prev = cur;
+        i += len;
+    }
+    return i;
+}
+
+static unsigned int utf8_skip_graphemes(const unsigned char* p, unsigned int n, unsigned int pos, unsigned int count){
+    while (count-- && pos < n) pos = utf8_grapheme_end(p, n, pos);
+    return pos;
+}
+
+//NOTE: Extended grapheme cluster iterator (UAX #29). Returns the byte offset
+//where the cluster at byte_pos ends, which is where the next one starts:
+//  for (unsigned int i = 0, next; i < s.length; i = next) next = utf8_next_grapheme(&s, i);
+//byte_pos must be 0 or an offset returned before.
+unsigned int utf8_next_grapheme(utf8_string* src, unsigned int byte_pos){
+    if (!src || !src->data) return 0;
+    return utf8_grapheme_end(src->data, src->length, byte_pos);
+}
+
+//NOTE: Number of user-perceived characters. ASCII runs are counted a word at a
+//time, only CR LF pairs need a closer look.
+unsigned int count_graphemes(utf8_string* src){
+    if (!src || !src->data) return 0;
+    const unsigned char* p = src->data;
+    unsigned int n = src->length;
+    unsigned int count = 0;
+    unsigned int i = 0;
+    while (i < n) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        if (run > 1) {
+            //NOTE: Every byte but the last starts a cluster, the last may still take marks
+            const unsigned char* last = p + i + run - 1;
+            count += run - 1;
+            const unsigned char* cr = (const unsigned char*)memchr(p + i, '\r', run - 1);
+            while (cr) {
+                if (cr + 1 < last && cr[1] == '\n') count--;
+                cr = (cr + 1 < last) ? (const unsigned char*)memchr(cr + 1, '\r', last - cr - 1) : NULL;
+            }
+            i += run - 1;
+            if (last[-1] == '\r' && last[0] == '\n') i++;   //NOTE: LF of a CR LF already counted
+            continue;
+        }
+        i = utf8_grapheme_end(p, n, i);
+        count++;
+    }
+    return count;
+}
+
+//NOTE: Slice of grapheme clusters from..till, both inclusive like slice_byte.
+//Never separates a base from its marks or splits an emoji sequence.
+//till past the end is clipped, from past the end gives an empty slice.
+utf8_slice slice_grapheme(utf8_string* src, unsigned int from, unsigned int till){
+    utf8_slice slice = utf8_empty_result();
+    if (!src || !src->data || till < from) return slice;
+    unsigned int start = utf8_skip_graphemes(src->data, src->length, 0, from);
+    if (start >= src->length) return slice;
+    unsigned int end = utf8_skip_graphemes(src->data, src->length, start, till - from + 1);
+    slice.data = src->data + start;
+    slice.length = end - start;
+    slice.flags = src->flags & UTF8_VALIDATED;     //NOTE: Whole clusters never cut a sequence
+    return slice;
+}
+
+//NOTE: Columns taken by one codepoint, straight from the two stage bitmap.
+static inline unsigned int utf8_cp_width(unsigned int cp){
+    const unsigned char* block = utf8_width_stage2[utf8_width_stage1[cp >> 8]];
+    return (block[(cp & 0xFF) >> 2] >> ((cp & 3) * 2)) & 3;
+}
+
+//NOTE: Terminal columns needed to print s, summed per codepoint like wcswidth.
+//ASCII is one column per byte (control bytes included), so pure ASCII returns
+//the byte length after a single block scan. An invalid sequence prints as one U+FFFD.
+//Format characters (Cf) are zero width except U+00AD SOFT HYPHEN, which counts
+//one column like wcwidth because terminals show it as a hyphen.
+unsigned int utf8_display_width(utf8_string* s){
+    if (!s || !s->data) return 0;
+    const unsigned char* p = s->data;
+    unsigned int n = s->length;
+    unsigned int i = utf8_ascii_prefix(p, n);
+    unsigned int width = i;
+    unsigned int cp;
+    while (i < n) {
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) {
+            width++;
+            i += -len;
+        } else {
+            width += utf8_cp_width(cp);
+            i += len;
+        }
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        width += run;
+        i += run;
+    }
+    return width;
+}
+
+//NOTE: Cuts s to the longest prefix that fits in max_width columns and returns
+//its width. A wide character that would only half fit is dropped. Zero width
+//codepoints (combining marks, ZWJ, variation selectors) stay with their base.
+//Only the length changes, so slices can be truncated too.
+unsigned int utf8_truncate_to_width(utf8_string* s, unsigned int max_width){
+    if (!s || !s->data) return 0;
+    const unsigned char* p = s->data;
+    unsigned int n = s->length;
+    unsigned int i = 0;
+    unsigned int width = 0;
+    unsigned int cp;
+    while (i < n) {
+        unsigned int room = max_width - width;
+        unsigned int run = utf8_ascii_prefix(p + i, (n - i < room) ? n - i : room);
+        i += run;
+        width += run;
+        if (i >= n) break;
+        int len = utf8_next(p + i, n - i, &cp);
+        unsigned int w = (len < 0) ? 1 : utf8_cp_width(cp);
+        if (width + w > max_width) break;
+        width += w;
+        i += (len < 0) ? -len : len;
+    }
+    if (i < n) {
+        unsigned int validated = s->flags & UTF8_VALIDATED;    //NOTE: Cut on a codepoint boundary
+        s->length = i;
+        utf8_invalidate_cache(s);
+        s->flags = validated;
+    }
+    return width;
+}
+
+#define UTF8_ONES 0x0101010101010101ull
+
+//NOTE: High bit set in some byte of the result iff w has a byte equal to c.
+static inline uint64_t utf8_swar_eq(uint64_t w, unsigned char c){
+    uint64_t x = w ^ (UTF8_ONES * c);
+    return (x - UTF8_ONES) & ~x & UTF8_HIGH_BITS;
+}
+
+//NOTE: Bytes that stop a clean run. Escaping stops at '"', '\' and control
+//bytes, unescaping only at '\'. Non-ASCII stops both unless src is validated.
+static inline uint64_t utf8_json_special(uint64_t w, int escape, int trusted){
+    uint64_t m = utf8_swar_eq(w, '\\');
+    if (escape) m |= utf8_swar_eq(w, '"') | ((w - UTF8_ONES * 0x20) & ~w & UTF8_HIGH_BITS);
+    if (!trusted) m |= w & UTF8_HIGH_BITS;
+    return m;
+}
+
+static inline int utf8_json_special_byte(unsigned char b, int escape, int trusted){
+    if (b == '\\') return 1;
+    if (escape && (b == '"' || b < 0x20)) return 1;
+    return !trusted && b >= 0x80;
+}
+
+//NOTE: Length of the leading run that is copied unchanged. 32-byte blocks are
+//tested four words at a time, then single words, then bytes.
+static unsigned int utf8_json_clean_prefix(const unsigned char* p, unsigned int n, int escape, int trusted){
+    unsigned int i = 0;
+    while (i + 32 <= n) {
+        uint64_t m = 0;
+        for (int k = 0; k < 32; k += 8) m |= utf8_json_special(utf8_read64(p + i + k), escape, trusted);
+        if (m) break;
+        i += 32;
+    }
+    while (i + 8 <= n && !utf8_json_special(utf8_read64(p + i), escape, trusted)) i += 8;
+    while (i < n && !utf8_json_special_byte(p[i], escape, trusted)) i++;
+    return i;
+}
+
+static const char utf8_hex_digits[] = "0123456789abcdef";
+
+//NOTE: Appends src escaped for use inside a JSON string (the quotes are not
+//added). Clean runs are copied with one memcpy. Invalid UTF-8 is written as
+//U+FFFD in the same pass, so the output is always valid JSON text. src may be
+//dst itself or a view into it. Returns 0 on success, -1 on error.
+int utf8_append_json_escaped(utf8_string* dst, utf8_string* src){
+    if (!dst || !src) return -1;
+    const unsigned char* p = src->data;
+    unsigned int n = p ? src->length : 0;
+    int trusted = (src->flags & UTF8_VALIDATED) != 0;
+    //NOTE: src may point into dst, keep its offset so it survives every realloc below
+    uintptr_t base = (uintptr_t)dst->data;
+    int inside = n && base && (uintptr_t)p >= base && (uintptr_t)p < base + dst->capacity;
+    unsigned int src_offset = inside ? (unsigned int)((uintptr_t)p - base) : 0;
+    if (utf8_reserve(dst, n) != 0) return -1;   //NOTE: Exact when nothing needs escaping
+    if (inside) p = dst->data + src_offset;
+    utf8_invalidate_cache(dst);
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_json_clean_prefix(p + i, n - i, 1, trusted);
+        if (run) {
+            if (utf8_reserve(dst, run) != 0) return -1;
+            if (inside) p = dst->data + src_offset;
+            memcpy(dst->data + dst->length, p + i, run);
+            dst->length += run;
+        }
+        i += run;
+        if (i >= n) break;
+        if (utf8_reserve(dst, 6) != 0) return -1;
+        if (inside) p = dst->data + src_offset;
+        unsigned char* out = dst->data + dst->length;
+        unsigned char b = p[i];
+        if (b >= 0x80) {
+            int len = utf8_next(p + i, n - i, &cp);
+            if (len > 0) {
+                memcpy(out, p + i, len);
+                dst->length += len;
+                i += len;
+            } else {
+                memcpy(out, "\xEF\xBF\xBD", 3);
+                dst->length += 3;
+                i += -len;
+            }
+            continue;
+        }
+        out[0] = '\\';
+        switch (b) {
+        case '"':  out[1] = '"';  break;
+        case '\\': out[1] = '\\'; break;
+        case '\b': out[1] = 'b';  break;
+        case '\f': out[1] = 'f';  break;
+        case '\n': out[1] = 'n';  break;
+        case '\r': out[1] = 'r';  break;
+        case '\t': out[1] = 't';  break;
+        default:
+            memcpy(out + 1, "u00", 3);
+            out[4] = utf8_hex_digits[b >> 4];
+            out[5] = utf8_hex_digits[b & 0xF];
+            dst->length += 4;
+        }
+        dst->length += 2;
+        i++;
+    }
+    return 0;
+}
+
+//NOTE: Four hex digits, -1 when any of them is not hex.
+static int utf8_hex4(const unsigned char* p, unsigned int* out){
+    unsigned int v = 0;
+    for (int k = 0; k < 4; k++) {
+        unsigned char c = p[k];
+        if (c >= '0' && c <= '9') v = (v << 4) | (c - '0');
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') v = (v << 4) | ((c | 0x20) - 'a' + 10);
+        else return -1;
+    }
+    *out = v;
+    return 0;
+}
+
+//NOTE: Decodes one escape at p (p[0] is '\\'). Returns the bytes used, 0 when
+//malformed. Lone surrogates decode to U+FFFD.
+static unsigned int utf8_json_escape_value(const unsigned char* p, unsigned int n, unsigned int* cp){
+    if (n < 2) return 0;
+    switch (p[1]) {
+    case '"': case '\\': case '/': *cp = p[1]; return 2;
+    case 'b': *cp = '\b'; return 2;
+    case 'f': *cp = '\f'; return 2;
+    case 'n': *cp = '\n'; return 2;
+    case 'r': *cp = '\r'; return 2;
+    case 't': *cp = '\t'; return 2;
+    case 'u': break;
+    default: return 0;
+    }
+    if (n < 6 || utf8_hex4(p + 2, cp) != 0) return 0;
+    if (*cp >= 0xDC00 && *cp <= 0xDFFF) *cp = 0xFFFD;
+    if (*cp < 0xD800 || *cp > 0xDBFF) return 6;
+    unsigned int low;
+    if (n >= 12 && p[6] == '\\' && p[7] == 'u' && utf8_hex4(p + 8, &low) == 0 && low >= 0xDC00 && low <= 0xDFFF) {
+        *cp = 0x10000 + ((*cp - 0xD800) << 10) + (low - 0xDC00);
+        return 12;
+    }
+    *cp = 0xFFFD;
+    return 6;
+}
+
+//NOTE: Decodes the contents of a JSON string (without the quotes) into a new
+//owned string. \uXXXX escapes, surrogate pairs included, are encoded straight
+//into the spare capacity. Lone surrogates and invalid UTF-8 become U+FFFD.
+//Returns an empty result (data NULL) on a malformed escape.
+utf8_string utf8_json_unescape(utf8_string* src){
+    utf8_string out = utf8_empty_result();
+    if (!src || !src->data) return out;
+    const unsigned char* p = src->data;
+    unsigned int n = src->length;
+    if (utf8_reserve(&out, n) != 0) return out;     //NOTE: Escapes only shrink, U+FFFD may grow
+    int trusted = (src->flags & UTF8_VALIDATED) != 0;
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_json_clean_prefix(p + i, n - i, 0, trusted);
+        if (run && utf8_append_bytes(&out, p + i, run) != 0) return out;
+        i += run;
+        if (i >= n) break;
+        if (utf8_reserve(&out, 4) != 0) return out;
+        unsigned char* dst = out.data + out.length;
+        if (p[i] == '\\') {
+            unsigned int used = utf8_json_escape_value(p + i, n - i, &cp);
+            if (!used) {
+                fprintf(stderr, "utf8_json_unescape : Error: Invalid escape at byte %u\n", i);
+                free(out.data);
+                return utf8_empty_result();
+            }
+            out.length += encode_utf8_char(cp, dst);
+            i += used;
+            continue;
+        }
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len > 0) {
+            memcpy(dst, p + i, len);
+            out.length += len;
+            i += len;
+        } else {
+            memcpy(dst, "\xEF\xBF\xBD", 3);
+            out.length += 3;
+            i += -len;
+        }
+    }
+    out.flags = UTF8_VALIDATED;
+    return out;
+}
+
+//NOTE: Windows-1252 0x80-0x9F. The five unassigned bytes map to the C1
+//control with the same value, as in the WHATWG encoding standard.
+static const unsigned short utf8_cp1252_high[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+static inline unsigned int utf8_legacy_cp(unsigned char b, int cp1252){
+    if (cp1252 && b >= 0x80 && b < 0xA0) return utf8_cp1252_high[b - 0x80];
+    return b;
+}
+
+//NOTE: Exact UTF-8 size of a Latin-1 or CP1252 buffer. Every high byte needs
+//one more byte, found by popcount over 8 bytes at a time. CP1252 adds one
+//more for the 0x80-0x9F entries above U+07FF.
+static unsigned int utf8_legacy_size(const unsigned char* p, unsigned int n, int cp1252){
+    uint64_t size = n;
+    unsigned int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t high = utf8_read64(p + i) & UTF8_HIGH_BITS;
+        if (!high) continue;
+        size += __builtin_popcountll(high);
+        if (cp1252) {
+            for (unsigned int k = 0; k < 8; k++) size += utf8_legacy_cp(p[i + k], 1) >= 0x800;
+        }
+    }
+    for (; i < n; i++) {
+        if (p[i] >= 0x80) size += 1 + (utf8_legacy_cp(p[i], cp1252) >= 0x800);
+    }
+    return size > 0xFFFFFFFFu ? 0xFFFFFFFFu : (unsigned int)size;
+}
+
+static utf8_string utf8_from_legacy(const char* input, unsigned int len, int cp1252){
+    utf8_string out = utf8_empty_result();
+    if (!input) return out;
+    const unsigned char* p = (const unsigned char*)input;
+    unsigned int size = utf8_legacy_size(p, len, cp1252);
+    if (size == 0xFFFFFFFFu) {
+        fprintf(stderr, "utf8_from_legacy : Error: Result too large\n");
+        return out;
+    }
+    out.data = (unsigned char*)malloc(size ? size : 1);
+    if (!out.data) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return out;
+    }
+    out.capacity = size ? size : 1;
+    unsigned char* w = out.data;
+    for (unsigned int i = 0; i < len;) {
+        //NOTE: ASCII passes through in 64-byte blocks
+        unsigned int run = utf8_ascii_prefix(p + i, len - i);
+        memcpy(w, p + i, run);
+        w += run;
+        i += run;
+        if (i >= len) break;
+        unsigned int cp = utf8_legacy_cp(p[i++], cp1252);
+        if (cp < 0x800) {
+            w[0] = 0b11000000 | (cp >> 6);
+            w[1] = 0b10000000 | (cp & UTF8_Tail);
+            w += 2;
+        } else {
+            w += encode_utf8_char(cp, w);
+        }
+    }
+    out.length = w - out.data;
+    out.flags = UTF8_VALIDATED;
+    return out;
+}
+
+//NOTE: Decode ISO-8859-1 / Windows-1252 bytes into a new owned string, sized
+//exactly. len is taken explicitly since legacy data may contain NULL bytes.
+utf8_string utf8_from_latin1(const char* input, unsigned int len){
+    return utf8_from_legacy(input, len, 0);
+}
+
+utf8_string utf8_from_cp1252(const char* input, unsigned int len){
+    return utf8_from_legacy(input, len, 1);
+}
+
+//NOTE: Legacy byte for a codepoint, -1 when there is none.
+static int utf8_legacy_byte(unsigned int cp, int cp1252){
+    if (cp < 0x80 || (cp >= 0xA0 && cp <= 0xFF)) return cp;
+    if (!cp1252) return cp <= 0xFF ? (int)cp : -1;
+    for (int k = 0; k < 32; k++) {
+        if (utf8_cp1252_high[k] == cp) return 0x80 + k;
+    }
+    return -1;
+}
+
+static utf8_string utf8_to_legacy(utf8_string* src, int lossless, int cp1252){
+    utf8_string out = utf8_empty_result();
+    if (!src || !src->data) return out;
+    const unsigned char* p = src->data;
+    unsigned int n = src->length;
+    out.data = (unsigned char*)malloc(n ? n : 1);  //NOTE: Never longer than the UTF-8 input
+    if (!out.data) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return out;
+    }
+    out.capacity = n ? n : 1;
+    unsigned char* w = out.data;
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        memcpy(w, p + i, run);
+        w += run;
+        i += run;
+        if (i >= n) break;
+        int len = utf8_next(p + i, n - i, &cp);
+        int b = (len > 0) ? utf8_legacy_byte(cp, cp1252) : -1;
+        if (b < 0) {
+            if (lossless) {
+                if (len > 0) fprintf(stderr, "utf8_to_legacy : Error: U+%04X has no %s byte\n", cp, cp1252 ? "Windows-1252" : "Latin-1");
+                else fprintf(stderr, "utf8_to_legacy : Error: Invalid UTF-8 at byte %u\n", i);
+                free(out.data);
+                return utf8_empty_result();
+            }
+            b = '?';
+        }
+        *w++ = (unsigned char)b;
+        i += (len > 0) ? len : -len;
+    }
+    out.length = w - out.data;
+    return out;
+}
+
+//NOTE: Encode to ISO-8859-1 / Windows-1252. The result holds legacy bytes, not
+//UTF-8. With lossless set, any codepoint without a byte (or invalid UTF-8)
+//fails the whole conversion and returns an empty result (data NULL).
+//Otherwise such codepoints become '?'.
+utf8_string utf8_to_latin1(utf8_string* src, int lossless){
+    return utf8_to_legacy(src, lossless, 0);
+}
+
+utf8_string utf8_to_cp1252(utf8_string* src, int lossless){
+    return utf8_to_legacy(src, lossless, 1);
+}
+
+//NOTE: Bulk decoder. Writes one codepoint per character into out and returns
+//the count. out needs room for s->length entries, the worst case. ASCII runs
+//are widened in a plain loop the compiler vectorizes, invalid subparts become U+FFFD.
+unsigned int utf8_to_codepoints(utf8_string* s, unsigned int* out){
+    if (!s || !s->data || !out) return 0;
+    const unsigned char* p = s->data;
+    unsigned int n = s->length;
+    unsigned int w = 0;
+    unsigned int cp;
+    for (unsigned int i = 0; i < n;) {
+        unsigned int run = utf8_ascii_prefix(p + i, n - i);
+        for (unsigned int k = 0; k < run; k++) out[w + k] = p[i + k];
+        w += run;
+        i += run;
+        if (i >= n) break;
+        int len = utf8_next(p + i, n - i, &cp);
+        if (len < 0) {
+            out[w++] = 0xFFFD;
+            i += -len;
+        } else {
+            out[w++] = cp;
+            i += len;
+        }
+    }
+    return w;
+}
+
+//NOTE: One 64 row block of Myers' bit-vector algorithm for one text column,
+//in Hyyro's formulation. hin is the horizontal delta entering the top row,
+//the return value is the delta leaving row out_bit.
+static inline int utf8_myers_block(uint64_t* pv, uint64_t* mv, uint64_t eq, int hin, unsigned int out_bit){
+    uint64_t Pv = *pv;
+    uint64_t Mv = *mv;
+    uint64_t xv = eq | Mv;
+    if (hin < 0) eq |= 1;
+    uint64_t xh = (((eq & Pv) + Pv) ^ Pv) | eq;
+    uint64_t ph = Mv | ~(xh | Pv);
+    uint64_t mh = Pv & xh;
+    int hout = (int)((ph >> out_bit) & 1) - (int)((mh >> out_bit) & 1);
+    ph <<= 1;
+    mh <<= 1;
+    if (hin < 0) mh |= 1;
+    else if (hin > 0) ph |= 1;
+    *pv = mh | ~(xv | ph);
+    *mv = ph & xv;
+    return hout;
+}
+
+//NOTE: Pattern alphabet. ASCII is indexed directly, other codepoints go through
+//a small open addressing table. Unknown codepoints map to the all zero row.
+typedef struct utf8_peq_map {
+    int ascii[128];
+    unsigned int* keys;
+    int* values;
+    unsigned int mask;
+    unsigned int distinct;
+} utf8_peq_map;
+
+static int utf8_peq_index(utf8_peq_map* map, unsigned int cp, int insert){
+    if (cp < 128) {
+        if (map->ascii[cp] < 0 && insert) map->ascii[cp] = map->distinct++;
+        return map->ascii[cp];
+    }
+    unsigned int slot = (cp * 0x9E3779B1u) & map->mask;
+    while (map->values[slot] >= 0) {
+        if (map->keys[slot] == cp) return map->values[slot];
+        slot = (slot + 1) & map->mask;
+    }
+    if (!insert) return -1;
+    map->keys[slot] = cp;
+    map->values[slot] = map->distinct++;
+    return map->values[slot];
+}
+
+//NOTE: Levenshtein distance of pattern a (1 <= m <= n) against text b, one
+//64-bit block per 64 pattern codepoints. Gives up with k + 1 as soon as the
+//score can no longer come back down to k. Returns -1 on allocation failure.
+static long long utf8_myers_distance(const unsigned int* a, unsigned int m, const unsigned int* b, unsigned int n, unsigned int k){
+    unsigned int blocks = (m + 63) / 64;
+    unsigned int last_bit = (m - 1) % 64;
+    utf8_peq_map map;
+    memset(map.ascii, -1, sizeof(map.ascii));
+    unsigned int cap = 16;
+    while (cap < 2 * m) cap <<= 1;
+    map.mask = cap - 1;
+    map.distinct = 0;
+    map.keys = (unsigned int*)malloc(cap * sizeof(unsigned int));
+    map.values = (int*)malloc(cap * sizeof(int));
+    uint64_t* state = (uint64_t*)malloc(2 * blocks * sizeof(uint64_t));
+    uint64_t* peq = NULL;
+    long long result = -1;
+    if (!map.keys || !map.values || !state) goto done;
+    memset(map.values, -1, cap * sizeof(int));
+    for (unsigned int i = 0; i < m; i++) utf8_peq_index(&map, a[i], 1);
+
+    //NOTE: One row of block masks per distinct codepoint, plus a zero row
+    peq = (uint64_t*)calloc((size_t)(map.distinct + 1) * blocks, sizeof(uint64_t));
+    if (!peq) goto done;
+    for (unsigned int i = 0; i < m; i++) {
+        peq[(size_t)utf8_peq_index(&map, a[i], 0) * blocks + i / 64] |= 1ull << (i % 64);
+    }
+
+    uint64_t* pv = state;
+    uint64_t* mv = state + blocks;
+    for (unsigned int blk = 0; blk < blocks; blk++) {
+        pv[blk] = ~0ull;
+        mv[blk] = 0;
+    }
+    unsigned long long score = m;
+    for (unsigned int j = 0; j < n; j++) {
+        int index = utf8_peq_index(&map, b[j], 0);
+        const uint64_t* eq = peq + (size_t)(index < 0 ? map.distinct : (unsigned int)index) * blocks;
+        int carry = 1;     //NOTE: Row 0 grows by one per column
+        for (unsigned int blk = 0; blk + 1 < blocks; blk++) carry = utf8_myers_block(&pv[blk], &mv[blk], eq[blk], carry, 63);
+        score += utf8_myers_block(&pv[blocks - 1], &mv[blocks - 1], eq[blocks - 1], carry, last_bit);
+        //NOTE: Each remaining column lowers the score by at most one
+        if (score > k && score - k > n - j - 1) {
+            score = (unsigned long long)k + 1;
+            break;
+        }
+    }
+    result = score;
+
+done:
+    if (result < 0) fprintf(stderr, "Memory allocation failed\n");
+    free(map.keys);
+    free(map.values);
+    free(state);
+    free(peq);
+    return result;
+}
+
+static long long utf8_distance(utf8_string* a, utf8_string* b, unsigned int k){
+    const unsigned char* pa = (a && a->data) ? a->data : (const unsigned char*)"";
+    const unsigned char* pb = (b && b->data) ? b->data : (const unsigned char*)"";
+    unsigned int la = (a && a->data) ? a->length : 0;
+    unsigned int lb = (b && b->data) ? b->length : 0;
+
+    //NOTE: Common prefix and suffix cost nothing, trim them on bytes first
+    unsigned int pre = 0;
+    while (pre < la && pre < lb && pa[pre] == pb[pre]) pre++;
+    while (pre > 0 && pre < la && (pa[pre] & 0b11000000) == 0b10000000) pre--;
+    while (pre > 0 && pre < lb && (pb[pre] & 0b11000000) == 0b10000000) pre--;
+    unsigned int suf = 0;
+    while (suf < la - pre && suf < lb - pre && pa[la - 1 - suf] == pb[lb - 1 - suf]) suf++;
+    while (suf > 0 && (pa[la - suf] & 0b11000000) == 0b10000000) suf--;
+    pa += pre;
+    pb += pre;
+    la -= pre + suf;
+    lb -= pre + suf;
+
+    //NOTE: The length difference is a lower bound, checked before decoding
+    unsigned int ca = utf8_count_bytes(pa, la);
+    unsigned int cb = utf8_count_bytes(pb, lb);
+    unsigned int diff = ca > cb ? ca - cb : cb - ca;
+    if (diff > k) return (long long)k + 1;
+
+    unsigned int* cps = (unsigned int*)malloc(((size_t)la + lb + 1) * sizeof(unsigned int));
+    if (!cps) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return -1;
+    }
+    utf8_string sa = { .data = (unsigned char*)pa, .length = la, .capacity = 0, .hash = 0, .shared = NULL, .flags = 0 };
+    utf8_string sb = { .data = (unsigned char*)pb, .length = lb, .capacity = 0, .hash = 0, .shared = NULL, .flags = 0 };
+    unsigned int m = utf8_to_codepoints(&sa, cps);
+    unsigned int n = utf8_to_codepoints(&sb, cps + m);
+    long long result;
+    if (m == 0 || n == 0) {
+        result = m + n;
+        if (result > k) result = (long long)k + 1;
+    } else if (m <= n) {
+        result = utf8_myers_distance(cps, m, cps + m, n, k);
+    } else {
+        result = utf8_myers_distance(cps + m, n, cps, m, k);
+    }
+    free(cps);
+    return result;
+}
+
+//NOTE: Levenshtein distance in codepoints (insert, delete and substitute all
+//cost 1). Bit-parallel, about m/64 word operations per text codepoint, where
+//m is the shorter length. Returns -1 on allocation failure.
+long long utf8_edit_distance(utf8_string* a, utf8_string* b){
+    return utf8_distance(a, b, 0xFFFFFFFFu);
+}
+
+//NOTE: Fuzzy match. Returns the distance when it is at most k, otherwise k + 1,
+//which is found early from the length difference or once the running score
+//can not come back down.
+long long utf8_edit_distance_bounded(utf8_string* a, utf8_string* b, unsigned int k){
+    return utf8_distance(a, b, k);
+}
+
+//NOTE: 1 when both hold the same bytes. Lengths are compared first, then cached
+//hashes when both are known, and only then memcmp (vectorized by libc).
+int utf8_eq(utf8_string* a, utf8_string* b){
+    if (a->length != b->length) return 0;
+    if (a->hash && b->hash && a->hash != b->hash) return 0;
+    if (a->length == 0 || a->data == b->data) return 1;
+    return memcmp(a->data, b->data, a->length) == 0;
+}
+
+//NOTE: Byte order, which for valid UTF-8 is also codepoint order.
+//Returns <0, 0 or >0. A proper prefix sorts first.
+int utf8_cmp(utf8_string* a, utf8_string* b){
+    unsigned int n = a->length < b->length ? a->length : b->length;
+    int c = n ? memcmp(a->data, b->data, n) : 0;
+    if (c) return c;
+    return (a->length > b->length) - (a->length < b->length);
+}
+
+//NOTE: Sort entries carry the bytes at the current 8-byte window as a big-endian
+//key, so most comparisons and bucket picks never touch the string data.
+typedef struct utf8_sort_entry {
+    uint64_t key;
+    const unsigned char* data;
+    unsigned int length;
+    unsigned int index;
+} utf8_sort_entry;
+
+#define UTF8_SORT_SMALL 32      //NOTE: Below this, insertion sort beats another radix pass
+
+static inline uint64_t utf8_sort_key(const unsigned char* p, unsigned int len, unsigned int window){
+    if (window + 8 <= len) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        return __builtin_bswap64(utf8_read64(p + window));
+#else
+        return utf8_read64(p + window);
+#endif
+    }
+    uint64_t key = 0;
+    for (unsigned int i = window; i < len; i++) key |= (uint64_t)p[i] << (56 - 8 * (i - window));
+    return key;
+}
+
+//NOTE: Bucket 0 is for strings that end before depth, byte b goes to b + 1.
+static inline unsigned int utf8_sort_bucket(const utf8_sort_entry* e, unsigned int depth){
+    if (depth >= e->length) return 0;
+    return 1 + (unsigned int)((e->key >> (56 - 8 * (depth % 8))) & 0xFF);
+}
+
+//NOTE: Compares two entries that agree on every byte before window.
+static int utf8_sort_less(const utf8_sort_entry* a, const utf8_sort_entry* b, unsigned int window){
+    if (a->key != b->key) return a->key < b->key;
+    unsigned int n = a->length < b->length ? a->length : b->length;
+    if (n > window) {
+        int c = memcmp(a->data + window, b->data + window, n - window);
+        if (c) return c < 0;
+    }
+    return a->length < b->length;
+}
+
+static void utf8_sort_insertion(utf8_sort_entry* a, unsigned int n, unsigned int window){
+    for (unsigned int i = 1; i < n; i++) {
+        utf8_sort_entry e = a[i];
+        unsigned int j = i;
+        while (j > 0 && utf8_sort_less(&e, &a[j - 1], window)) {
+            a[j] = a[j - 1];
+            j--;
+        }
+        a[j] = e;
+    }
+}
+
+//NOTE: One MSD pass on the byte at depth. Returns the bucket bounds in start
+//(258 entries), and 0 when everything fell in one bucket.
+static int utf8_sort_distribute(utf8_sort_entry* a, utf8_sort_entry* tmp, unsigned int n, unsigned int depth, unsigned int* start){
+    unsigned int count[257] = {0};
+    for (unsigned int i = 0; i < n; i++) count[utf8_sort_bucket(&a[i], depth)]++;
+    start[0] = 0;
+    for (unsigned int b = 0; b < 257; b++) start[b + 1] = start[b] + count[b];
+    for (unsigned int b = 0; b < 257; b++) {
+        if (count[b] == n) return 0;
+    }
+    unsigned int next[257];
+    memcpy(next, start, sizeof(next));
+    for (unsigned int i = 0; i < n; i++) tmp[next[utf8_sort_bucket(&a[i], depth)]++] = a[i];
+    memcpy(a, tmp, n * sizeof(utf8_sort_entry));
+    return 1;
+}
+
+static void utf8_sort_reload(utf8_sort_entry* a, unsigned int n, unsigned int window){
+    for (unsigned int i = 0; i < n; i++) a[i].key = utf8_sort_key(a[i].data, a[i].length, window);
+}
+
+static void utf8_msd_sort(utf8_sort_entry* a, utf8_sort_entry* tmp, unsigned int n, unsigned int depth){
+    unsigned int start[258];
+    for (;;) {
+        if (n < UTF8_SORT_SMALL) {
+            utf8_sort_insertion(a, n, depth - depth % 8);
+            return;
+        }
+        if (utf8_sort_distribute(a, tmp, n, depth, start)) break;
+        //NOTE: Shared prefix byte, go one deeper without recursing
+        if (start[1] == n) return;      //NOTE: All strings ended, all equal
+        depth++;
+        if (depth % 8 == 0) utf8_sort_reload(a, n, depth);
+    }
+    for (unsigned int b = 1; b < 257; b++) {
+        unsigned int size = start[b + 1] - start[b];
+        if (size < 2) continue;
+        if ((depth + 1) % 8 == 0) utf8_sort_reload(a + start[b], size, depth + 1);
+        utf8_msd_sort(a + start[b], tmp + start[b], size, depth + 1);
+    }
+}
+
+//NOTE: Worker for the parallel sort. Buckets of the first pass are independent,
+//threads take the next unsorted one from a shared counter.
+typedef struct utf8_sort_job {
+    utf8_sort_entry* entries;
+    utf8_sort_entry* tmp;
+    unsigned int* start;
+    unsigned int depth;
+    atomic_uint next_bucket;
+} utf8_sort_job;
+
+static void* utf8_sort_worker(void* arg){
+    utf8_sort_job* job = (utf8_sort_job*)arg;
+    for (;;) {
+        unsigned int b = atomic_fetch_add(&job->next_bucket, 1);
+        if (b >= 257) return NULL;
+        if (b == 0) continue;   //NOTE: Ended strings are already in place
+        unsigned int size = job->start[b + 1] - job->start[b];
+        if (size < 2) continue;
+        utf8_sort_entry* a = job->entries + job->start[b];
+        if ((job->depth + 1) % 8 == 0) utf8_sort_reload(a, size, job->depth + 1);
+        utf8_msd_sort(a, job->tmp + job->start[b], size, job->depth + 1);
+    }
+}
+
+//NOTE: Stable sort of an array of strings or slices into byte (codepoint)
+//order, in place. MSD radix sort over cached 8-byte prefix keys, small buckets
+//finish with insertion sort. With threads > 1 the buckets of the first
+//differing byte are sorted in parallel. Returns 0 on success, -1 on allocation failure.
+int utf8_sort(utf8_string* items, unsigned int count, unsigned int threads){
+    if (!items || count < 2) return 0;
+    utf8_sort_entry* entries = (utf8_sort_entry*)malloc((size_t)count * sizeof(utf8_sort_entry));
+    utf8_sort_entry* tmp = (utf8_sort_entry*)malloc((size_t)count * sizeof(utf8_sort_entry));
+    utf8_string* sorted = (utf8_string*)malloc((size_t)count * sizeof(utf8_string));
+    if (!entries || !tmp || !sorted) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(entries);
+        free(tmp);
+        free(sorted);
+        return -1;
+    }
+    for (unsigned int i = 0; i < count; i++) {
+        entries[i].data = items[i].data;
+        entries[i].length = items[i].data ? items[i].length : 0;
+        entries[i].index = i;
+        entries[i].key = utf8_sort_key(entries[i].data, entries[i].length, 0);
+    }
+
+    if (threads > 1 && count >= threads * UTF8_SORT_SMALL) {
+        //NOTE: Split at the first byte where the strings differ, a shared prefix
+        //would otherwise leave one bucket holding everything
+        unsigned int start[258];
+        unsigned int depth = 0;
+        int split;
+        while (!(split = utf8_sort_distribute(entries, tmp, count, depth, start)) && start[1] != count) {
+            depth++;
+            if (depth % 8 == 0) utf8_sort_reload(entries, count, depth);
+        }
+        utf8_sort_job job = { .entries = entries, .tmp = tmp, .start = start, .depth = depth };
+        atomic_init(&job.next_bucket, split ? 0 : 257);     //NOTE: All equal, nothing to do
+        pthread_t* workers = (pthread_t*)malloc((threads - 1) * sizeof(pthread_t));
+        unsigned int started = 0;
+        if (workers) {
+            while (started < threads - 1 && pthread_create(&workers[started], NULL, utf8_sort_worker, &job) == 0) started++;
+        }
+        utf8_sort_worker(&job);     //NOTE: The caller works too, and finishes alone if no thread started
+        for (unsigned int t = 0; t < started; t++) pthread_join(workers[t], NULL);
+        free(workers);
+    } else {
+        utf8_msd_sort(entries, tmp, count, 0);
+    }
+
+    for (unsigned int i = 0; i < count; i++) sorted[i] = items[entries[i].index];
+    memcpy(items, sorted, (size_t)count * sizeof(utf8_string));
+    free(entries);
+    free(tmp);
+    free(sorted);
+    return 0;
+}
 /*
 int main() {
     utf8_string pera_1 = from("ٱلسَّلَامُ عَلَيْكُمْ\n");
@@ -0,0 +1,3918 @@
+//NOTE: Unicode property tables for utf8_string.c.
+//Generated from the Unicode Character Database 14.0.0 (UnicodeData.txt,
+//SpecialCasing.txt, CaseFolding.txt, CompositionExclusions.txt,
+//DerivedNormalizationProps.txt, GraphemeBreakProperty.txt, emoji-data.txt and
+//EastAsianWidth.txt) by tools/gen_unicode_tables.py.
+//Do not edit the data by hand.
+
+#ifndef UTF8_UNICODE_TABLES_H
+#define UTF8_UNICODE_TABLES_H
+
+//NOTE: Case mapping. Codepoints first..last map to codepoint + delta.
+//alt = 1 means only every other codepoint (same parity as first) is mapped,
+//which covers the upper/lower pairs of Latin Extended, Cyrillic, etc.
+typedef struct utf8_case_range {
+    unsigned int first;
+    unsigned int last;
+    int delta;
+    unsigned char alt;
+} utf8_case_range;
+
+//NOTE: Full case folds that expand to more than one codepoint (ß -> ss).
+typedef struct utf8_fold_special {
+    unsigned int cp;
+    unsigned int to[3];     //NOTE: 0 terminated when shorter than 3
+} utf8_fold_special;
+
+//NOTE: Simple lowercase mapping (U+0130 uses the first codepoint of its full mapping).
+static const utf8_case_range utf8_lower_table[] = {
+    {0x41, 0x5A, 32, 0}, {0xC0, 0xD6, 32, 0}, {0xD8, 0xDE, 32, 0}, {0x100, 0x12E, 1, 1},
+    {0x130, 0x130, -199, 0}, {0x132, 0x136, 1, 1}, {0x139, 0x147, 1, 1}, {0x14A, 0x176, 1, 1},
+    {0x178, 0x178, -121, 0}, {0x179, 0x17D, 1, 1}, {0x181, 0x181, 210, 0}, {0x182, 0x184, 1, 1},
+    {0x186, 0x186, 206, 0}, {0x187, 0x187, 1, 0}, {0x189, 0x18A, 205, 0}, {0x18B, 0x18B, 1, 0},
+    {0x18E, 0x18E, 79, 0}, {0x18F, 0x18F, 202, 0}, {0x190, 0x190, 203, 0}, {0x191, 0x191, 1, 0},
+    {0x193, 0x193, 205, 0}, {0x194, 0x194, 207, 0}, {0x196, 0x196, 211, 0}, {0x197, 0x197, 209, 0},
+    {0x198, 0x198, 1, 0}, {0x19C, 0x19C, 211, 0}, {0x19D, 0x19D, 213, 0}, {0x19F, 0x19F, 214, 0},
+    {0x1A0, 0x1A4, 1, 1}, {0x1A6, 0x1A6, 218, 0}, {0x1A7, 0x1A7, 1, 0}, {0x1A9, 0x1A9, 218, 0},
+    {0x1AC, 0x1AC, 1, 0}, {0x1AE, 0x1AE, 218, 0}, {0x1AF, 0x1AF, 1, 0}, {0x1B1, 0x1B2, 217, 0},
+    {0x1B3, 0x1B5, 1, 1}, {0x1B7, 0x1B7, 219, 0}, {0x1B8, 0x1B8, 1, 0}, {0x1BC, 0x1BC, 1, 0},
+    {0x1C4, 0x1C4, 2, 0}, {0x1C5, 0x1C5, 1, 0}, {0x1C7, 0x1C7, 2, 0}, {0x1C8, 0x1C8, 1, 0},
+    {0x1CA, 0x1CA, 2, 0}, {0x1CB, 0x1DB, 1, 1}, {0x1DE, 0x1EE, 1, 1}, {0x1F1, 0x1F1, 2, 0},
+    {0x1F2, 0x1F4, 1, 1}, {0x1F6, 0x1F6, -97, 0}, {0x1F7, 0x1F7, -56, 0}, {0x1F8, 0x21E, 1, 1},
+    {0x220, 0x220, -130, 0}, {0x222, 0x232, 1, 1}, {0x23A, 0x23A, 10795, 0}, {0x23B, 0x23B, 1, 0},
+    {0x23D, 0x23D, -163, 0}, {0x23E, 0x23E, 10792, 0}, {0x241, 0x241, 1, 0}, {0x243, 0x243, -195, 0},
+    {0x244, 0x244, 69, 0}, {0x245, 0x245, 71, 0}, {0x246, 0x24E, 1, 1}, {0x370, 0x372, 1, 1},
+    {0x376, 0x376, 1, 0}, {0x37F, 0x37F, 116, 0}, {0x386, 0x386, 38, 0}, {0x388, 0x38A, 37, 0},
+    {0x38C, 0x38C, 64, 0}, {0x38E, 0x38F, 63, 0}, {0x391, 0x3A1, 32, 0}, {0x3A3, 0x3AB, 32, 0},
+    {0x3CF, 0x3CF, 8, 0}, {0x3D8, 0x3EE, 1, 1}, {0x3F4, 0x3F4, -60, 0}, {0x3F7, 0x3F7, 1, 0},
+    {0x3F9, 0x3F9, -7, 0}, {0x3FA, 0x3FA, 1, 0}, {0x3FD, 0x3FF, -130, 0}, {0x400, 0x40F, 80, 0},
+    {0x410, 0x42F, 32, 0}, {0x460, 0x480, 1, 1}, {0x48A, 0x4BE, 1, 1}, {0x4C0, 0x4C0, 15, 0},
+    {0x4C1, 0x4CD, 1, 1}, {0x4D0, 0x52E, 1, 1}, {0x531, 0x556, 48, 0}, {0x10A0, 0x10C5, 7264, 0},
+    {0x10C7, 0x10C7, 7264, 0}, {0x10CD, 0x10CD, 7264, 0}, {0x13A0, 0x13EF, 38864, 0},
+    {0x13F0, 0x13F5, 8, 0}, {0x1C90, 0x1CBA, -3008, 0}, {0x1CBD, 0x1CBF, -3008, 0},
+    {0x1E00, 0x1E94, 1, 1}, {0x1E9E, 0x1E9E, -7615, 0}, {0x1EA0, 0x1EFE, 1, 1}, {0x1F08, 0x1F0F, -8, 0},
+    {0x1F18, 0x1F1D, -8, 0}, {0x1F28, 0x1F2F, -8, 0}, {0x1F38, 0x1F3F, -8, 0}, {0x1F48, 0x1F4D, -8, 0},
+    {0x1F59, 0x1F5F, -8, 1}, {0x1F68, 0x1F6F, -8, 0}, {0x1F88, 0x1F8F, -8, 0}, {0x1F98, 0x1F9F, -8, 0},
+    {0x1FA8, 0x1FAF, -8, 0}, {0x1FB8, 0x1FB9, -8, 0}, {0x1FBA, 0x1FBB, -74, 0}, {0x1FBC, 0x1FBC, -9, 0},
+    {0x1FC8, 0x1FCB, -86, 0}, {0x1FCC, 0x1FCC, -9, 0}, {0x1FD8, 0x1FD9, -8, 0},
+    {0x1FDA, 0x1FDB, -100, 0}, {0x1FE8, 0x1FE9, -8, 0}, {0x1FEA, 0x1FEB, -112, 0},
+    {0x1FEC, 0x1FEC, -7, 0}, {0x1FF8, 0x1FF9, -128, 0}, {0x1FFA, 0x1FFB, -126, 0},
+    {0x1FFC, 0x1FFC, -9, 0}, {0x2126, 0x2126, -7517, 0}, {0x212A, 0x212A, -8383, 0},
+    {0x212B, 0x212B, -8262, 0}, {0x2132, 0x2132, 28, 0}, {0x2160, 0x216F, 16, 0},
+    {0x2183, 0x2183, 1, 0}, {0x24B6, 0x24CF, 26, 0}, {0x2C00, 0x2C2F, 48, 0}, {0x2C60, 0x2C60, 1, 0},
+    {0x2C62, 0x2C62, -10743, 0}, {0x2C63, 0x2C63, -3814, 0}, {0x2C64, 0x2C64, -10727, 0},
+    {0x2C67, 0x2C6B, 1, 1}, {0x2C6D, 0x2C6D, -10780, 0}, {0x2C6E, 0x2C6E, -10749, 0},
+    {0x2C6F, 0x2C6F, -10783, 0}, {0x2C70, 0x2C70, -10782, 0}, {0x2C72, 0x2C72, 1, 0},
+    {0x2C75, 0x2C75, 1, 0}, {0x2C7E, 0x2C7F, -10815, 0}, {0x2C80, 0x2CE2, 1, 1}, {0x2CEB, 0x2CED, 1, 1},
+    {0x2CF2, 0x2CF2, 1, 0}, {0xA640, 0xA66C, 1, 1}, {0xA680, 0xA69A, 1, 1}, {0xA722, 0xA72E, 1, 1},
+    {0xA732, 0xA76E, 1, 1}, {0xA779, 0xA77B, 1, 1}, {0xA77D, 0xA77D, -35332, 0}, {0xA77E, 0xA786, 1, 1},
+    {0xA78B, 0xA78B, 1, 0}, {0xA78D, 0xA78D, -42280, 0}, {0xA790, 0xA792, 1, 1}, {0xA796, 0xA7A8, 1, 1},
+    {0xA7AA, 0xA7AA, -42308, 0}, {0xA7AB, 0xA7AB, -42319, 0}, {0xA7AC, 0xA7AC, -42315, 0},
+    {0xA7AD, 0xA7AD, -42305, 0}, {0xA7AE, 0xA7AE, -42308, 0}, {0xA7B0, 0xA7B0, -42258, 0},
+    {0xA7B1, 0xA7B1, -42282, 0}, {0xA7B2, 0xA7B2, -42261, 0}, {0xA7B3, 0xA7B3, 928, 0},
+    {0xA7B4, 0xA7C2, 1, 1}, {0xA7C4, 0xA7C4, -48, 0}, {0xA7C5, 0xA7C5, -42307, 0},
+    {0xA7C6, 0xA7C6, -35384, 0}, {0xA7C7, 0xA7C9, 1, 1}, {0xA7D0, 0xA7D0, 1, 0}, {0xA7D6, 0xA7D8, 1, 1},
+    {0xA7F5, 0xA7F5, 1, 0}, {0xFF21, 0xFF3A, 32, 0}, {0x10400, 0x10427, 40, 0},
+    {0x104B0, 0x104D3, 40, 0}, {0x10570, 0x1057A, 39, 0}, {0x1057C, 0x1058A, 39, 0},
+    {0x1058C, 0x10592, 39, 0}, {0x10594, 0x10595, 39, 0}, {0x10C80, 0x10CB2, 64, 0},
+    {0x118A0, 0x118BF, 32, 0}, {0x16E40, 0x16E5F, 32, 0}, {0x1E900, 0x1E921, 34, 0},
+};
+
+//NOTE: Simple uppercase mapping. Characters whose uppercase is longer than one
+//codepoint use their single codepoint titlecase form when it exists.
+static const utf8_case_range utf8_upper_table[] = {
+    {0x61, 0x7A, -32, 0}, {0xB5, 0xB5, 743, 0}, {0xE0, 0xF6, -32, 0}, {0xF8, 0xFE, -32, 0},
+    {0xFF, 0xFF, 121, 0}, {0x101, 0x12F, -1, 1}, {0x131, 0x131, -232, 0}, {0x133, 0x137, -1, 1},
+    {0x13A, 0x148, -1, 1}, {0x14B, 0x177, -1, 1}, {0x17A, 0x17E, -1, 1}, {0x17F, 0x17F, -300, 0},
+    {0x180, 0x180, 195, 0}, {0x183, 0x185, -1, 1}, {0x188, 0x188, -1, 0}, {0x18C, 0x18C, -1, 0},
+    {0x192, 0x192, -1, 0}, {0x195, 0x195, 97, 0}, {0x199, 0x199, -1, 0}, {0x19A, 0x19A, 163, 0},
+    {0x19E, 0x19E, 130, 0}, {0x1A1, 0x1A5, -1, 1}, {0x1A8, 0x1A8, -1, 0}, {0x1AD, 0x1AD, -1, 0},
+    {0x1B0, 0x1B0, -1, 0}, {0x1B4, 0x1B6, -1, 1}, {0x1B9, 0x1B9, -1, 0}, {0x1BD, 0x1BD, -1, 0},
+    {0x1BF, 0x1BF, 56, 0}, {0x1C5, 0x1C5, -1, 0}, {0x1C6, 0x1C6, -2, 0}, {0x1C8, 0x1C8, -1, 0},
+    {0x1C9, 0x1C9, -2, 0}, {0x1CB, 0x1CB, -1, 0}, {0x1CC, 0x1CC, -2, 0}, {0x1CE, 0x1DC, -1, 1},
+    {0x1DD, 0x1DD, -79, 0}, {0x1DF, 0x1EF, -1, 1}, {0x1F2, 0x1F2, -1, 0}, {0x1F3, 0x1F3, -2, 0},
+    {0x1F5, 0x1F5, -1, 0}, {0x1F9, 0x21F, -1, 1}, {0x223, 0x233, -1, 1}, {0x23C, 0x23C, -1, 0},
+    {0x23F, 0x240, 10815, 0}, {0x242, 0x242, -1, 0}, {0x247, 0x24F, -1, 1}, {0x250, 0x250, 10783, 0},
+    {0x251, 0x251, 10780, 0}, {0x252, 0x252, 10782, 0}, {0x253, 0x253, -210, 0},
+    {0x254, 0x254, -206, 0}, {0x256, 0x257, -205, 0}, {0x259, 0x259, -202, 0}, {0x25B, 0x25B, -203, 0},
+    {0x25C, 0x25C, 42319, 0}, {0x260, 0x260, -205, 0}, {0x261, 0x261, 42315, 0},
+    {0x263, 0x263, -207, 0}, {0x265, 0x265, 42280, 0}, {0x266, 0x266, 42308, 0},
+    {0x268, 0x268, -209, 0}, {0x269, 0x269, -211, 0}, {0x26A, 0x26A, 42308, 0},
+    {0x26B, 0x26B, 10743, 0}, {0x26C, 0x26C, 42305, 0}, {0x26F, 0x26F, -211, 0},
+    {0x271, 0x271, 10749, 0}, {0x272, 0x272, -213, 0}, {0x275, 0x275, -214, 0},
+    {0x27D, 0x27D, 10727, 0}, {0x280, 0x280, -218, 0}, {0x282, 0x282, 42307, 0},
+    {0x283, 0x283, -218, 0}, {0x287, 0x287, 42282, 0}, {0x288, 0x288, -218, 0}, {0x289, 0x289, -69, 0},
+    {0x28A, 0x28B, -217, 0}, {0x28C, 0x28C, -71, 0}, {0x292, 0x292, -219, 0}, {0x29D, 0x29D, 42261, 0},
+    {0x29E, 0x29E, 42258, 0}, {0x345, 0x345, 84, 0}, {0x371, 0x373, -1, 1}, {0x377, 0x377, -1, 0},
+    {0x37B, 0x37D, 130, 0}, {0x3AC, 0x3AC, -38, 0}, {0x3AD, 0x3AF, -37, 0}, {0x3B1, 0x3C1, -32, 0},
+    {0x3C2, 0x3C2, -31, 0}, {0x3C3, 0x3CB, -32, 0}, {0x3CC, 0x3CC, -64, 0}, {0x3CD, 0x3CE, -63, 0},
+    {0x3D0, 0x3D0, -62, 0}, {0x3D1, 0x3D1, -57, 0}, {0x3D5, 0x3D5, -47, 0}, {0x3D6, 0x3D6, -54, 0},
+    {0x3D7, 0x3D7, -8, 0}, {0x3D9, 0x3EF, -1, 1}, {0x3F0, 0x3F0, -86, 0}, {0x3F1, 0x3F1, -80, 0},
+    {0x3F2, 0x3F2, 7, 0}, {0x3F3, 0x3F3, -116, 0}, {0x3F5, 0x3F5, -96, 0}, {0x3F8, 0x3F8, -1, 0},
+    {0x3FB, 0x3FB, -1, 0}, {0x430, 0x44F, -32, 0}, {0x450, 0x45F, -80, 0}, {0x461, 0x481, -1, 1},
+    {0x48B, 0x4BF, -1, 1}, {0x4C2, 0x4CE, -1, 1}, {0x4CF, 0x4CF, -15, 0}, {0x4D1, 0x52F, -1, 1},
+    {0x561, 0x586, -48, 0}, {0x10D0, 0x10FA, 3008, 0}, {0x10FD, 0x10FF, 3008, 0},
+    {0x13F8, 0x13FD, -8, 0}, {0x1C80, 0x1C80, -6254, 0}, {0x1C81, 0x1C81, -6253, 0},
+    {0x1C82, 0x1C82, -6244, 0}, {0x1C83, 0x1C84, -6242, 0}, {0x1C85, 0x1C85, -6243, 0},
+    {0x1C86, 0x1C86, -6236, 0}, {0x1C87, 0x1C87, -6181, 0}, {0x1C88, 0x1C88, 35266, 0},
+    {0x1D79, 0x1D79, 35332, 0}, {0x1D7D, 0x1D7D, 3814, 0}, {0x1D8E, 0x1D8E, 35384, 0},
+    {0x1E01, 0x1E95, -1, 1}, {0x1E9B, 0x1E9B, -59, 0}, {0x1EA1, 0x1EFF, -1, 1}, {0x1F00, 0x1F07, 8, 0},
+    {0x1F10, 0x1F15, 8, 0}, {0x1F20, 0x1F27, 8, 0}, {0x1F30, 0x1F37, 8, 0}, {0x1F40, 0x1F45, 8, 0},
+    {0x1F51, 0x1F57, 8, 1}, {0x1F60, 0x1F67, 8, 0}, {0x1F70, 0x1F71, 74, 0}, {0x1F72, 0x1F75, 86, 0},
+    {0x1F76, 0x1F77, 100, 0}, {0x1F78, 0x1F79, 128, 0}, {0x1F7A, 0x1F7B, 112, 0},
+    {0x1F7C, 0x1F7D, 126, 0}, {0x1F80, 0x1F87, 8, 0}, {0x1F90, 0x1F97, 8, 0}, {0x1FA0, 0x1FA7, 8, 0},
+    {0x1FB0, 0x1FB1, 8, 0}, {0x1FB3, 0x1FB3, 9, 0}, {0x1FBE, 0x1FBE, -7205, 0}, {0x1FC3, 0x1FC3, 9, 0},
+    {0x1FD0, 0x1FD1, 8, 0}, {0x1FE0, 0x1FE1, 8, 0}, {0x1FE5, 0x1FE5, 7, 0}, {0x1FF3, 0x1FF3, 9, 0},
+    {0x214E, 0x214E, -28, 0}, {0x2170, 0x217F, -16, 0}, {0x2184, 0x2184, -1, 0},
+    {0x24D0, 0x24E9, -26, 0}, {0x2C30, 0x2C5F, -48, 0}, {0x2C61, 0x2C61, -1, 0},
+    {0x2C65, 0x2C65, -10795, 0}, {0x2C66, 0x2C66, -10792, 0}, {0x2C68, 0x2C6C, -1, 1},
+    {0x2C73, 0x2C73, -1, 0}, {0x2C76, 0x2C76, -1, 0}, {0x2C81, 0x2CE3, -1, 1}, {0x2CEC, 0x2CEE, -1, 1},
+    {0x2CF3, 0x2CF3, -1, 0}, {0x2D00, 0x2D25, -7264, 0}, {0x2D27, 0x2D27, -7264, 0},
+    {0x2D2D, 0x2D2D, -7264, 0}, {0xA641, 0xA66D, -1, 1}, {0xA681, 0xA69B, -1, 1},
+    {0xA723, 0xA72F, -1, 1}, {0xA733, 0xA76F, -1, 1}, {0xA77A, 0xA77C, -1, 1}, {0xA77F, 0xA787, -1, 1},
+    {0xA78C, 0xA78C, -1, 0}, {0xA791, 0xA793, -1, 1}, {0xA794, 0xA794, 48, 0}, {0xA797, 0xA7A9, -1, 1},
+    {0xA7B5, 0xA7C3, -1, 1}, {0xA7C8, 0xA7CA, -1, 1}, {0xA7D1, 0xA7D1, -1, 0}, {0xA7D7, 0xA7D9, -1, 1},
+    {0xA7F6, 0xA7F6, -1, 0}, {0xAB53, 0xAB53, -928, 0}, {0xAB70, 0xABBF, -38864, 0},
+    {0xFF41, 0xFF5A, -32, 0}, {0x10428, 0x1044F, -40, 0}, {0x104D8, 0x104FB, -40, 0},
+    {0x10597, 0x105A1, -39, 0}, {0x105A3, 0x105B1, -39, 0}, {0x105B3, 0x105B9, -39, 0},
+    {0x105BB, 0x105BC, -39, 0}, {0x10CC0, 0x10CF2, -64, 0}, {0x118C0, 0x118DF, -32, 0},
+    {0x16E60, 0x16E7F, -32, 0}, {0x1E922, 0x1E943, -34, 0},
+};
+
+//NOTE: Single codepoint case folds (CaseFolding.txt status C).
+static const utf8_case_range utf8_fold_table[] = {
+    {0x41, 0x5A, 32, 0}, {0xB5, 0xB5, 775, 0}, {0xC0, 0xD6, 32, 0}, {0xD8, 0xDE, 32, 0},
+    {0x100, 0x12E, 1, 1}, {0x132, 0x136, 1, 1}, {0x139, 0x147, 1, 1}, {0x14A, 0x176, 1, 1},
+    {0x178, 0x178, -121, 0}, {0x179, 0x17D, 1, 1}, {0x17F, 0x17F, -268, 0}, {0x181, 0x181, 210, 0},
+    {0x182, 0x184, 1, 1}, {0x186, 0x186, 206, 0}, {0x187, 0x187, 1, 0}, {0x189, 0x18A, 205, 0},
+    {0x18B, 0x18B, 1, 0}, {0x18E, 0x18E, 79, 0}, {0x18F, 0x18F, 202, 0}, {0x190, 0x190, 203, 0},
+    {0x191, 0x191, 1, 0}, {0x193, 0x193, 205, 0}, {0x194, 0x194, 207, 0}, {0x196, 0x196, 211, 0},
+    {0x197, 0x197, 209, 0}, {0x198, 0x198, 1, 0}, {0x19C, 0x19C, 211, 0}, {0x19D, 0x19D, 213, 0},
+    {0x19F, 0x19F, 214, 0}, {0x1A0, 0x1A4, 1, 1}, {0x1A6, 0x1A6, 218, 0}, {0x1A7, 0x1A7, 1, 0},
+    {0x1A9, 0x1A9, 218, 0}, {0x1AC, 0x1AC, 1, 0}, {0x1AE, 0x1AE, 218, 0}, {0x1AF, 0x1AF, 1, 0},
+    {0x1B1, 0x1B2, 217, 0}, {0x1B3, 0x1B5, 1, 1}, {0x1B7, 0x1B7, 219, 0}, {0x1B8, 0x1B8, 1, 0},
+    {0x1BC, 0x1BC, 1, 0}, {0x1C4, 0x1C4, 2, 0}, {0x1C5, 0x1C5, 1, 0}, {0x1C7, 0x1C7, 2, 0},
+    {0x1C8, 0x1C8, 1, 0}, {0x1CA, 0x1CA, 2, 0}, {0x1CB, 0x1DB, 1, 1}, {0x1DE, 0x1EE, 1, 1},
+    {0x1F1, 0x1F1, 2, 0}, {0x1F2, 0x1F4, 1, 1}, {0x1F6, 0x1F6, -97, 0}, {0x1F7, 0x1F7, -56, 0},
+    {0x1F8, 0x21E, 1, 1}, {0x220, 0x220, -130, 0}, {0x222, 0x232, 1, 1}, {0x23A, 0x23A, 10795, 0},
+    {0x23B, 0x23B, 1, 0}, {0x23D, 0x23D, -163, 0}, {0x23E, 0x23E, 10792, 0}, {0x241, 0x241, 1, 0},
+    {0x243, 0x243, -195, 0}, {0x244, 0x244, 69, 0}, {0x245, 0x245, 71, 0}, {0x246, 0x24E, 1, 1},
+    {0x345, 0x345, 116, 0}, {0x370, 0x372, 1, 1}, {0x376, 0x376, 1, 0}, {0x37F, 0x37F, 116, 0},
+    {0x386, 0x386, 38, 0}, {0x388, 0x38A, 37, 0}, {0x38C, 0x38C, 64, 0}, {0x38E, 0x38F, 63, 0},
+    {0x391, 0x3A1, 32, 0}, {0x3A3, 0x3AB, 32, 0}, {0x3C2, 0x3C2, 1, 0}, {0x3CF, 0x3CF, 8, 0},
+    {0x3D0, 0x3D0, -30, 0}, {0x3D1, 0x3D1, -25, 0}, {0x3D5, 0x3D5, -15, 0}, {0x3D6, 0x3D6, -22, 0},
+    {0x3D8, 0x3EE, 1, 1}, {0x3F0, 0x3F0, -54, 0}, {0x3F1, 0x3F1, -48, 0}, {0x3F4, 0x3F4, -60, 0},
+    {0x3F5, 0x3F5, -64, 0}, {0x3F7, 0x3F7, 1, 0}, {0x3F9, 0x3F9, -7, 0}, {0x3FA, 0x3FA, 1, 0},
+    {0x3FD, 0x3FF, -130, 0}, {0x400, 0x40F, 80, 0}, {0x410, 0x42F, 32, 0}, {0x460, 0x480, 1, 1},
+    {0x48A, 0x4BE, 1, 1}, {0x4C0, 0x4C0, 15, 0}, {0x4C1, 0x4CD, 1, 1}, {0x4D0, 0x52E, 1, 1},
+    {0x531, 0x556, 48, 0}, {0x10A0, 0x10C5, 7264, 0}, {0x10C7, 0x10C7, 7264, 0},
+    {0x10CD, 0x10CD, 7264, 0}, {0x13F8, 0x13FD, -8, 0}, {0x1C80, 0x1C80, -6222, 0},
+    {0x1C81, 0x1C81, -6221, 0}, {0x1C82, 0x1C82, -6212, 0}, {0x1C83, 0x1C84, -6210, 0},
+    {0x1C85, 0x1C85, -6211, 0}, {0x1C86, 0x1C86, -6204, 0}, {0x1C87, 0x1C87, -6180, 0},
+    {0x1C88, 0x1C88, 35267, 0}, {0x1C90, 0x1CBA, -3008, 0}, {0x1CBD, 0x1CBF, -3008, 0},
+    {0x1E00, 0x1E94, 1, 1}, {0x1E9B, 0x1E9B, -58, 0}, {0x1EA0, 0x1EFE, 1, 1}, {0x1F08, 0x1F0F, -8, 0},
+    {0x1F18, 0x1F1D, -8, 0}, {0x1F28, 0x1F2F, -8, 0}, {0x1F38, 0x1F3F, -8, 0}, {0x1F48, 0x1F4D, -8, 0},
+    {0x1F59, 0x1F5F, -8, 1}, {0x1F68, 0x1F6F, -8, 0}, {0x1FB8, 0x1FB9, -8, 0}, {0x1FBA, 0x1FBB, -74, 0},
+    {0x1FBE, 0x1FBE, -7173, 0}, {0x1FC8, 0x1FCB, -86, 0}, {0x1FD8, 0x1FD9, -8, 0},
+    {0x1FDA, 0x1FDB, -100, 0}, {0x1FE8, 0x1FE9, -8, 0}, {0x1FEA, 0x1FEB, -112, 0},
+    {0x1FEC, 0x1FEC, -7, 0}, {0x1FF8, 0x1FF9, -128, 0}, {0x1FFA, 0x1FFB, -126, 0},
+    {0x2126, 0x2126, -7517, 0}, {0x212A, 0x212A, -8383, 0}, {0x212B, 0x212B, -8262, 0},
+    {0x2132, 0x2132, 28, 0}, {0x2160, 0x216F, 16, 0}, {0x2183, 0x2183, 1, 0}, {0x24B6, 0x24CF, 26, 0},
+    {0x2C00, 0x2C2F, 48, 0}, {0x2C60, 0x2C60, 1, 0}, {0x2C62, 0x2C62, -10743, 0},
+    {0x2C63, 0x2C63, -3814, 0}, {0x2C64, 0x2C64, -10727, 0}, {0x2C67, 0x2C6B, 1, 1},
+    {0x2C6D, 0x2C6D, -10780, 0}, {0x2C6E, 0x2C6E, -10749, 0}, {0x2C6F, 0x2C6F, -10783, 0},
+    {0x2C70, 0x2C70, -10782, 0}, {0x2C72, 0x2C72, 1, 0}, {0x2C75, 0x2C75, 1, 0},
+    {0x2C7E, 0x2C7F, -10815, 0}, {0x2C80, 0x2CE2, 1, 1}, {0x2CEB, 0x2CED, 1, 1}, {0x2CF2, 0x2CF2, 1, 0},
+    {0xA640, 0xA66C, 1, 1}, {0xA680, 0xA69A, 1, 1}, {0xA722, 0xA72E, 1, 1}, {0xA732, 0xA76E, 1, 1},
+    {0xA779, 0xA77B, 1, 1}, {0xA77D, 0xA77D, -35332, 0}, {0xA77E, 0xA786, 1, 1}, {0xA78B, 0xA78B, 1, 0},
+    {0xA78D, 0xA78D, -42280, 0}, {0xA790, 0xA792, 1, 1}, {0xA796, 0xA7A8, 1, 1},
+    {0xA7AA, 0xA7AA, -42308, 0}, {0xA7AB, 0xA7AB, -42319, 0}, {0xA7AC, 0xA7AC, -42315, 0},
+    {0xA7AD, 0xA7AD, -42305, 0}, {0xA7AE, 0xA7AE, -42308, 0}, {0xA7B0, 0xA7B0, -42258, 0},
+    {0xA7B1, 0xA7B1, -42282, 0}, {0xA7B2, 0xA7B2, -42261, 0}, {0xA7B3, 0xA7B3, 928, 0},
+    {0xA7B4, 0xA7C2, 1, 1}, {0xA7C4, 0xA7C4, -48, 0}, {0xA7C5, 0xA7C5, -42307, 0},
+    {0xA7C6, 0xA7C6, -35384, 0}, {0xA7C7, 0xA7C9, 1, 1}, {0xA7D0, 0xA7D0, 1, 0}, {0xA7D6, 0xA7D8, 1, 1},
+    {0xA7F5, 0xA7F5, 1, 0}, {0xAB70, 0xABBF, -38864, 0}, {0xFF21, 0xFF3A, 32, 0},
+    {0x10400, 0x10427, 40, 0}, {0x104B0, 0x104D3, 40, 0}, {0x10570, 0x1057A, 39, 0},
+    {0x1057C, 0x1058A, 39, 0}, {0x1058C, 0x10592, 39, 0}, {0x10594, 0x10595, 39, 0},
+    {0x10C80, 0x10CB2, 64, 0}, {0x118A0, 0x118BF, 32, 0}, {0x16E40, 0x16E5F, 32, 0},
+    {0x1E900, 0x1E921, 34, 0},
+};
+
+//NOTE: Multi codepoint case folds (CaseFolding.txt status F).
+static const utf8_fold_special utf8_fold_special_table[] = {
+    {0xDF, {0x73, 0x73, 0x0}}, {0x130, {0x69, 0x307, 0x0}}, {0x149, {0x2BC, 0x6E, 0x0}},
+    {0x1F0, {0x6A, 0x30C, 0x0}}, {0x390, {0x3B9, 0x308, 0x301}}, {0x3B0, {0x3C5, 0x308, 0x301}},
+    {0x587, {0x565, 0x582, 0x0}}, {0x1E96, {0x68, 0x331, 0x0}}, {0x1E97, {0x74, 0x308, 0x0}},
+    {0x1E98, {0x77, 0x30A, 0x0}}, {0x1E99, {0x79, 0x30A, 0x0}}, {0x1E9A, {0x61, 0x2BE, 0x0}},
+    {0x1E9E, {0x73, 0x73, 0x0}}, {0x1F50, {0x3C5, 0x313, 0x0}}, {0x1F52, {0x3C5, 0x313, 0x300}},
+    {0x1F54, {0x3C5, 0x313, 0x301}}, {0x1F56, {0x3C5, 0x313, 0x342}}, {0x1F80, {0x1F00, 0x3B9, 0x0}},
+    {0x1F81, {0x1F01, 0x3B9, 0x0}}, {0x1F82, {0x1F02, 0x3B9, 0x0}}, {0x1F83, {0x1F03, 0x3B9, 0x0}},
+    {0x1F84, {0x1F04, 0x3B9, 0x0}}, {0x1F85, {0x1F05, 0x3B9, 0x0}}, {0x1F86, {0x1F06, 0x3B9, 0x0}},
+    {0x1F87, {0x1F07, 0x3B9, 0x0}}, {0x1F88, {0x1F00, 0x3B9, 0x0}}, {0x1F89, {0x1F01, 0x3B9, 0x0}},
+    {0x1F8A, {0x1F02, 0x3B9, 0x0}}, {0x1F8B, {0x1F03, 0x3B9, 0x0}}, {0x1F8C, {0x1F04, 0x3B9, 0x0}},
+    {0x1F8D, {0x1F05, 0x3B9, 0x0}}, {0x1F8E, {0x1F06, 0x3B9, 0x0}}, {0x1F8F, {0x1F07, 0x3B9, 0x0}},
+    {0x1F90, {0x1F20, 0x3B9, 0x0}}, {0x1F91, {0x1F21, 0x3B9, 0x0}}, {0x1F92, {0x1F22, 0x3B9, 0x0}},
+    {0x1F93, {0x1F23, 0x3B9, 0x0}}, {0x1F94, {0x1F24, 0x3B9, 0x0}}, {0x1F95, {0x1F25, 0x3B9, 0x0}},
+    {0x1F96, {0x1F26, 0x3B9, 0x0}}, {0x1F97, {0x1F27, 0x3B9, 0x0}}, {0x1F98, {0x1F20, 0x3B9, 0x0}},
+    {0x1F99, {0x1F21, 0x3B9, 0x0}}, {0x1F9A, {0x1F22, 0x3B9, 0x0}}, {0x1F9B, {0x1F23, 0x3B9, 0x0}},
+    {0x1F9C, {0x1F24, 0x3B9, 0x0}}, {0x1F9D, {0x1F25, 0x3B9, 0x0}}, {0x1F9E, {0x1F26, 0x3B9, 0x0}},
+    {0x1F9F, {0x1F27, 0x3B9, 0x0}}, {0x1FA0, {0x1F60, 0x3B9, 0x0}}, {0x1FA1, {0x1F61, 0x3B9, 0x0}},
+    {0x1FA2, {0x1F62, 0x3B9, 0x0}}, {0x1FA3, {0x1F63, 0x3B9, 0x0}}, {0x1FA4, {0x1F64, 0x3B9, 0x0}},
+    {0x1FA5, {0x1F65, 0x3B9, 0x0}}, {0x1FA6, {0x1F66, 0x3B9, 0x0}}, {0x1FA7, {0x1F67, 0x3B9, 0x0}},
+    {0x1FA8, {0x1F60, 0x3B9, 0x0}}, {0x1FA9, {0x1F61, 0x3B9, 0x0}}, {0x1FAA, {0x1F62, 0x3B9, 0x0}},
+    {0x1FAB, {0x1F63, 0x3B9, 0x0}}, {0x1FAC, {0x1F64, 0x3B9, 0x0}}, {0x1FAD, {0x1F65, 0x3B9, 0x0}},
+    {0x1FAE, {0x1F66, 0x3B9, 0x0}}, {0x1FAF, {0x1F67, 0x3B9, 0x0}}, {0x1FB2, {0x1F70, 0x3B9, 0x0}},
+    {0x1FB3, {0x3B1, 0x3B9, 0x0}}, {0x1FB4, {0x3AC, 0x3B9, 0x0}}, {0x1FB6, {0x3B1, 0x342, 0x0}},
+    {0x1FB7, {0x3B1, 0x342, 0x3B9}}, {0x1FBC, {0x3B1, 0x3B9, 0x0}}, {0x1FC2, {0x1F74, 0x3B9, 0x0}},
+    {0x1FC3, {0x3B7, 0x3B9, 0x0}}, {0x1FC4, {0x3AE, 0x3B9, 0x0}}, {0x1FC6, {0x3B7, 0x342, 0x0}},
+    {0x1FC7, {0x3B7, 0x342, 0x3B9}}, {0x1FCC, {0x3B7, 0x3B9, 0x0}}, {0x1FD2, {0x3B9, 0x308, 0x300}},
+    {0x1FD3, {0x3B9, 0x308, 0x301}}, {0x1FD6, {0x3B9, 0x342, 0x0}}, {0x1FD7, {0x3B9, 0x308, 0x342}},
+    {0x1FE2, {0x3C5, 0x308, 0x300}}, {0x1FE3, {0x3C5, 0x308, 0x301}}, {0x1FE4, {0x3C1, 0x313, 0x0}},
+    {0x1FE6, {0x3C5, 0x342, 0x0}}, {0x1FE7, {0x3C5, 0x308, 0x342}}, {0x1FF2, {0x1F7C, 0x3B9, 0x0}},
+    {0x1FF3, {0x3C9, 0x3B9, 0x0}}, {0x1FF4, {0x3CE, 0x3B9, 0x0}}, {0x1FF6, {0x3C9, 0x342, 0x0}},
+    {0x1FF7, {0x3C9, 0x342, 0x3B9}}, {0x1FFC, {0x3C9, 0x3B9, 0x0}}, {0xFB00, {0x66, 0x66, 0x0}},
+    {0xFB01, {0x66, 0x69, 0x0}}, {0xFB02, {0x66, 0x6C, 0x0}}, {0xFB03, {0x66, 0x66, 0x69}},
+    {0xFB04, {0x66, 0x66, 0x6C}}, {0xFB05, {0x73, 0x74, 0x0}}, {0xFB06, {0x73, 0x74, 0x0}},
+    {0xFB13, {0x574, 0x576, 0x0}}, {0xFB14, {0x574, 0x565, 0x0}}, {0xFB15, {0x574, 0x56B, 0x0}},
+    {0xFB16, {0x57E, 0x576, 0x0}}, {0xFB17, {0x574, 0x56D, 0x0}},
+};
+
+//NOTE: Normalization properties. ccc is the canonical combining class and qc
+//holds the quick-check bits below. Codepoints not listed have ccc 0 and pass
+//every quick check. Hangul syllables are decomposed and composed in code,
+//they have no entries in the decomposition and composition tables.
+#define UTF8_QC_NFD_NO      0x01
+#define UTF8_QC_NFKD_NO     0x02
+#define UTF8_QC_NFC_NO      0x04
+#define UTF8_QC_NFC_MAYBE   0x08    //NOTE: Same set for NFKC, may combine with the previous starter
+#define UTF8_QC_NFKC_NO     0x10
+
+typedef struct utf8_norm_range {
+    unsigned int first;
+    unsigned int last;
+    unsigned char ccc;
+    unsigned char qc;
+} utf8_norm_range;
+
+//NOTE: Full decompositions, already applied recursively. The codepoints are
+//utf8_decomp_pool[offset .. offset + len). A codepoint has a canonical entry
+//(compat = 0), a compatibility entry (compat = 1), or both in that order.
+typedef struct utf8_decomp {
+    unsigned int cp;
+    unsigned short offset;
+    unsigned char len;
+    unsigned char compat;
+} utf8_decomp;
+
+//NOTE: Primary composites, sorted by (first, second). Excluded compositions are left out.
+typedef struct utf8_compose_pair {
+    unsigned int first;
+    unsigned int second;
+    unsigned int composite;
+} utf8_compose_pair;
+
+static const utf8_norm_range utf8_norm_table[] = {
+    {0xA0, 0xA0, 0, 0x12}, {0xA8, 0xA8, 0, 0x12}, {0xAA, 0xAA, 0, 0x12}, {0xAF, 0xAF, 0, 0x12},
+    {0xB2, 0xB5, 0, 0x12}, {0xB8, 0xBA, 0, 0x12}, {0xBC, 0xBE, 0, 0x12}, {0xC0, 0xC5, 0, 0x03},
+    {0xC7, 0xCF, 0, 0x03}, {0xD1, 0xD6, 0, 0x03}, {0xD9, 0xDD, 0, 0x03}, {0xE0, 0xE5, 0, 0x03},
+    {0xE7, 0xEF, 0, 0x03}, {0xF1, 0xF6, 0, 0x03}, {0xF9, 0xFD, 0, 0x03}, {0xFF, 0x10F, 0, 0x03},
+    {0x112, 0x125, 0, 0x03}, {0x128, 0x130, 0, 0x03}, {0x132, 0x133, 0, 0x12}, {0x134, 0x137, 0, 0x03},
+    {0x139, 0x13E, 0, 0x03}, {0x13F, 0x140, 0, 0x12}, {0x143, 0x148, 0, 0x03}, {0x149, 0x149, 0, 0x12},
+    {0x14C, 0x151, 0, 0x03}, {0x154, 0x165, 0, 0x03}, {0x168, 0x17E, 0, 0x03}, {0x17F, 0x17F, 0, 0x12},
+    {0x1A0, 0x1A1, 0, 0x03}, {0x1AF, 0x1B0, 0, 0x03}, {0x1C4, 0x1CC, 0, 0x12}, {0x1CD, 0x1DC, 0, 0x03},
+    {0x1DE, 0x1E3, 0, 0x03}, {0x1E6, 0x1F0, 0, 0x03}, {0x1F1, 0x1F3, 0, 0x12}, {0x1F4, 0x1F5, 0, 0x03},
+    {0x1F8, 0x21B, 0, 0x03}, {0x21E, 0x21F, 0, 0x03}, {0x226, 0x233, 0, 0x03}, {0x2B0, 0x2B8, 0, 0x12},
+    {0x2D8, 0x2DD, 0, 0x12}, {0x2E0, 0x2E4, 0, 0x12}, {0x300, 0x304, 230, 0x08},
+    {0x305, 0x305, 230, 0x00}, {0x306, 0x30C, 230, 0x08}, {0x30D, 0x30E, 230, 0x00},
+    {0x30F, 0x30F, 230, 0x08}, {0x310, 0x310, 230, 0x00}, {0x311, 0x311, 230, 0x08},
+    {0x312, 0x312, 230, 0x00}, {0x313, 0x314, 230, 0x08}, {0x315, 0x315, 232, 0x00},
+    {0x316, 0x319, 220, 0x00}, {0x31A, 0x31A, 232, 0x00}, {0x31B, 0x31B, 216, 0x08},
+    {0x31C, 0x320, 220, 0x00}, {0x321, 0x322, 202, 0x00}, {0x323, 0x326, 220, 0x08},
+    {0x327, 0x328, 202, 0x08}, {0x329, 0x32C, 220, 0x00}, {0x32D, 0x32E, 220, 0x08},
+    {0x32F, 0x32F, 220, 0x00}, {0x330, 0x331, 220, 0x08}, {0x332, 0x333, 220, 0x00},
+    {0x334, 0x337, 1, 0x00}, {0x338, 0x338, 1, 0x08}, {0x339, 0x33C, 220, 0x00},
+    {0x33D, 0x33F, 230, 0x00}, {0x340, 0x341, 230, 0x17}, {0x342, 0x342, 230, 0x08},
+    {0x343, 0x344, 230, 0x17}, {0x345, 0x345, 240, 0x08}, {0x346, 0x346, 230, 0x00},
+    {0x347, 0x349, 220, 0x00}, {0x34A, 0x34C, 230, 0x00}, {0x34D, 0x34E, 220, 0x00},
+    {0x350, 0x352, 230, 0x00}, {0x353, 0x356, 220, 0x00}, {0x357, 0x357, 230, 0x00},
+    {0x358, 0x358, 232, 0x00}, {0x359, 0x35A, 220, 0x00}, {0x35B, 0x35B, 230, 0x00},
+    {0x35C, 0x35C, 233, 0x00}, {0x35D, 0x35E, 234, 0x00}, {0x35F, 0x35F, 233, 0x00},
+    {0x360, 0x361, 234, 0x00}, {0x362, 0x362, 233, 0x00}, {0x363, 0x36F, 230, 0x00},
+    {0x374, 0x374, 0, 0x17}, {0x37A, 0x37A, 0, 0x12}, {0x37E, 0x37E, 0, 0x17}, {0x384, 0x384, 0, 0x12},
+    {0x385, 0x385, 0, 0x13}, {0x386, 0x386, 0, 0x03}, {0x387, 0x387, 0, 0x17}, {0x388, 0x38A, 0, 0x03},
+    {0x38C, 0x38C, 0, 0x03}, {0x38E, 0x390, 0, 0x03}, {0x3AA, 0x3B0, 0, 0x03}, {0x3CA, 0x3CE, 0, 0x03},
+    {0x3D0, 0x3D2, 0, 0x12}, {0x3D3, 0x3D4, 0, 0x13}, {0x3D5, 0x3D6, 0, 0x12}, {0x3F0, 0x3F2, 0, 0x12},
+    {0x3F4, 0x3F5, 0, 0x12}, {0x3F9, 0x3F9, 0, 0x12}, {0x400, 0x401, 0, 0x03}, {0x403, 0x403, 0, 0x03},
+    {0x407, 0x407, 0, 0x03}, {0x40C, 0x40E, 0, 0x03}, {0x419, 0x419, 0, 0x03}, {0x439, 0x439, 0, 0x03},
+    {0x450, 0x451, 0, 0x03}, {0x453, 0x453, 0, 0x03}, {0x457, 0x457, 0, 0x03}, {0x45C, 0x45E, 0, 0x03},
+    {0x476, 0x477, 0, 0x03}, {0x483, 0x487, 230, 0x00}, {0x4C1, 0x4C2, 0, 0x03},
+    {0x4D0, 0x4D3, 0, 0x03}, {0x4D6, 0x4D7, 0, 0x03}, {0x4DA, 0x4DF, 0, 0x03}, {0x4E2, 0x4E7, 0, 0x03},
+    {0x4EA, 0x4F5, 0, 0x03}, {0x4F8, 0x4F9, 0, 0x03}, {0x587, 0x587, 0, 0x12},
+    {0x591, 0x591, 220, 0x00}, {0x592, 0x595, 230, 0x00}, {0x596, 0x596, 220, 0x00},
+    {0x597, 0x599, 230, 0x00}, {0x59A, 0x59A, 222, 0x00}, {0x59B, 0x59B, 220, 0x00},
+    {0x59C, 0x5A1, 230, 0x00}, {0x5A2, 0x5A7, 220, 0x00}, {0x5A8, 0x5A9, 230, 0x00},
+    {0x5AA, 0x5AA, 220, 0x00}, {0x5AB, 0x5AC, 230, 0x00}, {0x5AD, 0x5AD, 222, 0x00},
+    {0x5AE, 0x5AE, 228, 0x00}, {0x5AF, 0x5AF, 230, 0x00}, {0x5B0, 0x5B0, 10, 0x00},
+    {0x5B1, 0x5B1, 11, 0x00}, {0x5B2, 0x5B2, 12, 0x00}, {0x5B3, 0x5B3, 13, 0x00},
+    {0x5B4, 0x5B4, 14, 0x00}, {0x5B5, 0x5B5, 15, 0x00}, {0x5B6, 0x5B6, 16, 0x00},
+    {0x5B7, 0x5B7, 17, 0x00}, {0x5B8, 0x5B8, 18, 0x00}, {0x5B9, 0x5BA, 19, 0x00},
+    {0x5BB, 0x5BB, 20, 0x00}, {0x5BC, 0x5BC, 21, 0x00}, {0x5BD, 0x5BD, 22, 0x00},
+    {0x5BF, 0x5BF, 23, 0x00}, {0x5C1, 0x5C1, 24, 0x00}, {0x5C2, 0x5C2, 25, 0x00},
+    {0x5C4, 0x5C4, 230, 0x00}, {0x5C5, 0x5C5, 220, 0x00}, {0x5C7, 0x5C7, 18, 0x00},
+    {0x610, 0x617, 230, 0x00}, {0x618, 0x618, 30, 0x00}, {0x619, 0x619, 31, 0x00},
+    {0x61A, 0x61A, 32, 0x00}, {0x622, 0x626, 0, 0x03}, {0x64B, 0x64B, 27, 0x00},
+    {0x64C, 0x64C, 28, 0x00}, {0x64D, 0x64D, 29, 0x00}, {0x64E, 0x64E, 30, 0x00},
+    {0x64F, 0x64F, 31, 0x00}, {0x650, 0x650, 32, 0x00}, {0x651, 0x651, 33, 0x00},
+    {0x652, 0x652, 34, 0x00}, {0x653, 0x654, 230, 0x08}, {0x655, 0x655, 220, 0x08},
+    {0x656, 0x656, 220, 0x00}, {0x657, 0x65B, 230, 0x00}, {0x65C, 0x65C, 220, 0x00},
+    {0x65D, 0x65E, 230, 0x00}, {0x65F, 0x65F, 220, 0x00}, {0x670, 0x670, 35, 0x00},
+    {0x675, 0x678, 0, 0x12}, {0x6C0, 0x6C0, 0, 0x03}, {0x6C2, 0x6C2, 0, 0x03}, {0x6D3, 0x6D3, 0, 0x03},
+    {0x6D6, 0x6DC, 230, 0x00}, {0x6DF, 0x6E2, 230, 0x00}, {0x6E3, 0x6E3, 220, 0x00},
+    {0x6E4, 0x6E4, 230, 0x00}, {0x6E7, 0x6E8, 230, 0x00}, {0x6EA, 0x6EA, 220, 0x00},
+    {0x6EB, 0x6EC, 230, 0x00}, {0x6ED, 0x6ED, 220, 0x00}, {0x711, 0x711, 36, 0x00},
+    {0x730, 0x730, 230, 0x00}, {0x731, 0x731, 220, 0x00}, {0x732, 0x733, 230, 0x00},
+    {0x734, 0x734, 220, 0x00}, {0x735, 0x736, 230, 0x00}, {0x737, 0x739, 220, 0x00},
+    {0x73A, 0x73A, 230, 0x00}, {0x73B, 0x73C, 220, 0x00}, {0x73D, 0x73D, 230, 0x00},
+    {0x73E, 0x73E, 220, 0x00}, {0x73F, 0x741, 230, 0x00}, {0x742, 0x742, 220, 0x00},
+    {0x743, 0x743, 230, 0x00}, {0x744, 0x744, 220, 0x00}, {0x745, 0x745, 230, 0x00},
+    {0x746, 0x746, 220, 0x00}, {0x747, 0x747, 230, 0x00}, {0x748, 0x748, 220, 0x00},
+    {0x749, 0x74A, 230, 0x00}, {0x7EB, 0x7F1, 230, 0x00}, {0x7F2, 0x7F2, 220, 0x00},
+    {0x7F3, 0x7F3, 230, 0x00}, {0x7FD, 0x7FD, 220, 0x00}, {0x816, 0x819, 230, 0x00},
+    {0x81B, 0x823, 230, 0x00}, {0x825, 0x827, 230, 0x00}, {0x829, 0x82D, 230, 0x00},
+    {0x859, 0x85B, 220, 0x00}, {0x898, 0x898, 230, 0x00}, {0x899, 0x89B, 220, 0x00},
+    {0x89C, 0x89F, 230, 0x00}, {0x8CA, 0x8CE, 230, 0x00}, {0x8CF, 0x8D3, 220, 0x00},
+    {0x8D4, 0x8E1, 230, 0x00}, {0x8E3, 0x8E3, 220, 0x00}, {0x8E4, 0x8E5, 230, 0x00},
+    {0x8E6, 0x8E6, 220, 0x00}, {0x8E7, 0x8E8, 230, 0x00}, {0x8E9, 0x8E9, 220, 0x00},
+    {0x8EA, 0x8EC, 230, 0x00}, {0x8ED, 0x8EF, 220, 0x00}, {0x8F0, 0x8F0, 27, 0x00},
+    {0x8F1, 0x8F1, 28, 0x00}, {0x8F2, 0x8F2, 29, 0x00}, {0x8F3, 0x8F5, 230, 0x00},
+    {0x8F6, 0x8F6, 220, 0x00}, {0x8F7, 0x8F8, 230, 0x00}, {0x8F9, 0x8FA, 220, 0x00},
+    {0x8FB, 0x8FF, 230, 0x00}, {0x929, 0x929, 0, 0x03}, {0x931, 0x931, 0, 0x03},
+    {0x934, 0x934, 0, 0x03}, {0x93C, 0x93C, 7, 0x08}, {0x94D, 0x94D, 9, 0x00},
+    {0x951, 0x951, 230, 0x00}, {0x952, 0x952, 220, 0x00}, {0x953, 0x954, 230, 0x00},
+    {0x958, 0x95F, 0, 0x17}, {0x9BC, 0x9BC, 7, 0x00}, {0x9BE, 0x9BE, 0, 0x08}, {0x9CB, 0x9CC, 0, 0x03},
+    {0x9CD, 0x9CD, 9, 0x00}, {0x9D7, 0x9D7, 0, 0x08}, {0x9DC, 0x9DD, 0, 0x17}, {0x9DF, 0x9DF, 0, 0x17},
+    {0x9FE, 0x9FE, 230, 0x00}, {0xA33, 0xA33, 0, 0x17}, {0xA36, 0xA36, 0, 0x17},
+    {0xA3C, 0xA3C, 7, 0x00}, {0xA4D, 0xA4D, 9, 0x00}, {0xA59, 0xA5B, 0, 0x17}, {0xA5E, 0xA5E, 0, 0x17},
+    {0xABC, 0xABC, 7, 0x00}, {0xACD, 0xACD, 9, 0x00}, {0xB3C, 0xB3C, 7, 0x00}, {0xB3E, 0xB3E, 0, 0x08},
+    {0xB48, 0xB48, 0, 0x03}, {0xB4B, 0xB4C, 0, 0x03}, {0xB4D, 0xB4D, 9, 0x00}, {0xB56, 0xB57, 0, 0x08},
+    {0xB5C, 0xB5D, 0, 0x17}, {0xB94, 0xB94, 0, 0x03}, {0xBBE, 0xBBE, 0, 0x08}, {0xBCA, 0xBCC, 0, 0x03},
+    {0xBCD, 0xBCD, 9, 0x00}, {0xBD7, 0xBD7, 0, 0x08}, {0xC3C, 0xC3C, 7, 0x00}, {0xC48, 0xC48, 0, 0x03},
+    {0xC4D, 0xC4D, 9, 0x00}, {0xC55, 0xC55, 84, 0x00}, {0xC56, 0xC56, 91, 0x08},
+    {0xCBC, 0xCBC, 7, 0x00}, {0xCC0, 0xCC0, 0, 0x03}, {0xCC2, 0xCC2, 0, 0x08}, {0xCC7, 0xCC8, 0, 0x03},
+    {0xCCA, 0xCCB, 0, 0x03}, {0xCCD, 0xCCD, 9, 0x00}, {0xCD5, 0xCD6, 0, 0x08}, {0xD3B, 0xD3C, 9, 0x00},
+    {0xD3E, 0xD3E, 0, 0x08}, {0xD4A, 0xD4C, 0, 0x03}, {0xD4D, 0xD4D, 9, 0x00}, {0xD57, 0xD57, 0, 0x08},
+    {0xDCA, 0xDCA, 9, 0x08}, {0xDCF, 0xDCF, 0, 0x08}, {0xDDA, 0xDDA, 0, 0x03}, {0xDDC, 0xDDE, 0, 0x03},
+    {0xDDF, 0xDDF, 0, 0x08}, {0xE33, 0xE33, 0, 0x12}, {0xE38, 0xE39, 103, 0x00},
+    {0xE3A, 0xE3A, 9, 0x00}, {0xE48, 0xE4B, 107, 0x00}, {0xEB3, 0xEB3, 0, 0x12},
+    {0xEB8, 0xEB9, 118, 0x00}, {0xEBA, 0xEBA, 9, 0x00}, {0xEC8, 0xECB, 122, 0x00},
+    {0xEDC, 0xEDD, 0, 0x12}, {0xF0C, 0xF0C, 0, 0x12}, {0xF18, 0xF19, 220, 0x00},
+    {0xF35, 0xF35, 220, 0x00}, {0xF37, 0xF37, 220, 0x00}, {0xF39, 0xF39, 216, 0x00},
+    {0xF43, 0xF43, 0, 0x17}, {0xF4D, 0xF4D, 0, 0x17}, {0xF52, 0xF52, 0, 0x17}, {0xF57, 0xF57, 0, 0x17},
+    {0xF5C, 0xF5C, 0, 0x17}, {0xF69, 0xF69, 0, 0x17}, {0xF71, 0xF71, 129, 0x00},
+    {0xF72, 0xF72, 130, 0x00}, {0xF73, 0xF73, 0, 0x17}, {0xF74, 0xF74, 132, 0x00},
+    {0xF75, 0xF76, 0, 0x17}, {0xF77, 0xF77, 0, 0x12}, {0xF78, 0xF78, 0, 0x17}, {0xF79, 0xF79, 0, 0x12},
+    {0xF7A, 0xF7D, 130, 0x00}, {0xF80, 0xF80, 130, 0x00}, {0xF81, 0xF81, 0, 0x17},
+    {0xF82, 0xF83, 230, 0x00}, {0xF84, 0xF84, 9, 0x00}, {0xF86, 0xF87, 230, 0x00},
+    {0xF93, 0xF93, 0, 0x17}, {0xF9D, 0xF9D, 0, 0x17}, {0xFA2, 0xFA2, 0, 0x17}, {0xFA7, 0xFA7, 0, 0x17},
+    {0xFAC, 0xFAC, 0, 0x17}, {0xFB9, 0xFB9, 0, 0x17}, {0xFC6, 0xFC6, 220, 0x00},
+    {0x1026, 0x1026, 0, 0x03}, {0x102E, 0x102E, 0, 0x08}, {0x1037, 0x1037, 7, 0x00},
+    {0x1039, 0x103A, 9, 0x00}, {0x108D, 0x108D, 220, 0x00}, {0x10FC, 0x10FC, 0, 0x12},
+    {0x1161, 0x1175, 0, 0x08}, {0x11A8, 0x11C2, 0, 0x08}, {0x135D, 0x135F, 230, 0x00},
+    {0x1714, 0x1715, 9, 0x00}, {0x1734, 0x1734, 9, 0x00}, {0x17D2, 0x17D2, 9, 0x00},
+    {0x17DD, 0x17DD, 230, 0x00}, {0x18A9, 0x18A9, 228, 0x00}, {0x1939, 0x1939, 222, 0x00},
+    {0x193A, 0x193A, 230, 0x00}, {0x193B, 0x193B, 220, 0x00}, {0x1A17, 0x1A17, 230, 0x00},
+    {0x1A18, 0x1A18, 220, 0x00}, {0x1A60, 0x1A60, 9, 0x00}, {0x1A75, 0x1A7C, 230, 0x00},
+    {0x1A7F, 0x1A7F, 220, 0x00}, {0x1AB0, 0x1AB4, 230, 0x00}, {0x1AB5, 0x1ABA, 220, 0x00},
+    {0x1ABB, 0x1ABC, 230, 0x00}, {0x1ABD, 0x1ABD, 220, 0x00}, {0x1ABF, 0x1AC0, 220, 0x00},
+    {0x1AC1, 0x1AC2, 230, 0x00}, {0x1AC3, 0x1AC4, 220, 0x00}, {0x1AC5, 0x1AC9, 230, 0x00},
+    {0x1ACA, 0x1ACA, 220, 0x00}, {0x1ACB, 0x1ACE, 230, 0x00}, {0x1B06, 0x1B06, 0, 0x03},
+    {0x1B08, 0x1B08, 0, 0x03}, {0x1B0A, 0x1B0A, 0, 0x03}, {0x1B0C, 0x1B0C, 0, 0x03},
+    {0x1B0E, 0x1B0E, 0, 0x03}, {0x1B12, 0x1B12, 0, 0x03}, {0x1B34, 0x1B34, 7, 0x00},
+    {0x1B35, 0x1B35, 0, 0x08}, {0x1B3B, 0x1B3B, 0, 0x03}, {0x1B3D, 0x1B3D, 0, 0x03},
+    {0x1B40, 0x1B41, 0, 0x03}, {0x1B43, 0x1B43, 0, 0x03}, {0x1B44, 0x1B44, 9, 0x00},
+    {0x1B6B, 0x1B6B, 230, 0x00}, {0x1B6C, 0x1B6C, 220, 0x00}, {0x1B6D, 0x1B73, 230, 0x00},
+    {0x1BAA, 0x1BAB, 9, 0x00}, {0x1BE6, 0x1BE6, 7, 0x00}, {0x1BF2, 0x1BF3, 9, 0x00},
+    {0x1C37, 0x1C37, 7, 0x00}, {0x1CD0, 0x1CD2, 230, 0x00}, {0x1CD4, 0x1CD4, 1, 0x00},
+    {0x1CD5, 0x1CD9, 220, 0x00}, {0x1CDA, 0x1CDB, 230, 0x00}, {0x1CDC, 0x1CDF, 220, 0x00},
+    {0x1CE0, 0x1CE0, 230, 0x00}, {0x1CE2, 0x1CE8, 1, 0x00}, {0x1CED, 0x1CED, 220, 0x00},
+    {0x1CF4, 0x1CF4, 230, 0x00}, {0x1CF8, 0x1CF9, 230, 0x00}, {0x1D2C, 0x1D2E, 0, 0x12},
+    {0x1D30, 0x1D3A, 0, 0x12}, {0x1D3C, 0x1D4D, 0, 0x12}, {0x1D4F, 0x1D6A, 0, 0x12},
+    {0x1D78, 0x1D78, 0, 0x12}, {0x1D9B, 0x1DBF, 0, 0x12}, {0x1DC0, 0x1DC1, 230, 0x00},
+    {0x1DC2, 0x1DC2, 220, 0x00}, {0x1DC3, 0x1DC9, 230, 0x00}, {0x1DCA, 0x1DCA, 220, 0x00},
+    {0x1DCB, 0x1DCC, 230, 0x00}, {0x1DCD, 0x1DCD, 234, 0x00}, {0x1DCE, 0x1DCE, 214, 0x00},
+    {0x1DCF, 0x1DCF, 220, 0x00}, {0x1DD0, 0x1DD0, 202, 0x00}, {0x1DD1, 0x1DF5, 230, 0x00},
+    {0x1DF6, 0x1DF6, 232, 0x00}, {0x1DF7, 0x1DF8, 228, 0x00}, {0x1DF9, 0x1DF9, 220, 0x00},
+    {0x1DFA, 0x1DFA, 218, 0x00}, {0x1DFB, 0x1DFB, 230, 0x00}, {0x1DFC, 0x1DFC, 233, 0x00},
+    {0x1DFD, 0x1DFD, 220, 0x00}, {0x1DFE, 0x1DFE, 230, 0x00}, {0x1DFF, 0x1DFF, 220, 0x00},
+    {0x1E00, 0x1E99, 0, 0x03}, {0x1E9A, 0x1E9A, 0, 0x12}, {0x1E9B, 0x1E9B, 0, 0x13},
+    {0x1EA0, 0x1EF9, 0, 0x03}, {0x1F00, 0x1F15, 0, 0x03}, {0x1F18, 0x1F1D, 0, 0x03},
+    {0x1F20, 0x1F45, 0, 0x03}, {0x1F48, 0x1F4D, 0, 0x03}, {0x1F50, 0x1F57, 0, 0x03},
+    {0x1F59, 0x1F59, 0, 0x03}, {0x1F5B, 0x1F5B, 0, 0x03}, {0x1F5D, 0x1F5D, 0, 0x03},
+    {0x1F5F, 0x1F70, 0, 0x03}, {0x1F71, 0x1F71, 0, 0x17}, {0x1F72, 0x1F72, 0, 0x03},
+    {0x1F73, 0x1F73, 0, 0x17}, {0x1F74, 0x1F74, 0, 0x03}, {0x1F75, 0x1F75, 0, 0x17},
+    {0x1F76, 0x1F76, 0, 0x03}, {0x1F77, 0x1F77, 0, 0x17}, {0x1F78, 0x1F78, 0, 0x03},
+    {0x1F79, 0x1F79, 0, 0x17}, {0x1F7A, 0x1F7A, 0, 0x03}, {0x1F7B, 0x1F7B, 0, 0x17},
+    {0x1F7C, 0x1F7C, 0, 0x03}, {0x1F7D, 0x1F7D, 0, 0x17}, {0x1F80, 0x1FB4, 0, 0x03},
+    {0x1FB6, 0x1FBA, 0, 0x03}, {0x1FBB, 0x1FBB, 0, 0x17}, {0x1FBC, 0x1FBC, 0, 0x03},
+    {0x1FBD, 0x1FBD, 0, 0x12}, {0x1FBE, 0x1FBE, 0, 0x17}, {0x1FBF, 0x1FC0, 0, 0x12},
+    {0x1FC1, 0x1FC1, 0, 0x13}, {0x1FC2, 0x1FC4, 0, 0x03}, {0x1FC6, 0x1FC8, 0, 0x03},
+    {0x1FC9, 0x1FC9, 0, 0x17}, {0x1FCA, 0x1FCA, 0, 0x03}, {0x1FCB, 0x1FCB, 0, 0x17},
+    {0x1FCC, 0x1FCC, 0, 0x03}, {0x1FCD, 0x1FCF, 0, 0x13}, {0x1FD0, 0x1FD2, 0, 0x03},
+    {0x1FD3, 0x1FD3, 0, 0x17}, {0x1FD6, 0x1FDA, 0, 0x03}, {0x1FDB, 0x1FDB, 0, 0x17},
+    {0x1FDD, 0x1FDF, 0, 0x13}, {0x1FE0, 0x1FE2, 0, 0x03}, {0x1FE3, 0x1FE3, 0, 0x17},
+    {0x1FE4, 0x1FEA, 0, 0x03}, {0x1FEB, 0x1FEB, 0, 0x17}, {0x1FEC, 0x1FEC, 0, 0x03},
+    {0x1FED, 0x1FED, 0, 0x13}, {0x1FEE, 0x1FEF, 0, 0x17}, {0x1FF2, 0x1FF4, 0, 0x03},
+    {0x1FF6, 0x1FF8, 0, 0x03}, {0x1FF9, 0x1FF9, 0, 0x17}, {0x1FFA, 0x1FFA, 0, 0x03},
+    {0x1FFB, 0x1FFB, 0, 0x17}, {0x1FFC, 0x1FFC, 0, 0x03}, {0x1FFD, 0x1FFD, 0, 0x17},
+    {0x1FFE, 0x1FFE, 0, 0x12}, {0x2000, 0x2001, 0, 0x17}, {0x2002, 0x200A, 0, 0x12},
+    {0x2011, 0x2011, 0, 0x12}, {0x2017, 0x2017, 0, 0x12}, {0x2024, 0x2026, 0, 0x12},
+    {0x202F, 0x202F, 0, 0x12}, {0x2033, 0x2034, 0, 0x12}, {0x2036, 0x2037, 0, 0x12},
+    {0x203C, 0x203C, 0, 0x12}, {0x203E, 0x203E, 0, 0x12}, {0x2047, 0x2049, 0, 0x12},
+    {0x2057, 0x2057, 0, 0x12}, {0x205F, 0x205F, 0, 0x12}, {0x2070, 0x2071, 0, 0x12},
+    {0x2074, 0x208E, 0, 0x12}, {0x2090, 0x209C, 0, 0x12}, {0x20A8, 0x20A8, 0, 0x12},
+    {0x20D0, 0x20D1, 230, 0x00}, {0x20D2, 0x20D3, 1, 0x00}, {0x20D4, 0x20D7, 230, 0x00},
+    {0x20D8, 0x20DA, 1, 0x00}, {0x20DB, 0x20DC, 230, 0x00}, {0x20E1, 0x20E1, 230, 0x00},
+    {0x20E5, 0x20E6, 1, 0x00}, {0x20E7, 0x20E7, 230, 0x00}, {0x20E8, 0x20E8, 220, 0x00},
+    {0x20E9, 0x20E9, 230, 0x00}, {0x20EA, 0x20EB, 1, 0x00}, {0x20EC, 0x20EF, 220, 0x00},
+    {0x20F0, 0x20F0, 230, 0x00}, {0x2100, 0x2103, 0, 0x12}, {0x2105, 0x2107, 0, 0x12},
+    {0x2109, 0x2113, 0, 0x12}, {0x2115, 0x2116, 0, 0x12}, {0x2119, 0x211D, 0, 0x12},
+    {0x2120, 0x2122, 0, 0x12}, {0x2124, 0x2124, 0, 0x12}, {0x2126, 0x2126, 0, 0x17},
+    {0x2128, 0x2128, 0, 0x12}, {0x212A, 0x212B, 0, 0x17}, {0x212C, 0x212D, 0, 0x12},
+    {0x212F, 0x2131, 0, 0x12}, {0x2133, 0x2139, 0, 0x12}, {0x213B, 0x2140, 0, 0x12},
+    {0x2145, 0x2149, 0, 0x12}, {0x2150, 0x217F, 0, 0x12}, {0x2189, 0x2189, 0, 0x12},
+    {0x219A, 0x219B, 0, 0x03}, {0x21AE, 0x21AE, 0, 0x03}, {0x21CD, 0x21CF, 0, 0x03},
+    {0x2204, 0x2204, 0, 0x03}, {0x2209, 0x2209, 0, 0x03}, {0x220C, 0x220C, 0, 0x03},
+    {0x2224, 0x2224, 0, 0x03}, {0x2226, 0x2226, 0, 0x03}, {0x222C, 0x222D, 0, 0x12},
+    {0x222F, 0x2230, 0, 0x12}, {0x2241, 0x2241, 0, 0x03}, {0x2244, 0x2244, 0, 0x03},
+    {0x2247, 0x2247, 0, 0x03}, {0x2249, 0x2249, 0, 0x03}, {0x2260, 0x2260, 0, 0x03},
+    {0x2262, 0x2262, 0, 0x03}, {0x226D, 0x2271, 0, 0x03}, {0x2274, 0x2275, 0, 0x03},
+    {0x2278, 0x2279, 0, 0x03}, {0x2280, 0x2281, 0, 0x03}, {0x2284, 0x2285, 0, 0x03},
+    {0x2288, 0x2289, 0, 0x03}, {0x22AC, 0x22AF, 0, 0x03}, {0x22E0, 0x22E3, 0, 0x03},
+    {0x22EA, 0x22ED, 0, 0x03}, {0x2329, 0x232A, 0, 0x17}, {0x2460, 0x24EA, 0, 0x12},
+    {0x2A0C, 0x2A0C, 0, 0x12}, {0x2A74, 0x2A76, 0, 0x12}, {0x2ADC, 0x2ADC, 0, 0x17},
+    {0x2C7C, 0x2C7D, 0, 0x12}, {0x2CEF, 0x2CF1, 230, 0x00}, {0x2D6F, 0x2D6F, 0, 0x12},
+    {0x2D7F, 0x2D7F, 9, 0x00}, {0x2DE0, 0x2DFF, 230, 0x00}, {0x2E9F, 0x2E9F, 0, 0x12},
+    {0x2EF3, 0x2EF3, 0, 0x12}, {0x2F00, 0x2FD5, 0, 0x12}, {0x3000, 0x3000, 0, 0x12},
+    {0x302A, 0x302A, 218, 0x00}, {0x302B, 0x302B, 228, 0x00}, {0x302C, 0x302C, 232, 0x00},
+    {0x302D, 0x302D, 222, 0x00}, {0x302E, 0x302F, 224, 0x00}, {0x3036, 0x3036, 0, 0x12},
+    {0x3038, 0x303A, 0, 0x12}, {0x304C, 0x304C, 0, 0x03}, {0x304E, 0x304E, 0, 0x03},
+    {0x3050, 0x3050, 0, 0x03}, {0x3052, 0x3052, 0, 0x03}, {0x3054, 0x3054, 0, 0x03},
+    {0x3056, 0x3056, 0, 0x03}, {0x3058, 0x3058, 0, 0x03}, {0x305A, 0x305A, 0, 0x03},
+    {0x305C, 0x305C, 0, 0x03}, {0x305E, 0x305E, 0, 0x03}, {0x3060, 0x3060, 0, 0x03},
+    {0x3062, 0x3062, 0, 0x03}, {0x3065, 0x3065, 0, 0x03}, {0x3067, 0x3067, 0, 0x03},
+    {0x3069, 0x3069, 0, 0x03}, {0x3070, 0x3071, 0, 0x03}, {0x3073, 0x3074, 0, 0x03},
+    {0x3076, 0x3077, 0, 0x03}, {0x3079, 0x307A, 0, 0x03}, {0x307C, 0x307D, 0, 0x03},
+    {0x3094, 0x3094, 0, 0x03}, {0x3099, 0x309A, 8, 0x08}, {0x309B, 0x309C, 0, 0x12},
+    {0x309E, 0x309E, 0, 0x03}, {0x309F, 0x309F, 0, 0x12}, {0x30AC, 0x30AC, 0, 0x03},
+    {0x30AE, 0x30AE, 0, 0x03}, {0x30B0, 0x30B0, 0, 0x03}, {0x30B2, 0x30B2, 0, 0x03},
+    {0x30B4, 0x30B4, 0, 0x03}, {0x30B6, 0x30B6, 0, 0x03}, {0x30B8, 0x30B8, 0, 0x03},
+    {0x30BA, 0x30BA, 0, 0x03}, {0x30BC, 0x30BC, 0, 0x03}, {0x30BE, 0x30BE, 0, 0x03},
+    {0x30C0, 0x30C0, 0, 0x03}, {0x30C2, 0x30C2, 0, 0x03}, {0x30C5, 0x30C5, 0, 0x03},
+    {0x30C7, 0x30C7, 0, 0x03}, {0x30C9, 0x30C9, 0, 0x03}, {0x30D0, 0x30D1, 0, 0x03},
+    {0x30D3, 0x30D4, 0, 0x03}, {0x30D6, 0x30D7, 0, 0x03}, {0x30D9, 0x30DA, 0, 0x03},
+    {0x30DC, 0x30DD, 0, 0x03}, {0x30F4, 0x30F4, 0, 0x03}, {0x30F7, 0x30FA, 0, 0x03},
+    {0x30FE, 0x30FE, 0, 0x03}, {0x30FF, 0x30FF, 0, 0x12}, {0x3131, 0x318E, 0, 0x12},
+    {0x3192, 0x319F, 0, 0x12}, {0x3200, 0x321E, 0, 0x12}, {0x3220, 0x3247, 0, 0x12},
+    {0x3250, 0x327E, 0, 0x12}, {0x3280, 0x33FF, 0, 0x12}, {0xA66F, 0xA66F, 230, 0x00},
+    {0xA674, 0xA67D, 230, 0x00}, {0xA69C, 0xA69D, 0, 0x12}, {0xA69E, 0xA69F, 230, 0x00},
+    {0xA6F0, 0xA6F1, 230, 0x00}, {0xA770, 0xA770, 0, 0x12}, {0xA7F2, 0xA7F4, 0, 0x12},
+    {0xA7F8, 0xA7F9, 0, 0x12}, {0xA806, 0xA806, 9, 0x00}, {0xA82C, 0xA82C, 9, 0x00},
+    {0xA8C4, 0xA8C4, 9, 0x00}, {0xA8E0, 0xA8F1, 230, 0x00}, {0xA92B, 0xA92D, 220, 0x00},
+    {0xA953, 0xA953, 9, 0x00}, {0xA9B3, 0xA9B3, 7, 0x00}, {0xA9C0, 0xA9C0, 9, 0x00},
+    {0xAAB0, 0xAAB0, 230, 0x00}, {0xAAB2, 0xAAB3, 230, 0x00}, {0xAAB4, 0xAAB4, 220, 0x00},
+    {0xAAB7, 0xAAB8, 230, 0x00}, {0xAABE, 0xAABF, 230, 0x00}, {0xAAC1, 0xAAC1, 230, 0x00},
+    {0xAAF6, 0xAAF6, 9, 0x00}, {0xAB5C, 0xAB5F, 0, 0x12}, {0xAB69, 0xAB69, 0, 0x12},
+    {0xABED, 0xABED, 9, 0x00}, {0xAC00, 0xD7A3, 0, 0x03}, {0xF900, 0xFA0D, 0, 0x17},
+    {0xFA10, 0xFA10, 0, 0x17}, {0xFA12, 0xFA12, 0, 0x17}, {0xFA15, 0xFA1E, 0, 0x17},
+    {0xFA20, 0xFA20, 0, 0x17}, {0xFA22, 0xFA22, 0, 0x17}, {0xFA25, 0xFA26, 0, 0x17},
+    {0xFA2A, 0xFA6D, 0, 0x17}, {0xFA70, 0xFAD9, 0, 0x17}, {0xFB00, 0xFB06, 0, 0x12},
+    {0xFB13, 0xFB17, 0, 0x12}, {0xFB1D, 0xFB1D, 0, 0x17}, {0xFB1E, 0xFB1E, 26, 0x00},
+    {0xFB1F, 0xFB1F, 0, 0x17}, {0xFB20, 0xFB29, 0, 0x12}, {0xFB2A, 0xFB36, 0, 0x17},
+    {0xFB38, 0xFB3C, 0, 0x17}, {0xFB3E, 0xFB3E, 0, 0x17}, {0xFB40, 0xFB41, 0, 0x17},
+    {0xFB43, 0xFB44, 0, 0x17}, {0xFB46, 0xFB4E, 0, 0x17}, {0xFB4F, 0xFBB1, 0, 0x12},
+    {0xFBD3, 0xFD3D, 0, 0x12}, {0xFD50, 0xFD8F, 0, 0x12}, {0xFD92, 0xFDC7, 0, 0x12},
+    {0xFDF0, 0xFDFC, 0, 0x12}, {0xFE10, 0xFE19, 0, 0x12}, {0xFE20, 0xFE26, 230, 0x00},
+    {0xFE27, 0xFE2D, 220, 0x00}, {0xFE2E, 0xFE2F, 230, 0x00}, {0xFE30, 0xFE44, 0, 0x12},
+    {0xFE47, 0xFE52, 0, 0x12}, {0xFE54, 0xFE66, 0, 0x12}, {0xFE68, 0xFE6B, 0, 0x12},
+    {0xFE70, 0xFE72, 0, 0x12}, {0xFE74, 0xFE74, 0, 0x12}, {0xFE76, 0xFEFC, 0, 0x12},
+    {0xFF01, 0xFFBE, 0, 0x12}, {0xFFC2, 0xFFC7, 0, 0x12}, {0xFFCA, 0xFFCF, 0, 0x12},
+    {0xFFD2, 0xFFD7, 0, 0x12}, {0xFFDA, 0xFFDC, 0, 0x12}, {0xFFE0, 0xFFE6, 0, 0x12},
+    {0xFFE8, 0xFFEE, 0, 0x12}, {0x101FD, 0x101FD, 220, 0x00}, {0x102E0, 0x102E0, 220, 0x00},
+    {0x10376, 0x1037A, 230, 0x00}, {0x10781, 0x10785, 0, 0x12}, {0x10787, 0x107B0, 0, 0x12},
+    {0x107B2, 0x107BA, 0, 0x12}, {0x10A0D, 0x10A0D, 220, 0x00}, {0x10A0F, 0x10A0F, 230, 0x00},
+    {0x10A38, 0x10A38, 230, 0x00}, {0x10A39, 0x10A39, 1, 0x00}, {0x10A3A, 0x10A3A, 220, 0x00},
+    {0x10A3F, 0x10A3F, 9, 0x00}, {0x10AE5, 0x10AE5, 230, 0x00}, {0x10AE6, 0x10AE6, 220, 0x00},
+    {0x10D24, 0x10D27, 230, 0x00}, {0x10EAB, 0x10EAC, 230, 0x00}, {0x10F46, 0x10F47, 220, 0x00},
+    {0x10F48, 0x10F4A, 230, 0x00}, {0x10F4B, 0x10F4B, 220, 0x00}, {0x10F4C, 0x10F4C, 230, 0x00},
+    {0x10F4D, 0x10F50, 220, 0x00}, {0x10F82, 0x10F82, 230, 0x00}, {0x10F83, 0x10F83, 220, 0x00},
+    {0x10F84, 0x10F84, 230, 0x00}, {0x10F85, 0x10F85, 220, 0x00}, {0x11046, 0x11046, 9, 0x00},
+    {0x11070, 0x11070, 9, 0x00}, {0x1107F, 0x1107F, 9, 0x00}, {0x1109A, 0x1109A, 0, 0x03},
+    {0x1109C, 0x1109C, 0, 0x03}, {0x110AB, 0x110AB, 0, 0x03}, {0x110B9, 0x110B9, 9, 0x00},
+    {0x110BA, 0x110BA, 7, 0x08}, {0x11100, 0x11102, 230, 0x00}, {0x11127, 0x11127, 0, 0x08},
+    {0x1112E, 0x1112F, 0, 0x03}, {0x11133, 0x11134, 9, 0x00}, {0x11173, 0x11173, 7, 0x00},
+    {0x111C0, 0x111C0, 9, 0x00}, {0x111CA, 0x111CA, 7, 0x00}, {0x11235, 0x11235, 9, 0x00},
+    {0x11236, 0x11236, 7, 0x00}, {0x112E9, 0x112E9, 7, 0x00}, {0x112EA, 0x112EA, 9, 0x00},
+    {0x1133B, 0x1133C, 7, 0x00}, {0x1133E, 0x1133E, 0, 0x08}, {0x1134B, 0x1134C, 0, 0x03},
+    {0x1134D, 0x1134D, 9, 0x00}, {0x11357, 0x11357, 0, 0x08}, {0x11366, 0x1136C, 230, 0x00},
+    {0x11370, 0x11374, 230, 0x00}, {0x11442, 0x11442, 9, 0x00}, {0x11446, 0x11446, 7, 0x00},
+    {0x1145E, 0x1145E, 230, 0x00}, {0x114B0, 0x114B0, 0, 0x08}, {0x114BA, 0x114BA, 0, 0x08},
+    {0x114BB, 0x114BC, 0, 0x03}, {0x114BD, 0x114BD, 0, 0x08}, {0x114BE, 0x114BE, 0, 0x03},
+    {0x114C2, 0x114C2, 9, 0x00}, {0x114C3, 0x114C3, 7, 0x00}, {0x115AF, 0x115AF, 0, 0x08},
+    {0x115BA, 0x115BB, 0, 0x03}, {0x115BF, 0x115BF, 9, 0x00}, {0x115C0, 0x115C0, 7, 0x00},
+    {0x1163F, 0x1163F, 9, 0x00}, {0x116B6, 0x116B6, 9, 0x00}, {0x116B7, 0x116B7, 7, 0x00},
+    {0x1172B, 0x1172B, 9, 0x00}, {0x11839, 0x11839, 9, 0x00}, {0x1183A, 0x1183A, 7, 0x00},
+    {0x11930, 0x11930, 0, 0x08}, {0x11938, 0x11938, 0, 0x03}, {0x1193D, 0x1193E, 9, 0x00},
+    {0x11943, 0x11943, 7, 0x00}, {0x119E0, 0x119E0, 9, 0x00}, {0x11A34, 0x11A34, 9, 0x00},
+    {0x11A47, 0x11A47, 9, 0x00}, {0x11A99, 0x11A99, 9, 0x00}, {0x11C3F, 0x11C3F, 9, 0x00},
+    {0x11D42, 0x11D42, 7, 0x00}, {0x11D44, 0x11D45, 9, 0x00}, {0x11D97, 0x11D97, 9, 0x00},
+    {0x16AF0, 0x16AF4, 1, 0x00}, {0x16B30, 0x16B36, 230, 0x00}, {0x16FF0, 0x16FF1, 6, 0x00},
+    {0x1BC9E, 0x1BC9E, 1, 0x00}, {0x1D15E, 0x1D164, 0, 0x17}, {0x1D165, 0x1D166, 216, 0x00},
+    {0x1D167, 0x1D169, 1, 0x00}, {0x1D16D, 0x1D16D, 226, 0x00}, {0x1D16E, 0x1D172, 216, 0x00},
+    {0x1D17B, 0x1D182, 220, 0x00}, {0x1D185, 0x1D189, 230, 0x00}, {0x1D18A, 0x1D18B, 220, 0x00},
+    {0x1D1AA, 0x1D1AD, 230, 0x00}, {0x1D1BB, 0x1D1C0, 0, 0x17}, {0x1D242, 0x1D244, 230, 0x00},
+    {0x1D400, 0x1D454, 0, 0x12}, {0x1D456, 0x1D49C, 0, 0x12}, {0x1D49E, 0x1D49F, 0, 0x12},
+    {0x1D4A2, 0x1D4A2, 0, 0x12}, {0x1D4A5, 0x1D4A6, 0, 0x12}, {0x1D4A9, 0x1D4AC, 0, 0x12},
+    {0x1D4AE, 0x1D4B9, 0, 0x12}, {0x1D4BB, 0x1D4BB, 0, 0x12}, {0x1D4BD, 0x1D4C3, 0, 0x12},
+    {0x1D4C5, 0x1D505, 0, 0x12}, {0x1D507, 0x1D50A, 0, 0x12}, {0x1D50D, 0x1D514, 0, 0x12},
+    {0x1D516, 0x1D51C, 0, 0x12}, {0x1D51E, 0x1D539, 0, 0x12}, {0x1D53B, 0x1D53E, 0, 0x12},
+    {0x1D540, 0x1D544, 0, 0x12}, {0x1D546, 0x1D546, 0, 0x12}, {0x1D54A, 0x1D550, 0, 0x12},
+    {0x1D552, 0x1D6A5, 0, 0x12}, {0x1D6A8, 0x1D7CB, 0, 0x12}, {0x1D7CE, 0x1D7FF, 0, 0x12},
+    {0x1E000, 0x1E006, 230, 0x00}, {0x1E008, 0x1E018, 230, 0x00}, {0x1E01B, 0x1E021, 230, 0x00},
+    {0x1E023, 0x1E024, 230, 0x00}, {0x1E026, 0x1E02A, 230, 0x00}, {0x1E130, 0x1E136, 230, 0x00},
+    {0x1E2AE, 0x1E2AE, 230, 0x00}, {0x1E2EC, 0x1E2EF, 230, 0x00}, {0x1E8D0, 0x1E8D6, 220, 0x00},
+    {0x1E944, 0x1E949, 230, 0x00}, {0x1E94A, 0x1E94A, 7, 0x00}, {0x1EE00, 0x1EE03, 0, 0x12},
+    {0x1EE05, 0x1EE1F, 0, 0x12}, {0x1EE21, 0x1EE22, 0, 0x12}, {0x1EE24, 0x1EE24, 0, 0x12},
+    {0x1EE27, 0x1EE27, 0, 0x12}, {0x1EE29, 0x1EE32, 0, 0x12}, {0x1EE34, 0x1EE37, 0, 0x12},
+    {0x1EE39, 0x1EE39, 0, 0x12}, {0x1EE3B, 0x1EE3B, 0, 0x12}, {0x1EE42, 0x1EE42, 0, 0x12},
+    {0x1EE47, 0x1EE47, 0, 0x12}, {0x1EE49, 0x1EE49, 0, 0x12}, {0x1EE4B, 0x1EE4B, 0, 0x12},
+    {0x1EE4D, 0x1EE4F, 0, 0x12}, {0x1EE51, 0x1EE52, 0, 0x12}, {0x1EE54, 0x1EE54, 0, 0x12},
+    {0x1EE57, 0x1EE57, 0, 0x12}, {0x1EE59, 0x1EE59, 0, 0x12}, {0x1EE5B, 0x1EE5B, 0, 0x12},
+    {0x1EE5D, 0x1EE5D, 0, 0x12}, {0x1EE5F, 0x1EE5F, 0, 0x12}, {0x1EE61, 0x1EE62, 0, 0x12},
+    {0x1EE64, 0x1EE64, 0, 0x12}, {0x1EE67, 0x1EE6A, 0, 0x12}, {0x1EE6C, 0x1EE72, 0, 0x12},
+    {0x1EE74, 0x1EE77, 0, 0x12}, {0x1EE79, 0x1EE7C, 0, 0x12}, {0x1EE7E, 0x1EE7E, 0, 0x12},
+    {0x1EE80, 0x1EE89, 0, 0x12}, {0x1EE8B, 0x1EE9B, 0, 0x12}, {0x1EEA1, 0x1EEA3, 0, 0x12},
+    {0x1EEA5, 0x1EEA9, 0, 0x12}, {0x1EEAB, 0x1EEBB, 0, 0x12}, {0x1F100, 0x1F10A, 0, 0x12},
+    {0x1F110, 0x1F12E, 0, 0x12}, {0x1F130, 0x1F14F, 0, 0x12}, {0x1F16A, 0x1F16C, 0, 0x12},
+    {0x1F190, 0x1F190, 0, 0x12}, {0x1F200, 0x1F202, 0, 0x12}, {0x1F210, 0x1F23B, 0, 0x12},
+    {0x1F240, 0x1F248, 0, 0x12}, {0x1F250, 0x1F251, 0, 0x12}, {0x1FBF0, 0x1FBF9, 0, 0x12},
+    {0x2F800, 0x2FA1D, 0, 0x17},
+};
+
+static const utf8_decomp utf8_decomp_table[] = {
+    {0xA0, 0, 1, 1}, {0xA8, 1, 2, 1}, {0xAA, 3, 1, 1}, {0xAF, 4, 2, 1}, {0xB2, 6, 1, 1},
+    {0xB3, 7, 1, 1}, {0xB4, 8, 2, 1}, {0xB5, 10, 1, 1}, {0xB8, 11, 2, 1}, {0xB9, 13, 1, 1},
+    {0xBA, 14, 1, 1}, {0xBC, 15, 3, 1}, {0xBD, 18, 3, 1}, {0xBE, 21, 3, 1}, {0xC0, 24, 2, 0},
+    {0xC1, 26, 2, 0}, {0xC2, 28, 2, 0}, {0xC3, 30, 2, 0}, {0xC4, 32, 2, 0}, {0xC5, 34, 2, 0},
+    {0xC7, 36, 2, 0}, {0xC8, 38, 2, 0}, {0xC9, 40, 2, 0}, {0xCA, 42, 2, 0}, {0xCB, 44, 2, 0},
+    {0xCC, 46, 2, 0}, {0xCD, 48, 2, 0}, {0xCE, 50, 2, 0}, {0xCF, 52, 2, 0}, {0xD1, 54, 2, 0},
+    {0xD2, 56, 2, 0}, {0xD3, 58, 2, 0}, {0xD4, 60, 2, 0}, {0xD5, 62, 2, 0}, {0xD6, 64, 2, 0},
+    {0xD9, 66, 2, 0}, {0xDA, 68, 2, 0}, {0xDB, 70, 2, 0}, {0xDC, 72, 2, 0}, {0xDD, 74, 2, 0},
+    {0xE0, 76, 2, 0}, {0xE1, 78, 2, 0}, {0xE2, 80, 2, 0}, {0xE3, 82, 2, 0}, {0xE4, 84, 2, 0},
+    {0xE5, 86, 2, 0}, {0xE7, 88, 2, 0}, {0xE8, 90, 2, 0}, {0xE9, 92, 2, 0}, {0xEA, 94, 2, 0},
+    {0xEB, 96, 2, 0}, {0xEC, 98, 2, 0}, {0xED, 100, 2, 0}, {0xEE, 102, 2, 0}, {0xEF, 104, 2, 0},
+    {0xF1, 106, 2, 0}, {0xF2, 108, 2, 0}, {0xF3, 110, 2, 0}, {0xF4, 112, 2, 0}, {0xF5, 114, 2, 0},
+    {0xF6, 116, 2, 0}, {0xF9, 118, 2, 0}, {0xFA, 120, 2, 0}, {0xFB, 122, 2, 0}, {0xFC, 124, 2, 0},
+    {0xFD, 126, 2, 0}, {0xFF, 128, 2, 0}, {0x100, 130, 2, 0}, {0x101, 132, 2, 0}, {0x102, 134, 2, 0},
+    {0x103, 136, 2, 0}, {0x104, 138, 2, 0}, {0x105, 140, 2, 0}, {0x106, 142, 2, 0}, {0x107, 144, 2, 0},
+    {0x108, 146, 2, 0}, {0x109, 148, 2, 0}, {0x10A, 150, 2, 0}, {0x10B, 152, 2, 0}, {0x10C, 154, 2, 0},
+    {0x10D, 156, 2, 0}, {0x10E, 158, 2, 0}, {0x10F, 160, 2, 0}, {0x112, 162, 2, 0}, {0x113, 164, 2, 0},
+    {0x114, 166, 2, 0}, {0x115, 168, 2, 0}, {0x116, 170, 2, 0}, {0x117, 172, 2, 0}, {0x118, 174, 2, 0},
+    {0x119, 176, 2, 0}, {0x11A, 178, 2, 0}, {0x11B, 180, 2, 0}, {0x11C, 182, 2, 0}, {0x11D, 184, 2, 0},
+    {0x11E, 186, 2, 0}, {0x11F, 188, 2, 0}, {0x120, 190, 2, 0}, {0x121, 192, 2, 0}, {0x122, 194, 2, 0},
+    {0x123, 196, 2, 0}, {0x124, 198, 2, 0}, {0x125, 200, 2, 0}, {0x128, 202, 2, 0}, {0x129, 204, 2, 0},
+    {0x12A, 206, 2, 0}, {0x12B, 208, 2, 0}, {0x12C, 210, 2, 0}, {0x12D, 212, 2, 0}, {0x12E, 214, 2, 0},
+    {0x12F, 216, 2, 0}, {0x130, 218, 2, 0}, {0x132, 220, 2, 1}, {0x133, 222, 2, 1}, {0x134, 224, 2, 0},
+    {0x135, 226, 2, 0}, {0x136, 228, 2, 0}, {0x137, 230, 2, 0}, {0x139, 232, 2, 0}, {0x13A, 234, 2, 0},
+    {0x13B, 236, 2, 0}, {0x13C, 238, 2, 0}, {0x13D, 240, 2, 0}, {0x13E, 242, 2, 0}, {0x13F, 244, 2, 1},
+    {0x140, 246, 2, 1}, {0x143, 248, 2, 0}, {0x144, 250, 2, 0}, {0x145, 252, 2, 0}, {0x146, 254, 2, 0},
+    {0x147, 256, 2, 0}, {0x148, 258, 2, 0}, {0x149, 260, 2, 1}, {0x14C, 262, 2, 0}, {0x14D, 264, 2, 0},
+    {0x14E, 266, 2, 0}, {0x14F, 268, 2, 0}, {0x150, 270, 2, 0}, {0x151, 272, 2, 0}, {0x154, 274, 2, 0},
+    {0x155, 276, 2, 0}, {0x156, 278, 2, 0}, {0x157, 280, 2, 0}, {0x158, 282, 2, 0}, {0x159, 284, 2, 0},
+    {0x15A, 286, 2, 0}, {0x15B, 288, 2, 0}, {0x15C, 290, 2, 0}, {0x15D, 292, 2, 0}, {0x15E, 294, 2, 0},
+    {0x15F, 296, 2, 0}, {0x160, 298, 2, 0}, {0x161, 300, 2, 0}, {0x162, 302, 2, 0}, {0x163, 304, 2, 0},
+    {0x164, 306, 2, 0}, {0x165, 308, 2, 0}, {0x168, 310, 2, 0}, {0x169, 312, 2, 0}, {0x16A, 314, 2, 0},
+    {0x16B, 316, 2, 0}, {0x16C, 318, 2, 0}, {0x16D, 320, 2, 0}, {0x16E, 322, 2, 0}, {0x16F, 324, 2, 0},
+    {0x170, 326, 2, 0}, {0x171, 328, 2, 0}, {0x172, 330, 2, 0}, {0x173, 332, 2, 0}, {0x174, 334, 2, 0},
+    {0x175, 336, 2, 0}, {0x176, 338, 2, 0}, {0x177, 340, 2, 0}, {0x178, 342, 2, 0}, {0x179, 344, 2, 0},
+    {0x17A, 346, 2, 0}, {0x17B, 348, 2, 0}, {0x17C, 350, 2, 0}, {0x17D, 352, 2, 0}, {0x17E, 354, 2, 0},
+    {0x17F, 356, 1, 1}, {0x1A0, 357, 2, 0}, {0x1A1, 359, 2, 0}, {0x1AF, 361, 2, 0}, {0x1B0, 363, 2, 0},
+    {0x1C4, 365, 3, 1}, {0x1C5, 368, 3, 1}, {0x1C6, 371, 3, 1}, {0x1C7, 374, 2, 1}, {0x1C8, 376, 2, 1},
+    {0x1C9, 378, 2, 1}, {0x1CA, 380, 2, 1}, {0x1CB, 382, 2, 1}, {0x1CC, 384, 2, 1}, {0x1CD, 386, 2, 0},
+    {0x1CE, 388, 2, 0}, {0x1CF, 390, 2, 0}, {0x1D0, 392, 2, 0}, {0x1D1, 394, 2, 0}, {0x1D2, 396, 2, 0},
+    {0x1D3, 398, 2, 0}, {0x1D4, 400, 2, 0}, {0x1D5, 402, 3, 0}, {0x1D6, 405, 3, 0}, {0x1D7, 408, 3, 0},
+    {0x1D8, 411, 3, 0}, {0x1D9, 414, 3, 0}, {0x1DA, 417, 3, 0}, {0x1DB, 420, 3, 0}, {0x1DC, 423, 3, 0},
+    {0x1DE, 426, 3, 0}, {0x1DF, 429, 3, 0}, {0x1E0, 432, 3, 0}, {0x1E1, 435, 3, 0}, {0x1E2, 438, 2, 0},
+    {0x1E3, 440, 2, 0}, {0x1E6, 442, 2, 0}, {0x1E7, 444, 2, 0}, {0x1E8, 446, 2, 0}, {0x1E9, 448, 2, 0},
+    {0x1EA, 450, 2, 0}, {0x1EB, 452, 2, 0}, {0x1EC, 454, 3, 0}, {0x1ED, 457, 3, 0}, {0x1EE, 460, 2, 0},
+    {0x1EF, 462, 2, 0}, {0x1F0, 464, 2, 0}, {0x1F1, 466, 2, 1}, {0x1F2, 468, 2, 1}, {0x1F3, 470, 2, 1},
+    {0x1F4, 472, 2, 0}, {0x1F5, 474, 2, 0}, {0x1F8, 476, 2, 0}, {0x1F9, 478, 2, 0}, {0x1FA, 480, 3, 0},
+    {0x1FB, 483, 3, 0}, {0x1FC, 486, 2, 0}, {0x1FD, 488, 2, 0}, {0x1FE, 490, 2, 0}, {0x1FF, 492, 2, 0},
+    {0x200, 494, 2, 0}, {0x201, 496, 2, 0}, {0x202, 498, 2, 0}, {0x203, 500, 2, 0}, {0x204, 502, 2, 0},
+    {0x205, 504, 2, 0}, {0x206, 506, 2, 0}, {0x207, 508, 2, 0}, {0x208, 510, 2, 0}, {0x209, 512, 2, 0},
+    {0x20A, 514, 2, 0}, {0x20B, 516, 2, 0}, {0x20C, 518, 2, 0}, {0x20D, 520, 2, 0}, {0x20E, 522, 2, 0},
+    {0x20F, 524, 2, 0}, {0x210, 526, 2, 0}, {0x211, 528, 2, 0}, {0x212, 530, 2, 0}, {0x213, 532, 2, 0},
+    {0x214, 534, 2, 0}, {0x215, 536, 2, 0}, {0x216, 538, 2, 0}, {0x217, 540, 2, 0}, {0x218, 542, 2, 0},
+    {0x219, 544, 2, 0}, {0x21A, 546, 2, 0}, {0x21B, 548, 2, 0}, {0x21E, 550, 2, 0}, {0x21F, 552, 2, 0},
+    {0x226, 554, 2, 0}, {0x227, 556, 2, 0}, {0x228, 558, 2, 0}, {0x229, 560, 2, 0}, {0x22A, 562, 3, 0},
+    {0x22B, 565, 3, 0}, {0x22C, 568, 3, 0}, {0x22D, 571, 3, 0}, {0x22E, 574, 2, 0}, {0x22F, 576, 2, 0},
+    {0x230, 578, 3, 0}, {0x231, 581, 3, 0}, {0x232, 584, 2, 0}, {0x233, 586, 2, 0}, {0x2B0, 588, 1, 1},
+    {0x2B1, 589, 1, 1}, {0x2B2, 590, 1, 1}, {0x2B3, 591, 1, 1}, {0x2B4, 592, 1, 1}, {0x2B5, 593, 1, 1},
+    {0x2B6, 594, 1, 1}, {0x2B7, 595, 1, 1}, {0x2B8, 596, 1, 1}, {0x2D8, 597, 2, 1}, {0x2D9, 599, 2, 1},
+    {0x2DA, 601, 2, 1}, {0x2DB, 603, 2, 1}, {0x2DC, 605, 2, 1}, {0x2DD, 607, 2, 1}, {0x2E0, 609, 1, 1},
+    {0x2E1, 610, 1, 1}, {0x2E2, 611, 1, 1}, {0x2E3, 612, 1, 1}, {0x2E4, 613, 1, 1}, {0x340, 614, 1, 0},
+    {0x341, 615, 1, 0}, {0x343, 616, 1, 0}, {0x344, 617, 2, 0}, {0x374, 619, 1, 0}, {0x37A, 620, 2, 1},
+    {0x37E, 622, 1, 0}, {0x384, 623, 2, 1}, {0x385, 625, 2, 0}, {0x385, 627, 3, 1}, {0x386, 630, 2, 0},
+    {0x387, 632, 1, 0}, {0x388, 633, 2, 0}, {0x389, 635, 2, 0}, {0x38A, 637, 2, 0}, {0x38C, 639, 2, 0},
+    {0x38E, 641, 2, 0}, {0x38F, 643, 2, 0}, {0x390, 645, 3, 0}, {0x3AA, 648, 2, 0}, {0x3AB, 650, 2, 0},
+    {0x3AC, 652, 2, 0}, {0x3AD, 654, 2, 0}, {0x3AE, 656, 2, 0}, {0x3AF, 658, 2, 0}, {0x3B0, 660, 3, 0},
+    {0x3CA, 663, 2, 0}, {0x3CB, 665, 2, 0}, {0x3CC, 667, 2, 0}, {0x3CD, 669, 2, 0}, {0x3CE, 671, 2, 0},
+    {0x3D0, 673, 1, 1}, {0x3D1, 674, 1, 1}, {0x3D2, 675, 1, 1}, {0x3D3, 676, 2, 0}, {0x3D3, 678, 2, 1},
+    {0x3D4, 680, 2, 0}, {0x3D4, 682, 2, 1}, {0x3D5, 684, 1, 1}, {0x3D6, 685, 1, 1}, {0x3F0, 686, 1, 1},
+    {0x3F1, 687, 1, 1}, {0x3F2, 688, 1, 1}, {0x3F4, 689, 1, 1}, {0x3F5, 690, 1, 1}, {0x3F9, 691, 1, 1},
+    {0x400, 692, 2, 0}, {0x401, 694, 2, 0}, {0x403, 696, 2, 0}, {0x407, 698, 2, 0}, {0x40C, 700, 2, 0},
+    {0x40D, 702, 2, 0}, {0x40E, 704, 2, 0}, {0x419, 706, 2, 0}, {0x439, 708, 2, 0}, {0x450, 710, 2, 0},
+    {0x451, 712, 2, 0}, {0x453, 714, 2, 0}, {0x457, 716, 2, 0}, {0x45C, 718, 2, 0}, {0x45D, 720, 2, 0},
+    {0x45E, 722, 2, 0}, {0x476, 724, 2, 0}, {0x477, 726, 2, 0}, {0x4C1, 728, 2, 0}, {0x4C2, 730, 2, 0},
+    {0x4D0, 732, 2, 0}, {0x4D1, 734, 2, 0}, {0x4D2, 736, 2, 0}, {0x4D3, 738, 2, 0}, {0x4D6, 740, 2, 0},
+    {0x4D7, 742, 2, 0}, {0x4DA, 744, 2, 0}, {0x4DB, 746, 2, 0}, {0x4DC, 748, 2, 0}, {0x4DD, 750, 2, 0},
+    {0x4DE, 752, 2, 0}, {0x4DF, 754, 2, 0}, {0x4E2, 756, 2, 0}, {0x4E3, 758, 2, 0}, {0x4E4, 760, 2, 0},
+    {0x4E5, 762, 2, 0}, {0x4E6, 764, 2, 0}, {0x4E7, 766, 2, 0}, {0x4EA, 768, 2, 0}, {0x4EB, 770, 2, 0},
+    {0x4EC, 772, 2, 0}, {0x4ED, 774, 2, 0}, {0x4EE, 776, 2, 0}, {0x4EF, 778, 2, 0}, {0x4F0, 780, 2, 0},
+    {0x4F1, 782, 2, 0}, {0x4F2, 784, 2, 0}, {0x4F3, 786, 2, 0}, {0x4F4, 788, 2, 0}, {0x4F5, 790, 2, 0},
+    {0x4F8, 792, 2, 0}, {0x4F9, 794, 2, 0}, {0x587, 796, 2, 1}, {0x622, 798, 2, 0}, {0x623, 800, 2, 0},
+    {0x624, 802, 2, 0}, {0x625, 804, 2, 0}, {0x626, 806, 2, 0}, {0x675, 808, 2, 1}, {0x676, 810, 2, 1},
+    {0x677, 812, 2, 1}, {0x678, 814, 2, 1}, {0x6C0, 816, 2, 0}, {0x6C2, 818, 2, 0}, {0x6D3, 820, 2, 0},
+    {0x929, 822, 2, 0}, {0x931, 824, 2, 0}, {0x934, 826, 2, 0}, {0x958, 828, 2, 0}, {0x959, 830, 2, 0},
+    {0x95A, 832, 2, 0}, {0x95B, 834, 2, 0}, {0x95C, 836, 2, 0}, {0x95D, 838, 2, 0}, {0x95E, 840, 2, 0},
+    {0x95F, 842, 2, 0}, {0x9CB, 844, 2, 0}, {0x9CC, 846, 2, 0}, {0x9DC, 848, 2, 0}, {0x9DD, 850, 2, 0},
+    {0x9DF, 852, 2, 0}, {0xA33, 854, 2, 0}, {0xA36, 856, 2, 0}, {0xA59, 858, 2, 0}, {0xA5A, 860, 2, 0},
+    {0xA5B, 862, 2, 0}, {0xA5E, 864, 2, 0}, {0xB48, 866, 2, 0}, {0xB4B, 868, 2, 0}, {0xB4C, 870, 2, 0},
+    {0xB5C, 872, 2, 0}, {0xB5D, 874, 2, 0}, {0xB94, 876, 2, 0}, {0xBCA, 878, 2, 0}, {0xBCB, 880, 2, 0},
+    {0xBCC, 882, 2, 0}, {0xC48, 884, 2, 0}, {0xCC0, 886, 2, 0}, {0xCC7, 888, 2, 0}, {0xCC8, 890, 2, 0},
+    {0xCCA, 892, 2, 0}, {0xCCB, 894, 3, 0}, {0xD4A, 897, 2, 0}, {0xD4B, 899, 2, 0}, {0xD4C, 901, 2, 0},
+    {0xDDA, 903, 2, 0}, {0xDDC, 905, 2, 0}, {0xDDD, 907, 3, 0}, {0xDDE, 910, 2, 0}, {0xE33, 912, 2, 1},
+    {0xEB3, 914, 2, 1}, {0xEDC, 916, 2, 1}, {0xEDD, 918, 2, 1}, {0xF0C, 920, 1, 1}, {0xF43, 921, 2, 0},
+    {0xF4D, 923, 2, 0}, {0xF52, 925, 2, 0}, {0xF57, 927, 2, 0}, {0xF5C, 929, 2, 0}, {0xF69, 931, 2, 0},
+    {0xF73, 933, 2, 0}, {0xF75, 935, 2, 0}, {0xF76, 937, 2, 0}, {0xF77, 939, 3, 1}, {0xF78, 942, 2, 0},
+    {0xF79, 944, 3, 1}, {0xF81, 947, 2, 0}, {0xF93, 949, 2, 0}, {0xF9D, 951, 2, 0}, {0xFA2, 953, 2, 0},
+    {0xFA7, 955, 2, 0}, {0xFAC, 957, 2, 0}, {0xFB9, 959, 2, 0}, {0x1026, 961, 2, 0},
+    {0x10FC, 963, 1, 1}, {0x1B06, 964, 2, 0}, {0x1B08, 966, 2, 0}, {0x1B0A, 968, 2, 0},
+    {0x1B0C, 970, 2, 0}, {0x1B0E, 972, 2, 0}, {0x1B12, 974, 2, 0}, {0x1B3B, 976, 2, 0},
+    {0x1B3D, 978, 2, 0}, {0x1B40, 980, 2, 0}, {0x1B41, 982, 2, 0}, {0x1B43, 984, 2, 0},
+    {0x1D2C, 986, 1, 1}, {0x1D2D, 987, 1, 1}, {0x1D2E, 988, 1, 1}, {0x1D30, 989, 1, 1},
+    {0x1D31, 990, 1, 1}, {0x1D32, 991, 1, 1}, {0x1D33, 992, 1, 1}, {0x1D34, 993, 1, 1},
+    {0x1D35, 994, 1, 1}, {0x1D36, 995, 1, 1}, {0x1D37, 996, 1, 1}, {0x1D38, 997, 1, 1},
+    {0x1D39, 998, 1, 1}, {0x1D3A, 999, 1, 1}, {0x1D3C, 1000, 1, 1}, {0x1D3D, 1001, 1, 1},
+    {0x1D3E, 1002, 1, 1}, {0x1D3F, 1003, 1, 1}, {0x1D40, 1004, 1, 1}, {0x1D41, 1005, 1, 1},
+    {0x1D42, 1006, 1, 1}, {0x1D43, 1007, 1, 1}, {0x1D44, 1008, 1, 1}, {0x1D45, 1009, 1, 1},
+    {0x1D46, 1010, 1, 1}, {0x1D47, 1011, 1, 1}, {0x1D48, 1012, 1, 1}, {0x1D49, 1013, 1, 1},
+    {0x1D4A, 1014, 1, 1}, {0x1D4B, 1015, 1, 1}, {0x1D4C, 1016, 1, 1}, {0x1D4D, 1017, 1, 1},
+    {0x1D4F, 1018, 1, 1}, {0x1D50, 1019, 1, 1}, {0x1D51, 1020, 1, 1}, {0x1D52, 1021, 1, 1},
+    {0x1D53, 1022, 1, 1}, {0x1D54, 1023, 1, 1}, {0x1D55, 1024, 1, 1}, {0x1D56, 1025, 1, 1},
+    {0x1D57, 1026, 1, 1}, {0x1D58, 1027, 1, 1}, {0x1D59, 1028, 1, 1}, {0x1D5A, 1029, 1, 1},
+    {0x1D5B, 1030, 1, 1}, {0x1D5C, 1031, 1, 1}, {0x1D5D, 1032, 1, 1}, {0x1D5E, 1033, 1, 1},
+    {0x1D5F, 1034, 1, 1}, {0x1D60, 1035, 1, 1}, {0x1D61, 1036, 1, 1}, {0x1D62, 1037, 1, 1},
+    {0x1D63, 1038, 1, 1}, {0x1D64, 1039, 1, 1}, {0x1D65, 1040, 1, 1}, {0x1D66, 1041, 1, 1},
+    {0x1D67, 1042, 1, 1}, {0x1D68, 1043, 1, 1}, {0x1D69, 1044, 1, 1}, {0x1D6A, 1045, 1, 1},
+    {0x1D78, 1046, 1, 1}, {0x1D9B, 1047, 1, 1}, {0x1D9C, 1048, 1, 1}, {0x1D9D, 1049, 1, 1},
+    {0x1D9E, 1050, 1, 1}, {0x1D9F, 1051, 1, 1}, {0x1DA0, 1052, 1, 1}, {0x1DA1, 1053, 1, 1},
+    {0x1DA2, 1054, 1, 1}, {0x1DA3, 1055, 1, 1}, {0x1DA4, 1056, 1, 1}, {0x1DA5, 1057, 1, 1},
+    {0x1DA6, 1058, 1, 1}, {0x1DA7, 1059, 1, 1}, {0x1DA8, 1060, 1, 1}, {0x1DA9, 1061, 1, 1},
+    {0x1DAA, 1062, 1, 1}, {0x1DAB, 1063, 1, 1}, {0x1DAC, 1064, 1, 1}, {0x1DAD, 1065, 1, 1},
+    {0x1DAE, 1066, 1, 1}, {0x1DAF, 1067, 1, 1}, {0x1DB0, 1068, 1, 1}, {0x1DB1, 1069, 1, 1},
+    {0x1DB2, 1070, 1, 1}, {0x1DB3, 1071, 1, 1}, {0x1DB4, 1072, 1, 1}, {0x1DB5, 1073, 1, 1},
+    {0x1DB6, 1074, 1, 1}, {0x1DB7, 1075, 1, 1}, {0x1DB8, 1076, 1, 1}, {0x1DB9, 1077, 1, 1},
+    {0x1DBA, 1078, 1, 1}, {0x1DBB, 1079, 1, 1}, {0x1DBC, 1080, 1, 1}, {0x1DBD, 1081, 1, 1},
+    {0x1DBE, 1082, 1, 1}, {0x1DBF, 1083, 1, 1}, {0x1E00, 1084, 2, 0}, {0x1E01, 1086, 2, 0},
+    {0x1E02, 1088, 2, 0}, {0x1E03, 1090, 2, 0}, {0x1E04, 1092, 2, 0}, {0x1E05, 1094, 2, 0},
+    {0x1E06, 1096, 2, 0}, {0x1E07, 1098, 2, 0}, {0x1E08, 1100, 3, 0}, {0x1E09, 1103, 3, 0},
+    {0x1E0A, 1106, 2, 0}, {0x1E0B, 1108, 2, 0}, {0x1E0C, 1110, 2, 0}, {0x1E0D, 1112, 2, 0},
+    {0x1E0E, 1114, 2, 0}, {0x1E0F, 1116, 2, 0}, {0x1E10, 1118, 2, 0}, {0x1E11, 1120, 2, 0},
+    {0x1E12, 1122, 2, 0}, {0x1E13, 1124, 2, 0}, {0x1E14, 1126, 3, 0}, {0x1E15, 1129, 3, 0},
+    {0x1E16, 1132, 3, 0}, {0x1E17, 1135, 3, 0}, {0x1E18, 1138, 2, 0}, {0x1E19, 1140, 2, 0},
+    {0x1E1A, 1142, 2, 0}, {0x1E1B, 1144, 2, 0}, {0x1E1C, 1146, 3, 0}, {0x1E1D, 1149, 3, 0},
+    {0x1E1E, 1152, 2, 0}, {0x1E1F, 1154, 2, 0}, {0x1E20, 1156, 2, 0}, {0x1E21, 1158, 2, 0},
+    {0x1E22, 1160, 2, 0}, {0x1E23, 1162, 2, 0}, {0x1E24, 1164, 2, 0}, {0x1E25, 1166, 2, 0},
+    {0x1E26, 1168, 2, 0}, {0x1E27, 1170, 2, 0}, {0x1E28, 1172, 2, 0}, {0x1E29, 1174, 2, 0},
+    {0x1E2A, 1176, 2, 0}, {0x1E2B, 1178, 2, 0}, {0x1E2C, 1180, 2, 0}, {0x1E2D, 1182, 2, 0},
+    {0x1E2E, 1184, 3, 0}, {0x1E2F, 1187, 3, 0}, {0x1E30, 1190, 2, 0}, {0x1E31, 1192, 2, 0},
+    {0x1E32, 1194, 2, 0}, {0x1E33, 1196, 2, 0}, {0x1E34, 1198, 2, 0}, {0x1E35, 1200, 2, 0},
+    {0x1E36, 1202, 2, 0}, {0x1E37, 1204, 2, 0}, {0x1E38, 1206, 3, 0}, {0x1E39, 1209, 3, 0},
+    {0x1E3A, 1212, 2, 0}, {0x1E3B, 1214, 2, 0}, {0x1E3C, 1216, 2, 0}, {0x1E3D, 1218, 2, 0},
+    {0x1E3E, 1220, 2, 0}, {0x1E3F, 1222, 2, 0}, {0x1E40, 1224, 2, 0}, {0x1E41, 1226, 2, 0},
+    {0x1E42, 1228, 2, 0}, {0x1E43, 1230, 2, 0}, {0x1E44, 1232, 2, 0}, {0x1E45, 1234, 2, 0},
+    {0x1E46, 1236, 2, 0}, {0x1E47, 1238, 2, 0}, {0x1E48, 1240, 2, 0}, {0x1E49, 1242, 2, 0},
+    {0x1E4A, 1244, 2, 0}, {0x1E4B, 1246, 2, 0}, {0x1E4C, 1248, 3, 0}, {0x1E4D, 1251, 3, 0},
+    {0x1E4E, 1254, 3, 0}, {0x1E4F, 1257, 3, 0}, {0x1E50, 1260, 3, 0}, {0x1E51, 1263, 3, 0},
+    {0x1E52, 1266, 3, 0}, {0x1E53, 1269, 3, 0}, {0x1E54, 1272, 2, 0}, {0x1E55, 1274, 2, 0},
+    {0x1E56, 1276, 2, 0}, {0x1E57, 1278, 2, 0}, {0x1E58, 1280, 2, 0}, {0x1E59, 1282, 2, 0},
+    {0x1E5A, 1284, 2, 0}, {0x1E5B, 1286, 2, 0}, {0x1E5C, 1288, 3, 0}, {0x1E5D, 1291, 3, 0},
+    {0x1E5E, 1294, 2, 0}, {0x1E5F, 1296, 2, 0}, {0x1E60, 1298, 2, 0}, {0x1E61, 1300, 2, 0},
+    {0x1E62, 1302, 2, 0}, {0x1E63, 1304, 2, 0}, {0x1E64, 1306, 3, 0}, {0x1E65, 1309, 3, 0},
+    {0x1E66, 1312, 3, 0}, {0x1E67, 1315, 3, 0}, {0x1E68, 1318, 3, 0}, {0x1E69, 1321, 3, 0},
+    {0x1E6A, 1324, 2, 0}, {0x1E6B, 1326, 2, 0}, {0x1E6C, 1328, 2, 0}, {0x1E6D, 1330, 2, 0},
+    {0x1E6E, 1332, 2, 0}, {0x1E6F, 1334, 2, 0}, {0x1E70, 1336, 2, 0}, {0x1E71, 1338, 2, 0},
+    {0x1E72, 1340, 2, 0}, {0x1E73, 1342, 2, 0}, {0x1E74, 1344, 2, 0}, {0x1E75, 1346, 2, 0},
+    {0x1E76, 1348, 2, 0}, {0x1E77, 1350, 2, 0}, {0x1E78, 1352, 3, 0}, {0x1E79, 1355, 3, 0},
+    {0x1E7A, 1358, 3, 0}, {0x1E7B, 1361, 3, 0}, {0x1E7C, 1364, 2, 0}, {0x1E7D, 1366, 2, 0},
+    {0x1E7E, 1368, 2, 0}, {0x1E7F, 1370, 2, 0}, {0x1E80, 1372, 2, 0}, {0x1E81, 1374, 2, 0},
+    {0x1E82, 1376, 2, 0}, {0x1E83, 1378, 2, 0}, {0x1E84, 1380, 2, 0}, {0x1E85, 1382, 2, 0},
+    {0x1E86, 1384, 2, 0}, {0x1E87, 1386, 2, 0}, {0x1E88, 1388, 2, 0}, {0x1E89, 1390, 2, 0},
+    {0x1E8A, 1392, 2, 0}, {0x1E8B, 1394, 2, 0}, {0x1E8C, 1396, 2, 0}, {0x1E8D, 1398, 2, 0},
+    {0x1E8E, 1400, 2, 0}, {0x1E8F, 1402, 2, 0}, {0x1E90, 1404, 2, 0}, {0x1E91, 1406, 2, 0},
+    {0x1E92, 1408, 2, 0}, {0x1E93, 1410, 2, 0}, {0x1E94, 1412, 2, 0}, {0x1E95, 1414, 2, 0},
+    {0x1E96, 1416, 2, 0}, {0x1E97, 1418, 2, 0}, {0x1E98, 1420, 2, 0}, {0x1E99, 1422, 2, 0},
+    {0x1E9A, 1424, 2, 1}, {0x1E9B, 1426, 2, 0}, {0x1E9B, 1428, 2, 1}, {0x1EA0, 1430, 2, 0},
+    {0x1EA1, 1432, 2, 0}, {0x1EA2, 1434, 2, 0}, {0x1EA3, 1436, 2, 0}, {0x1EA4, 1438, 3, 0},
+    {0x1EA5, 1441, 3, 0}, {0x1EA6, 1444, 3, 0}, {0x1EA7, 1447, 3, 0}, {0x1EA8, 1450, 3, 0},
+    {0x1EA9, 1453, 3, 0}, {0x1EAA, 1456, 3, 0}, {0x1EAB, 1459, 3, 0}, {0x1EAC, 1462, 3, 0},
+    {0x1EAD, 1465, 3, 0}, {0x1EAE, 1468, 3, 0}, {0x1EAF, 1471, 3, 0}, {0x1EB0, 1474, 3, 0},
+    {0x1EB1, 1477, 3, 0}, {0x1EB2, 1480, 3, 0}, {0x1EB3, 1483, 3, 0}, {0x1EB4, 1486, 3, 0},
+    {0x1EB5, 1489, 3, 0}, {0x1EB6, 1492, 3, 0}, {0x1EB7, 1495, 3, 0}, {0x1EB8, 1498, 2, 0},
+    {0x1EB9, 1500, 2, 0}, {0x1EBA, 1502, 2, 0}, {0x1EBB, 1504, 2, 0}, {0x1EBC, 1506, 2, 0},
+    {0x1EBD, 1508, 2, 0}, {0x1EBE, 1510, 3, 0}, {0x1EBF, 1513, 3, 0}, {0x1EC0, 1516, 3, 0},
+    {0x1EC1, 1519, 3, 0}, {0x1EC2, 1522, 3, 0}, {0x1EC3, 1525, 3, 0}, {0x1EC4, 1528, 3, 0},
+    {0x1EC5, 1531, 3, 0}, {0x1EC6, 1534, 3, 0}, {0x1EC7, 1537, 3, 0}, {0x1EC8, 1540, 2, 0},
+    {0x1EC9, 1542, 2, 0}, {0x1ECA, 1544, 2, 0}, {0x1ECB, 1546, 2, 0}, {0x1ECC, 1548, 2, 0},
+    {0x1ECD, 1550, 2, 0}, {0x1ECE, 1552, 2, 0}, {0x1ECF, 1554, 2, 0}, {0x1ED0, 1556, 3, 0},
+    {0x1ED1, 1559, 3, 0}, {0x1ED2, 1562, 3, 0}, {0x1ED3, 1565, 3, 0}, {0x1ED4, 1568, 3, 0},
+    {0x1ED5, 1571, 3, 0}, {0x1ED6, 1574, 3, 0}, {0x1ED7, 1577, 3, 0}, {0x1ED8, 1580, 3, 0},
+    {0x1ED9, 1583, 3, 0}, {0x1EDA, 1586, 3, 0}, {0x1EDB, 1589, 3, 0}, {0x1EDC, 1592, 3, 0},
+    {0x1EDD, 1595, 3, 0}, {0x1EDE, 1598, 3, 0}, {0x1EDF, 1601, 3, 0}, {0x1EE0, 1604, 3, 0},
+    {0x1EE1, 1607, 3, 0}, {0x1EE2, 1610, 3, 0}, {0x1EE3, 1613, 3, 0}, {0x1EE4, 1616, 2, 0},
+    {0x1EE5, 1618, 2, 0}, {0x1EE6, 1620, 2, 0}, {0x1EE7, 1622, 2, 0}, {0x1EE8, 1624, 3, 0},
+    {0x1EE9, 1627, 3, 0}, {0x1EEA, 1630, 3, 0}, {0x1EEB, 1633, 3, 0}, {0x1EEC, 1636, 3, 0},
+    {0x1EED, 1639, 3, 0}, {0x1EEE, 1642, 3, 0}, {0x1EEF, 1645, 3, 0}, {0x1EF0, 1648, 3, 0},
+    {0x1EF1, 1651, 3, 0}, {0x1EF2, 1654, 2, 0}, {0x1EF3, 1656, 2, 0}, {0x1EF4, 1658, 2, 0},
+    {0x1EF5, 1660, 2, 0}, {0x1EF6, 1662, 2, 0}, {0x1EF7, 1664, 2, 0}, {0x1EF8, 1666, 2, 0},
+    {0x1EF9, 1668, 2, 0}, {0x1F00, 1670, 2, 0}, {0x1F01, 1672, 2, 0}, {0x1F02, 1674, 3, 0},
+    {0x1F03, 1677, 3, 0}, {0x1F04, 1680, 3, 0}, {0x1F05, 1683, 3, 0}, {0x1F06, 1686, 3, 0},
+    {0x1F07, 1689, 3, 0}, {0x1F08, 1692, 2, 0}, {0x1F09, 1694, 2, 0}, {0x1F0A, 1696, 3, 0},
+    {0x1F0B, 1699, 3, 0}, {0x1F0C, 1702, 3, 0}, {0x1F0D, 1705, 3, 0}, {0x1F0E, 1708, 3, 0},
+    {0x1F0F, 1711, 3, 0}, {0x1F10, 1714, 2, 0}, {0x1F11, 1716, 2, 0}, {0x1F12, 1718, 3, 0},
+    {0x1F13, 1721, 3, 0}, {0x1F14, 1724, 3, 0}, {0x1F15, 1727, 3, 0}, {0x1F18, 1730, 2, 0},
+    {0x1F19, 1732, 2, 0}, {0x1F1A, 1734, 3, 0}, {0x1F1B, 1737, 3, 0}, {0x1F1C, 1740, 3, 0},
+    {0x1F1D, 1743, 3, 0}, {0x1F20, 1746, 2, 0}, {0x1F21, 1748, 2, 0}, {0x1F22, 1750, 3, 0},
+    {0x1F23, 1753, 3, 0}, {0x1F24, 1756, 3, 0}, {0x1F25, 1759, 3, 0}, {0x1F26, 1762, 3, 0},
+    {0x1F27, 1765, 3, 0}, {0x1F28, 1768, 2, 0}, {0x1F29, 1770, 2, 0}, {0x1F2A, 1772, 3, 0},
+    {0x1F2B, 1775, 3, 0}, {0x1F2C, 1778, 3, 0}, {0x1F2D, 1781, 3, 0}, {0x1F2E, 1784, 3, 0},
+    {0x1F2F, 1787, 3, 0}, {0x1F30, 1790, 2, 0}, {0x1F31, 1792, 2, 0}, {0x1F32, 1794, 3, 0},
+    {0x1F33, 1797, 3, 0}, {0x1F34, 1800, 3, 0}, {0x1F35, 1803, 3, 0}, {0x1F36, 1806, 3, 0},
+    {0x1F37, 1809, 3, 0}, {0x1F38, 1812, 2, 0}, {0x1F39, 1814, 2, 0}, {0x1F3A, 1816, 3, 0},
+    {0x1F3B, 1819, 3, 0}, {0x1F3C, 1822, 3, 0}, {0x1F3D, 1825, 3, 0}, {0x1F3E, 1828, 3, 0},
+    {0x1F3F, 1831, 3, 0}, {0x1F40, 1834, 2, 0}, {0x1F41, 1836, 2, 0}, {0x1F42, 1838, 3, 0},
+    {0x1F43, 1841, 3, 0}, {0x1F44, 1844, 3, 0}, {0x1F45, 1847, 3, 0}, {0x1F48, 1850, 2, 0},
+    {0x1F49, 1852, 2, 0}, {0x1F4A, 1854, 3, 0}, {0x1F4B, 1857, 3, 0}, {0x1F4C, 1860, 3, 0},
+    {0x1F4D, 1863, 3, 0}, {0x1F50, 1866, 2, 0}, {0x1F51, 1868, 2, 0}, {0x1F52, 1870, 3, 0},
+    {0x1F53, 1873, 3, 0}, {0x1F54, 1876, 3, 0}, {0x1F55, 1879, 3, 0}, {0x1F56, 1882, 3, 0},
+    {0x1F57, 1885, 3, 0}, {0x1F59, 1888, 2, 0}, {0x1F5B, 1890, 3, 0}, {0x1F5D, 1893, 3, 0},
+    {0x1F5F, 1896, 3, 0}, {0x1F60, 1899, 2, 0}, {0x1F61, 1901, 2, 0}, {0x1F62, 1903, 3, 0},
+    {0x1F63, 1906, 3, 0}, {0x1F64, 1909, 3, 0}, {0x1F65, 1912, 3, 0}, {0x1F66, 1915, 3, 0},
+    {0x1F67, 1918, 3, 0}, {0x1F68, 1921, 2, 0}, {0x1F69, 1923, 2, 0}, {0x1F6A, 1925, 3, 0},
+    {0x1F6B, 1928, 3, 0}, {0x1F6C, 1931, 3, 0}, {0x1F6D, 1934, 3, 0}, {0x1F6E, 1937, 3, 0},
+    {0x1F6F, 1940, 3, 0}, {0x1F70, 1943, 2, 0}, {0x1F71, 1945, 2, 0}, {0x1F72, 1947, 2, 0},
+    {0x1F73, 1949, 2, 0}, {0x1F74, 1951, 2, 0}, {0x1F75, 1953, 2, 0}, {0x1F76, 1955, 2, 0},
+    {0x1F77, 1957, 2, 0}, {0x1F78, 1959, 2, 0}, {0x1F79, 1961, 2, 0}, {0x1F7A, 1963, 2, 0},
+    {0x1F7B, 1965, 2, 0}, {0x1F7C, 1967, 2, 0}, {0x1F7D, 1969, 2, 0}, {0x1F80, 1971, 3, 0},
+    {0x1F81, 1974, 3, 0}, {0x1F82, 1977, 4, 0}, {0x1F83, 1981, 4, 0}, {0x1F84, 1985, 4, 0},
+    {0x1F85, 1989, 4, 0}, {0x1F86, 1993, 4, 0}, {0x1F87, 1997, 4, 0}, {0x1F88, 2001, 3, 0},
+    {0x1F89, 2004, 3, 0}, {0x1F8A, 2007, 4, 0}, {0x1F8B, 2011, 4, 0}, {0x1F8C, 2015, 4, 0},
+    {0x1F8D, 2019, 4, 0}, {0x1F8E, 2023, 4, 0}, {0x1F8F, 2027, 4, 0}, {0x1F90, 2031, 3, 0},
+    {0x1F91, 2034, 3, 0}, {0x1F92, 2037, 4, 0}, {0x1F93, 2041, 4, 0}, {0x1F94, 2045, 4, 0},
+    {0x1F95, 2049, 4, 0}, {0x1F96, 2053, 4, 0}, {0x1F97, 2057, 4, 0}, {0x1F98, 2061, 3, 0},
+    {0x1F99, 2064, 3, 0}, {0x1F9A, 2067, 4, 0}, {0x1F9B, 2071, 4, 0}, {0x1F9C, 2075, 4, 0},
+    {0x1F9D, 2079, 4, 0}, {0x1F9E, 2083, 4, 0}, {0x1F9F, 2087, 4, 0}, {0x1FA0, 2091, 3, 0},
+    {0x1FA1, 2094, 3, 0}, {0x1FA2, 2097, 4, 0}, {0x1FA3, 2101, 4, 0}, {0x1FA4, 2105, 4, 0},
+    {0x1FA5, 2109, 4, 0}, {0x1FA6, 2113, 4, 0}, {0x1FA7, 2117, 4, 0}, {0x1FA8, 2121, 3, 0},
+    {0x1FA9, 2124, 3, 0}, {0x1FAA, 2127, 4, 0}, {0x1FAB, 2131, 4, 0}, {0x1FAC, 2135, 4, 0},
+    {0x1FAD, 2139, 4, 0}, {0x1FAE, 2143, 4, 0}, {0x1FAF, 2147, 4, 0}, {0x1FB0, 2151, 2, 0},
+    {0x1FB1, 2153, 2, 0}, {0x1FB2, 2155, 3, 0}, {0x1FB3, 2158, 2, 0}, {0x1FB4, 2160, 3, 0},
+    {0x1FB6, 2163, 2, 0}, {0x1FB7, 2165, 3, 0}, {0x1FB8, 2168, 2, 0}, {0x1FB9, 2170, 2, 0},
+    {0x1FBA, 2172, 2, 0}, {0x1FBB, 2174, 2, 0}, {0x1FBC, 2176, 2, 0}, {0x1FBD, 2178, 2, 1},
+    {0x1FBE, 2180, 1, 0}, {0x1FBF, 2181, 2, 1}, {0x1FC0, 2183, 2, 1}, {0x1FC1, 2185, 2, 0},
+    {0x1FC1, 2187, 3, 1}, {0x1FC2, 2190, 3, 0}, {0x1FC3, 2193, 2, 0}, {0x1FC4, 2195, 3, 0},
+    {0x1FC6, 2198, 2, 0}, {0x1FC7, 2200, 3, 0}, {0x1FC8, 2203, 2, 0}, {0x1FC9, 2205, 2, 0},
+    {0x1FCA, 2207, 2, 0}, {0x1FCB, 2209, 2, 0}, {0x1FCC, 2211, 2, 0}, {0x1FCD, 2213, 2, 0},
+    {0x1FCD, 2215, 3, 1}, {0x1FCE, 2218, 2, 0}, {0x1FCE, 2220, 3, 1}, {0x1FCF, 2223, 2, 0},
+    {0x1FCF, 2225, 3, 1}, {0x1FD0, 2228, 2, 0}, {0x1FD1, 2230, 2, 0}, {0x1FD2, 2232, 3, 0},
+    {0x1FD3, 2235, 3, 0}, {0x1FD6, 2238, 2, 0}, {0x1FD7, 2240, 3, 0}, {0x1FD8, 2243, 2, 0},
+    {0x1FD9, 2245, 2, 0}, {0x1FDA, 2247, 2, 0}, {0x1FDB, 2249, 2, 0}, {0x1FDD, 2251, 2, 0},
+    {0x1FDD, 2253, 3, 1}, {0x1FDE, 2256, 2, 0}, {0x1FDE, 2258, 3, 1}, {0x1FDF, 2261, 2, 0},
+    {0x1FDF, 2263, 3, 1}, {0x1FE0, 2266, 2, 0}, {0x1FE1, 2268, 2, 0}, {0x1FE2, 2270, 3, 0},
+    {0x1FE3, 2273, 3, 0}, {0x1FE4, 2276, 2, 0}, {0x1FE5, 2278, 2, 0}, {0x1FE6, 2280, 2, 0},
+    {0x1FE7, 2282, 3, 0}, {0x1FE8, 2285, 2, 0}, {0x1FE9, 2287, 2, 0}, {0x1FEA, 2289, 2, 0},
+    {0x1FEB, 2291, 2, 0}, {0x1FEC, 2293, 2, 0}, {0x1FED, 2295, 2, 0}, {0x1FED, 2297, 3, 1},
+    {0x1FEE, 2300, 2, 0}, {0x1FEE, 2302, 3, 1}, {0x1FEF, 2305, 1, 0}, {0x1FF2, 2306, 3, 0},
+    {0x1FF3, 2309, 2, 0}, {0x1FF4, 2311, 3, 0}, {0x1FF6, 2314, 2, 0}, {0x1FF7, 2316, 3, 0},
+    {0x1FF8, 2319, 2, 0}, {0x1FF9, 2321, 2, 0}, {0x1FFA, 2323, 2, 0}, {0x1FFB, 2325, 2, 0},
+    {0x1FFC, 2327, 2, 0}, {0x1FFD, 2329, 1, 0}, {0x1FFD, 2330, 2, 1}, {0x1FFE, 2332, 2, 1},
+    {0x2000, 2334, 1, 0}, {0x2000, 2335, 1, 1}, {0x2001, 2336, 1, 0}, {0x2001, 2337, 1, 1},
+    {0x2002, 2338, 1, 1}, {0x2003, 2339, 1, 1}, {0x2004, 2340, 1, 1}, {0x2005, 2341, 1, 1},
+    {0x2006, 2342, 1, 1}, {0x2007, 2343, 1, 1}, {0x2008, 2344, 1, 1}, {0x2009, 2345, 1, 1},
+    {0x200A, 2346, 1, 1}, {0x2011, 2347, 1, 1}, {0x2017, 2348, 2, 1}, {0x2024, 2350, 1, 1},
+    {0x2025, 2351, 2, 1}, {0x2026, 2353, 3, 1}, {0x202F, 2356, 1, 1}, {0x2033, 2357, 2, 1},
+    {0x2034, 2359, 3, 1}, {0x2036, 2362, 2, 1}, {0x2037, 2364, 3, 1}, {0x203C, 2367, 2, 1},
+    {0x203E, 2369, 2, 1}, {0x2047, 2371, 2, 1}, {0x2048, 2373, 2, 1}, {0x2049, 2375, 2, 1},
+    {0x2057, 2377, 4, 1}, {0x205F, 2381, 1, 1}, {0x2070, 2382, 1, 1}, {0x2071, 2383, 1, 1},
+    {0x2074, 2384, 1, 1}, {0x2075, 2385, 1, 1}, {0x2076, 2386, 1, 1}, {0x2077, 2387, 1, 1},
+    {0x2078, 2388, 1, 1}, {0x2079, 2389, 1, 1}, {0x207A, 2390, 1, 1}, {0x207B, 2391, 1, 1},
+    {0x207C, 2392, 1, 1}, {0x207D, 2393, 1, 1}, {0x207E, 2394, 1, 1}, {0x207F, 2395, 1, 1},
+    {0x2080, 2396, 1, 1}, {0x2081, 2397, 1, 1}, {0x2082, 2398, 1, 1}, {0x2083, 2399, 1, 1},
+    {0x2084, 2400, 1, 1}, {0x2085, 2401, 1, 1}, {0x2086, 2402, 1, 1}, {0x2087, 2403, 1, 1},
+    {0x2088, 2404, 1, 1}, {0x2089, 2405, 1, 1}, {0x208A, 2406, 1, 1}, {0x208B, 2407, 1, 1},
+    {0x208C, 2408, 1, 1}, {0x208D, 2409, 1, 1}, {0x208E, 2410, 1, 1}, {0x2090, 2411, 1, 1},
+    {0x2091, 2412, 1, 1}, {0x2092, 2413, 1, 1}, {0x2093, 2414, 1, 1}, {0x2094, 2415, 1, 1},
+    {0x2095, 2416, 1, 1}, {0x2096, 2417, 1, 1}, {0x2097, 2418, 1, 1}, {0x2098, 2419, 1, 1},
+    {0x2099, 2420, 1, 1}, {0x209A, 2421, 1, 1}, {0x209B, 2422, 1, 1}, {0x209C, 2423, 1, 1},
+    {0x20A8, 2424, 2, 1}, {0x2100, 2426, 3, 1}, {0x2101, 2429, 3, 1}, {0x2102, 2432, 1, 1},
+    {0x2103, 2433, 2, 1}, {0x2105, 2435, 3, 1}, {0x2106, 2438, 3, 1}, {0x2107, 2441, 1, 1},
+    {0x2109, 2442, 2, 1}, {0x210A, 2444, 1, 1}, {0x210B, 2445, 1, 1}, {0x210C, 2446, 1, 1},
+    {0x210D, 2447, 1, 1}, {0x210E, 2448, 1, 1}, {0x210F, 2449, 1, 1}, {0x2110, 2450, 1, 1},
+    {0x2111, 2451, 1, 1}, {0x2112, 2452, 1, 1}, {0x2113, 2453, 1, 1}, {0x2115, 2454, 1, 1},
+    {0x2116, 2455, 2, 1}, {0x2119, 2457, 1, 1}, {0x211A, 2458, 1, 1}, {0x211B, 2459, 1, 1},
+    {0x211C, 2460, 1, 1}, {0x211D, 2461, 1, 1}, {0x2120, 2462, 2, 1}, {0x2121, 2464, 3, 1},
+    {0x2122, 2467, 2, 1}, {0x2124, 2469, 1, 1}, {0x2126, 2470, 1, 0}, {0x2128, 2471, 1, 1},
+    {0x212A, 2472, 1, 0}, {0x212B, 2473, 2, 0}, {0x212C, 2475, 1, 1}, {0x212D, 2476, 1, 1},
+    {0x212F, 2477, 1, 1}, {0x2130, 2478, 1, 1}, {0x2131, 2479, 1, 1}, {0x2133, 2480, 1, 1},
+    {0x2134, 2481, 1, 1}, {0x2135, 2482, 1, 1}, {0x2136, 2483, 1, 1}, {0x2137, 2484, 1, 1},
+    {0x2138, 2485, 1, 1}, {0x2139, 2486, 1, 1}, {0x213B, 2487, 3, 1}, {0x213C, 2490, 1, 1},
+    {0x213D, 2491, 1, 1}, {0x213E, 2492, 1, 1}, {0x213F, 2493, 1, 1}, {0x2140, 2494, 1, 1},
+    {0x2145, 2495, 1, 1}, {0x2146, 2496, 1, 1}, {0x2147, 2497, 1, 1}, {0x2148, 2498, 1, 1},
+    {0x2149, 2499, 1, 1}, {0x2150, 2500, 3, 1}, {0x2151, 2503, 3, 1}, {0x2152, 2506, 4, 1},
+    {0x2153, 2510, 3, 1}, {0x2154, 2513, 3, 1}, {0x2155, 2516, 3, 1}, {0x2156, 2519, 3, 1},
+    {0x2157, 2522, 3, 1}, {0x2158, 2525, 3, 1}, {0x2159, 2528, 3, 1}, {0x215A, 2531, 3, 1},
+    {0x215B, 2534, 3, 1}, {0x215C, 2537, 3, 1}, {0x215D, 2540, 3, 1}, {0x215E, 2543, 3, 1},
+    {0x215F, 2546, 2, 1}, {0x2160, 2548, 1, 1}, {0x2161, 2549, 2, 1}, {0x2162, 2551, 3, 1},
+    {0x2163, 2554, 2, 1}, {0x2164, 2556, 1, 1}, {0x2165, 2557, 2, 1}, {0x2166, 2559, 3, 1},
+    {0x2167, 2562, 4, 1}, {0x2168, 2566, 2, 1}, {0x2169, 2568, 1, 1}, {0x216A, 2569, 2, 1},
+    {0x216B, 2571, 3, 1}, {0x216C, 2574, 1, 1}, {0x216D, 2575, 1, 1}, {0x216E, 2576, 1, 1},
+    {0x216F, 2577, 1, 1}, {0x2170, 2578, 1, 1}, {0x2171, 2579, 2, 1}, {0x2172, 2581, 3, 1},
+    {0x2173, 2584, 2, 1}, {0x2174, 2586, 1, 1}, {0x2175, 2587, 2, 1}, {0x2176, 2589, 3, 1},
+    {0x2177, 2592, 4, 1}, {0x2178, 2596, 2, 1}, {0x2179, 2598, 1, 1}, {0x217A, 2599, 2, 1},
+    {0x217B, 2601, 3, 1}, {0x217C, 2604, 1, 1}, {0x217D, 2605, 1, 1}, {0x217E, 2606, 1, 1},
+    {0x217F, 2607, 1, 1}, {0x2189, 2608, 3, 1}, {0x219A, 2611, 2, 0}, {0x219B, 2613, 2, 0},
+    {0x21AE, 2615, 2, 0}, {0x21CD, 2617, 2, 0}, {0x21CE, 2619, 2, 0}, {0x21CF, 2621, 2, 0},
+    {0x2204, 2623, 2, 0}, {0x2209, 2625, 2, 0}, {0x220C, 2627, 2, 0}, {0x2224, 2629, 2, 0},
+    {0x2226, 2631, 2, 0}, {0x222C, 2633, 2, 1}, {0x222D, 2635, 3, 1}, {0x222F, 2638, 2, 1},
+    {0x2230, 2640, 3, 1}, {0x2241, 2643, 2, 0}, {0x2244, 2645, 2, 0}, {0x2247, 2647, 2, 0},
+    {0x2249, 2649, 2, 0}, {0x2260, 2651, 2, 0}, {0x2262, 2653, 2, 0}, {0x226D, 2655, 2, 0},
+    {0x226E, 2657, 2, 0}, {0x226F, 2659, 2, 0}, {0x2270, 2661, 2, 0}, {0x2271, 2663, 2, 0},
+    {0x2274, 2665, 2, 0}, {0x2275, 2667, 2, 0}, {0x2278, 2669, 2, 0}, {0x2279, 2671, 2, 0},
+    {0x2280, 2673, 2, 0}, {0x2281, 2675, 2, 0}, {0x2284, 2677, 2, 0}, {0x2285, 2679, 2, 0},
+    {0x2288, 2681, 2, 0}, {0x2289, 2683, 2, 0}, {0x22AC, 2685, 2, 0}, {0x22AD, 2687, 2, 0},
+    {0x22AE, 2689, 2, 0}, {0x22AF, 2691, 2, 0}, {0x22E0, 2693, 2, 0}, {0x22E1, 2695, 2, 0},
+    {0x22E2, 2697, 2, 0}, {0x22E3, 2699, 2, 0}, {0x22EA, 2701, 2, 0}, {0x22EB, 2703, 2, 0},
+    {0x22EC, 2705, 2, 0}, {0x22ED, 2707, 2, 0}, {0x2329, 2709, 1, 0}, {0x232A, 2710, 1, 0},
+    {0x2460, 2711, 1, 1}, {0x2461, 2712, 1, 1}, {0x2462, 2713, 1, 1}, {0x2463, 2714, 1, 1},
+    {0x2464, 2715, 1, 1}, {0x2465, 2716, 1, 1}, {0x2466, 2717, 1, 1}, {0x2467, 2718, 1, 1},
+    {0x2468, 2719, 1, 1}, {0x2469, 2720, 2, 1}, {0x246A, 2722, 2, 1}, {0x246B, 2724, 2, 1},
+    {0x246C, 2726, 2, 1}, {0x246D, 2728, 2, 1}, {0x246E, 2730, 2, 1}, {0x246F, 2732, 2, 1},
+    {0x2470, 2734, 2, 1}, {0x2471, 2736, 2, 1}, {0x2472, 2738, 2, 1}, {0x2473, 2740, 2, 1},
+    {0x2474, 2742, 3, 1}, {0x2475, 2745, 3, 1}, {0x2476, 2748, 3, 1}, {0x2477, 2751, 3, 1},
+    {0x2478, 2754, 3, 1}, {0x2479, 2757, 3, 1}, {0x247A, 2760, 3, 1}, {0x247B, 2763, 3, 1},
+    {0x247C, 2766, 3, 1}, {0x247D, 2769, 4, 1}, {0x247E, 2773, 4, 1}, {0x247F, 2777, 4, 1},
+    {0x2480, 2781, 4, 1}, {0x2481, 2785, 4, 1}, {0x2482, 2789, 4, 1}, {0x2483, 2793, 4, 1},
+    {0x2484, 2797, 4, 1}, {0x2485, 2801, 4, 1}, {0x2486, 2805, 4, 1}, {0x2487, 2809, 4, 1},
+    {0x2488, 2813, 2, 1}, {0x2489, 2815, 2, 1}, {0x248A, 2817, 2, 1}, {0x248B, 2819, 2, 1},
+    {0x248C, 2821, 2, 1}, {0x248D, 2823, 2, 1}, {0x248E, 2825, 2, 1}, {0x248F, 2827, 2, 1},
+    {0x2490, 2829, 2, 1}, {0x2491, 2831, 3, 1}, {0x2492, 2834, 3, 1}, {0x2493, 2837, 3, 1},
+    {0x2494, 2840, 3, 1}, {0x2495, 2843, 3, 1}, {0x2496, 2846, 3, 1}, {0x2497, 2849, 3, 1},
+    {0x2498, 2852, 3, 1}, {0x2499, 2855, 3, 1}, {0x249A, 2858, 3, 1}, {0x249B, 2861, 3, 1},
+    {0x249C, 2864, 3, 1}, {0x249D, 2867, 3, 1}, {0x249E, 2870, 3, 1}, {0x249F, 2873, 3, 1},
+    {0x24A0, 2876, 3, 1}, {0x24A1, 2879, 3, 1}, {0x24A2, 2882, 3, 1}, {0x24A3, 2885, 3, 1},
+    {0x24A4, 2888, 3, 1}, {0x24A5, 2891, 3, 1}, {0x24A6, 2894, 3, 1}, {0x24A7, 2897, 3, 1},
+    {0x24A8, 2900, 3, 1}, {0x24A9, 2903, 3, 1}, {0x24AA, 2906, 3, 1}, {0x24AB, 2909, 3, 1},
+    {0x24AC, 2912, 3, 1}, {0x24AD, 2915, 3, 1}, {0x24AE, 2918, 3, 1}, {0x24AF, 2921, 3, 1},
+    {0x24B0, 2924, 3, 1}, {0x24B1, 2927, 3, 1}, {0x24B2, 2930, 3, 1}, {0x24B3, 2933, 3, 1},
+    {0x24B4, 2936, 3, 1}, {0x24B5, 2939, 3, 1}, {0x24B6, 2942, 1, 1}, {0x24B7, 2943, 1, 1},
+    {0x24B8, 2944, 1, 1}, {0x24B9, 2945, 1, 1}, {0x24BA, 2946, 1, 1}, {0x24BB, 2947, 1, 1},
+    {0x24BC, 2948, 1, 1}, {0x24BD, 2949, 1, 1}, {0x24BE, 2950, 1, 1}, {0x24BF, 2951, 1, 1},
+    {0x24C0, 2952, 1, 1}, {0x24C1, 2953, 1, 1}, {0x24C2, 2954, 1, 1}, {0x24C3, 2955, 1, 1},
+    {0x24C4, 2956, 1, 1}, {0x24C5, 2957, 1, 1}, {0x24C6, 2958, 1, 1}, {0x24C7, 2959, 1, 1},
+    {0x24C8, 2960, 1, 1}, {0x24C9, 2961, 1, 1}, {0x24CA, 2962, 1, 1}, {0x24CB, 2963, 1, 1},
+    {0x24CC, 2964, 1, 1}, {0x24CD, 2965, 1, 1}, {0x24CE, 2966, 1, 1}, {0x24CF, 2967, 1, 1},
+    {0x24D0, 2968, 1, 1}, {0x24D1, 2969, 1, 1}, {0x24D2, 2970, 1, 1}, {0x24D3, 2971, 1, 1},
+    {0x24D4, 2972, 1, 1}, {0x24D5, 2973, 1, 1}, {0x24D6, 2974, 1, 1}, {0x24D7, 2975, 1, 1},
+    {0x24D8, 2976, 1, 1}, {0x24D9, 2977, 1, 1}, {0x24DA, 2978, 1, 1}, {0x24DB, 2979, 1, 1},
+    {0x24DC, 2980, 1, 1}, {0x24DD, 2981, 1, 1}, {0x24DE, 2982, 1, 1}, {0x24DF, 2983, 1, 1},
+    {0x24E0, 2984, 1, 1}, {0x24E1, 2985, 1, 1}, {0x24E2, 2986, 1, 1}, {0x24E3, 2987, 1, 1},
+    {0x24E4, 2988, 1, 1}, {0x24E5, 2989, 1, 1}, {0x24E6, 2990, 1, 1}, {0x24E7, 2991, 1, 1},
+    {0x24E8, 2992, 1, 1}, {0x24E9, 2993, 1, 1}, {0x24EA, 2994, 1, 1}, {0x2A0C, 2995, 4, 1},
+    {0x2A74, 2999, 3, 1}, {0x2A75, 3002, 2, 1}, {0x2A76, 3004, 3, 1}, {0x2ADC, 3007, 2, 0},
+    {0x2C7C, 3009, 1, 1}, {0x2C7D, 3010, 1, 1}, {0x2D6F, 3011, 1, 1}, {0x2E9F, 3012, 1, 1},
+    {0x2EF3, 3013, 1, 1}, {0x2F00, 3014, 1, 1}, {0x2F01, 3015, 1, 1}, {0x2F02, 3016, 1, 1},
+    {0x2F03, 3017, 1, 1}, {0x2F04, 3018, 1, 1}, {0x2F05, 3019, 1, 1}, {0x2F06, 3020, 1, 1},
+    {0x2F07, 3021, 1, 1}, {0x2F08, 3022, 1, 1}, {0x2F09, 3023, 1, 1}, {0x2F0A, 3024, 1, 1},
+    {0x2F0B, 3025, 1, 1}, {0x2F0C, 3026, 1, 1}, {0x2F0D, 3027, 1, 1}, {0x2F0E, 3028, 1, 1},
+    {0x2F0F, 3029, 1, 1}, {0x2F10, 3030, 1, 1}, {0x2F11, 3031, 1, 1}, {0x2F12, 3032, 1, 1},
+    {0x2F13, 3033, 1, 1}, {0x2F14, 3034, 1, 1}, {0x2F15, 3035, 1, 1}, {0x2F16, 3036, 1, 1},
+    {0x2F17, 3037, 1, 1}, {0x2F18, 3038, 1, 1}, {0x2F19, 3039, 1, 1}, {0x2F1A, 3040, 1, 1},
+    {0x2F1B, 3041, 1, 1}, {0x2F1C, 3042, 1, 1}, {0x2F1D, 3043, 1, 1}, {0x2F1E, 3044, 1, 1},
+    {0x2F1F, 3045, 1, 1}, {0x2F20, 3046, 1, 1}, {0x2F21, 3047, 1, 1}, {0x2F22, 3048, 1, 1},
+    {0x2F23, 3049, 1, 1}, {0x2F24, 3050, 1, 1}, {0x2F25, 3051, 1, 1}, {0x2F26, 3052, 1, 1},
+    {0x2F27, 3053, 1, 1}, {0x2F28, 3054, 1, 1}, {0x2F29, 3055, 1, 1}, {0x2F2A, 3056, 1, 1},
+    {0x2F2B, 3057, 1, 1}, {0x2F2C, 3058, 1, 1}, {0x2F2D, 3059, 1, 1}, {0x2F2E, 3060, 1, 1},
+    {0x2F2F, 3061, 1, 1}, {0x2F30, 3062, 1, 1}, {0x2F31, 3063, 1, 1}, {0x2F32, 3064, 1, 1},
+    {0x2F33, 3065, 1, 1}, {0x2F34, 3066, 1, 1}, {0x2F35, 3067, 1, 1}, {0x2F36, 3068, 1, 1},
+    {0x2F37, 3069, 1, 1}, {0x2F38, 3070, 1, 1}, {0x2F39, 3071, 1, 1}, {0x2F3A, 3072, 1, 1},
+    {0x2F3B, 3073, 1, 1}, {0x2F3C, 3074, 1, 1}, {0x2F3D, 3075, 1, 1}, {0x2F3E, 3076, 1, 1},
+    {0x2F3F, 3077, 1, 1}, {0x2F40, 3078, 1, 1}, {0x2F41, 3079, 1, 1}, {0x2F42, 3080, 1, 1},
+    {0x2F43, 3081, 1, 1}, {0x2F44, 3082, 1, 1}, {0x2F45, 3083, 1, 1}, {0x2F46, 3084, 1, 1},
+    {0x2F47, 3085, 1, 1}, {0x2F48, 3086, 1, 1}, {0x2F49, 3087, 1, 1}, {0x2F4A, 3088, 1, 1},
+    {0x2F4B, 3089, 1, 1}, {0x2F4C, 3090, 1, 1}, {0x2F4D, 3091, 1, 1}, {0x2F4E, 3092, 1, 1},
+    {0x2F4F, 3093, 1, 1}, {0x2F50, 3094, 1, 1}, {0x2F51, 3095, 1, 1}, {0x2F52, 3096, 1, 1},
+    {0x2F53, 3097, 1, 1}, {0x2F54, 3098, 1, 1}, {0x2F55, 3099, 1, 1}, {0x2F56, 3100, 1, 1},
+    {0x2F57, 3101, 1, 1}, {0x2F58, 3102, 1, 1}, {0x2F59, 3103, 1, 1}, {0x2F5A, 3104, 1, 1},
+    {0x2F5B, 3105, 1, 1}, {0x2F5C, 3106, 1, 1}, {0x2F5D, 3107, 1, 1}, {0x2F5E, 3108, 1, 1},
+    {0x2F5F, 3109, 1, 1}, {0x2F60, 3110, 1, 1}, {0x2F61, 3111, 1, 1}, {0x2F62, 3112, 1, 1},
+    {0x2F63, 3113, 1, 1}, {0x2F64, 3114, 1, 1}, {0x2F65, 3115, 1, 1}, {0x2F66, 3116, 1, 1},
+    {0x2F67, 3117, 1, 1}, {0x2F68, 3118, 1, 1}, {0x2F69, 3119, 1, 1}, {0x2F6A, 3120, 1, 1},
+    {0x2F6B, 3121, 1, 1}, {0x2F6C, 3122, 1, 1}, {0x2F6D, 3123, 1, 1}, {0x2F6E, 3124, 1, 1},
+    {0x2F6F, 3125, 1, 1}, {0x2F70, 3126, 1, 1}, {0x2F71, 3127, 1, 1}, {0x2F72, 3128, 1, 1},
+    {0x2F73, 3129, 1, 1}, {0x2F74, 3130, 1, 1}, {0x2F75, 3131, 1, 1}, {0x2F76, 3132, 1, 1},
+    {0x2F77, 3133, 1, 1}, {0x2F78, 3134, 1, 1}, {0x2F79, 3135, 1, 1}, {0x2F7A, 3136, 1, 1},
+    {0x2F7B, 3137, 1, 1}, {0x2F7C, 3138, 1, 1}, {0x2F7D, 3139, 1, 1}, {0x2F7E, 3140, 1, 1},
+    {0x2F7F, 3141, 1, 1}, {0x2F80, 3142, 1, 1}, {0x2F81, 3143, 1, 1}, {0x2F82, 3144, 1, 1},
+    {0x2F83, 3145, 1, 1}, {0x2F84, 3146, 1, 1}, {0x2F85, 3147, 1, 1}, {0x2F86, 3148, 1, 1},
+    {0x2F87, 3149, 1, 1}, {0x2F88, 3150, 1, 1}, {0x2F89, 3151, 1, 1}, {0x2F8A, 3152, 1, 1},
+    {0x2F8B, 3153, 1, 1}, {0x2F8C, 3154, 1, 1}, {0x2F8D, 3155, 1, 1}, {0x2F8E, 3156, 1, 1},
+    {0x2F8F, 3157, 1, 1}, {0x2F90, 3158, 1, 1}, {0x2F91, 3159, 1, 1}, {0x2F92, 3160, 1, 1},
+    {0x2F93, 3161, 1, 1}, {0x2F94, 3162, 1, 1}, {0x2F95, 3163, 1, 1}, {0x2F96, 3164, 1, 1},
+    {0x2F97, 3165, 1, 1}, {0x2F98, 3166, 1, 1}, {0x2F99, 3167, 1, 1}, {0x2F9A, 3168, 1, 1},
+    {0x2F9B, 3169, 1, 1}, {0x2F9C, 3170, 1, 1}, {0x2F9D, 3171, 1, 1}, {0x2F9E, 3172, 1, 1},
+    {0x2F9F, 3173, 1, 1}, {0x2FA0, 3174, 1, 1}, {0x2FA1, 3175, 1, 1}, {0x2FA2, 3176, 1, 1},
+    {0x2FA3, 3177, 1, 1}, {0x2FA4, 3178, 1, 1}, {0x2FA5, 3179, 1, 1}, {0x2FA6, 3180, 1, 1},
+    {0x2FA7, 3181, 1, 1}, {0x2FA8, 3182, 1, 1}, {0x2FA9, 3183, 1, 1}, {0x2FAA, 3184, 1, 1},
+    {0x2FAB, 3185, 1, 1}, {0x2FAC, 3186, 1, 1}, {0x2FAD, 3187, 1, 1}, {0x2FAE, 3188, 1, 1},
+    {0x2FAF, 3189, 1, 1}, {0x2FB0, 3190, 1, 1}, {0x2FB1, 3191, 1, 1}, {0x2FB2, 3192, 1, 1},
+    {0x2FB3, 3193, 1, 1}, {0x2FB4, 3194, 1, 1}, {0x2FB5, 3195, 1, 1}, {0x2FB6, 3196, 1, 1},
+    {0x2FB7, 3197, 1, 1}, {0x2FB8, 3198, 1, 1}, {0x2FB9, 3199, 1, 1}, {0x2FBA, 3200, 1, 1},
+    {0x2FBB, 3201, 1, 1}, {0x2FBC, 3202, 1, 1}, {0x2FBD, 3203, 1, 1}, {0x2FBE, 3204, 1, 1},
+    {0x2FBF, 3205, 1, 1}, {0x2FC0, 3206, 1, 1}, {0x2FC1, 3207, 1, 1}, {0x2FC2, 3208, 1, 1},
+    {0x2FC3, 3209, 1, 1}, {0x2FC4, 3210, 1, 1}, {0x2FC5, 3211, 1, 1}, {0x2FC6, 3212, 1, 1},
+    {0x2FC7, 3213, 1, 1}, {0x2FC8, 3214, 1, 1}, {0x2FC9, 3215, 1, 1}, {0x2FCA, 3216, 1, 1},
+    {0x2FCB, 3217, 1, 1}, {0x2FCC, 3218, 1, 1}, {0x2FCD, 3219, 1, 1}, {0x2FCE, 3220, 1, 1},
+    {0x2FCF, 3221, 1, 1}, {0x2FD0, 3222, 1, 1}, {0x2FD1, 3223, 1, 1}, {0x2FD2, 3224, 1, 1},
+    {0x2FD3, 3225, 1, 1}, {0x2FD4, 3226, 1, 1}, {0x2FD5, 3227, 1, 1}, {0x3000, 3228, 1, 1},
+    {0x3036, 3229, 1, 1}, {0x3038, 3230, 1, 1}, {0x3039, 3231, 1, 1}, {0x303A, 3232, 1, 1},
+    {0x304C, 3233, 2, 0}, {0x304E, 3235, 2, 0}, {0x3050, 3237, 2, 0}, {0x3052, 3239, 2, 0},
+    {0x3054, 3241, 2, 0}, {0x3056, 3243, 2, 0}, {0x3058, 3245, 2, 0}, {0x305A, 3247, 2, 0},
+    {0x305C, 3249, 2, 0}, {0x305E, 3251, 2, 0}, {0x3060, 3253, 2, 0}, {0x3062, 3255, 2, 0},
+    {0x3065, 3257, 2, 0}, {0x3067, 3259, 2, 0}, {0x3069, 3261, 2, 0}, {0x3070, 3263, 2, 0},
+    {0x3071, 3265, 2, 0}, {0x3073, 3267, 2, 0}, {0x3074, 3269, 2, 0}, {0x3076, 3271, 2, 0},
+    {0x3077, 3273, 2, 0}, {0x3079, 3275, 2, 0}, {0x307A, 3277, 2, 0}, {0x307C, 3279, 2, 0},
+    {0x307D, 3281, 2, 0}, {0x3094, 3283, 2, 0}, {0x309B, 3285, 2, 1}, {0x309C, 3287, 2, 1},
+    {0x309E, 3289, 2, 0}, {0x309F, 3291, 2, 1}, {0x30AC, 3293, 2, 0}, {0x30AE, 3295, 2, 0},
+    {0x30B0, 3297, 2, 0}, {0x30B2, 3299, 2, 0}, {0x30B4, 3301, 2, 0}, {0x30B6, 3303, 2, 0},
+    {0x30B8, 3305, 2, 0}, {0x30BA, 3307, 2, 0}, {0x30BC, 3309, 2, 0}, {0x30BE, 3311, 2, 0},
+    {0x30C0, 3313, 2, 0}, {0x30C2, 3315, 2, 0}, {0x30C5, 3317, 2, 0}, {0x30C7, 3319, 2, 0},
+    {0x30C9, 3321, 2, 0}, {0x30D0, 3323, 2, 0}, {0x30D1, 3325, 2, 0}, {0x30D3, 3327, 2, 0},
+    {0x30D4, 3329, 2, 0}, {0x30D6, 3331, 2, 0}, {0x30D7, 3333, 2, 0}, {0x30D9, 3335, 2, 0},
+    {0x30DA, 3337, 2, 0}, {0x30DC, 3339, 2, 0}, {0x30DD, 3341, 2, 0}, {0x30F4, 3343, 2, 0},
+    {0x30F7, 3345, 2, 0}, {0x30F8, 3347, 2, 0}, {0x30F9, 3349, 2, 0}, {0x30FA, 3351, 2, 0},
+    {0x30FE, 3353, 2, 0}, {0x30FF, 3355, 2, 1}, {0x3131, 3357, 1, 1}, {0x3132, 3358, 1, 1},
+    {0x3133, 3359, 1, 1}, {0x3134, 3360, 1, 1}, {0x3135, 3361, 1, 1}, {0x3136, 3362, 1, 1},
+    {0x3137, 3363, 1, 1}, {0x3138, 3364, 1, 1}, {0x3139, 3365, 1, 1}, {0x313A, 3366, 1, 1},
+    {0x313B, 3367, 1, 1}, {0x313C, 3368, 1, 1}, {0x313D, 3369, 1, 1}, {0x313E, 3370, 1, 1},
+    {0x313F, 3371, 1, 1}, {0x3140, 3372, 1, 1}, {0x3141, 3373, 1, 1}, {0x3142, 3374, 1, 1},
+    {0x3143, 3375, 1, 1}, {0x3144, 3376, 1, 1}, {0x3145, 3377, 1, 1}, {0x3146, 3378, 1, 1},
+    {0x3147, 3379, 1, 1}, {0x3148, 3380, 1, 1}, {0x3149, 3381, 1, 1}, {0x314A, 3382, 1, 1},
+    {0x314B, 3383, 1, 1}, {0x314C, 3384, 1, 1}, {0x314D, 3385, 1, 1}, {0x314E, 3386, 1, 1},
+    {0x314F, 3387, 1, 1}, {0x3150, 3388, 1, 1}, {0x3151, 3389, 1, 1}, {0x3152, 3390, 1, 1},
+    {0x3153, 3391, 1, 1}, {0x3154, 3392, 1, 1}, {0x3155, 3393, 1, 1}, {0x3156, 3394, 1, 1},
+    {0x3157, 3395, 1, 1}, {0x3158, 3396, 1, 1}, {0x3159, 3397, 1, 1}, {0x315A, 3398, 1, 1},
+    {0x315B, 3399, 1, 1}, {0x315C, 3400, 1, 1}, {0x315D, 3401, 1, 1}, {0x315E, 3402, 1, 1},
+    {0x315F, 3403, 1, 1}, {0x3160, 3404, 1, 1}, {0x3161, 3405, 1, 1}, {0x3162, 3406, 1, 1},
+    {0x3163, 3407, 1, 1}, {0x3164, 3408, 1, 1}, {0x3165, 3409, 1, 1}, {0x3166, 3410, 1, 1},
+    {0x3167, 3411, 1, 1}, {0x3168, 3412, 1, 1}, {0x3169, 3413, 1, 1}, {0x316A, 3414, 1, 1},
+    {0x316B, 3415, 1, 1}, {0x316C, 3416, 1, 1}, {0x316D, 3417, 1, 1}, {0x316E, 3418, 1, 1},
+    {0x316F, 3419, 1, 1}, {0x3170, 3420, 1, 1}, {0x3171, 3421, 1, 1}, {0x3172, 3422, 1, 1},
+    {0x3173, 3423, 1, 1}, {0x3174, 3424, 1, 1}, {0x3175, 3425, 1, 1}, {0x3176, 3426, 1, 1},
+    {0x3177, 3427, 1, 1}, {0x3178, 3428, 1, 1}, {0x3179, 3429, 1, 1}, {0x317A, 3430, 1, 1},
+    {0x317B, 3431, 1, 1}, {0x317C, 3432, 1, 1}, {0x317D, 3433, 1, 1}, {0x317E, 3434, 1, 1},
+    {0x317F, 3435, 1, 1}, {0x3180, 3436, 1, 1}, {0x3181, 3437, 1, 1}, {0x3182, 3438, 1, 1},
+    {0x3183, 3439, 1, 1}, {0x3184, 3440, 1, 1}, {0x3185, 3441, 1, 1}, {0x3186, 3442, 1, 1},
+    {0x3187, 3443, 1, 1}, {0x3188, 3444, 1, 1}, {0x3189, 3445, 1, 1}, {0x318A, 3446, 1, 1},
+    {0x318B, 3447, 1, 1}, {0x318C, 3448, 1, 1}, {0x318D, 3449, 1, 1}, {0x318E, 3450, 1, 1},
+    {0x3192, 3451, 1, 1}, {0x3193, 3452, 1, 1}, {0x3194, 3453, 1, 1}, {0x3195, 3454, 1, 1},
+    {0x3196, 3455, 1, 1}, {0x3197, 3456, 1, 1}, {0x3198, 3457, 1, 1}, {0x3199, 3458, 1, 1},
+    {0x319A, 3459, 1, 1}, {0x319B, 3460, 1, 1}, {0x319C, 3461, 1, 1}, {0x319D, 3462, 1, 1},
+    {0x319E, 3463, 1, 1}, {0x319F, 3464, 1, 1}, {0x3200, 3465, 3, 1}, {0x3201, 3468, 3, 1},
+    {0x3202, 3471, 3, 1}, {0x3203, 3474, 3, 1}, {0x3204, 3477, 3, 1}, {0x3205, 3480, 3, 1},
+    {0x3206, 3483, 3, 1}, {0x3207, 3486, 3, 1}, {0x3208, 3489, 3, 1}, {0x3209, 3492, 3, 1},
+    {0x320A, 3495, 3, 1}, {0x320B, 3498, 3, 1}, {0x320C, 3501, 3, 1}, {0x320D, 3504, 3, 1},
+    {0x320E, 3507, 4, 1}, {0x320F, 3511, 4, 1}, {0x3210, 3515, 4, 1}, {0x3211, 3519, 4, 1},
+    {0x3212, 3523, 4, 1}, {0x3213, 3527, 4, 1}, {0x3214, 3531, 4, 1}, {0x3215, 3535, 4, 1},
+    {0x3216, 3539, 4, 1}, {0x3217, 3543, 4, 1}, {0x3218, 3547, 4, 1}, {0x3219, 3551, 4, 1},
+    {0x321A, 3555, 4, 1}, {0x321B, 3559, 4, 1}, {0x321C, 3563, 4, 1}, {0x321D, 3567, 7, 1},
+    {0x321E, 3574, 6, 1}, {0x3220, 3580, 3, 1}, {0x3221, 3583, 3, 1}, {0x3222, 3586, 3, 1},
+    {0x3223, 3589, 3, 1}, {0x3224, 3592, 3, 1}, {0x3225, 3595, 3, 1}, {0x3226, 3598, 3, 1},
+    {0x3227, 3601, 3, 1}, {0x3228, 3604, 3, 1}, {0x3229, 3607, 3, 1}, {0x322A, 3610, 3, 1},
+    {0x322B, 3613, 3, 1}, {0x322C, 3616, 3, 1}, {0x322D, 3619, 3, 1}, {0x322E, 3622, 3, 1},
+    {0x322F, 3625, 3, 1}, {0x3230, 3628, 3, 1}, {0x3231, 3631, 3, 1}, {0x3232, 3634, 3, 1},
+    {0x3233, 3637, 3, 1}, {0x3234, 3640, 3, 1}, {0x3235, 3643, 3, 1}, {0x3236, 3646, 3, 1},
+    {0x3237, 3649, 3, 1}, {0x3238, 3652, 3, 1}, {0x3239, 3655, 3, 1}, {0x323A, 3658, 3, 1},
+    {0x323B, 3661, 3, 1}, {0x323C, 3664, 3, 1}, {0x323D, 3667, 3, 1}, {0x323E, 3670, 3, 1},
+    {0x323F, 3673, 3, 1}, {0x3240, 3676, 3, 1}, {0x3241, 3679, 3, 1}, {0x3242, 3682, 3, 1},
+    {0x3243, 3685, 3, 1}, {0x3244, 3688, 1, 1}, {0x3245, 3689, 1, 1}, {0x3246, 3690, 1, 1},
+    {0x3247, 3691, 1, 1}, {0x3250, 3692, 3, 1}, {0x3251, 3695, 2, 1}, {0x3252, 3697, 2, 1},
+    {0x3253, 3699, 2, 1}, {0x3254, 3701, 2, 1}, {0x3255, 3703, 2, 1}, {0x3256, 3705, 2, 1},
+    {0x3257, 3707, 2, 1}, {0x3258, 3709, 2, 1}, {0x3259, 3711, 2, 1}, {0x325A, 3713, 2, 1},
+    {0x325B, 3715, 2, 1}, {0x325C, 3717, 2, 1}, {0x325D, 3719, 2, 1}, {0x325E, 3721, 2, 1},
+    {0x325F, 3723, 2, 1}, {0x3260, 3725, 1, 1}, {0x3261, 3726, 1, 1}, {0x3262, 3727, 1, 1},
+    {0x3263, 3728, 1, 1}, {0x3264, 3729, 1, 1}, {0x3265, 3730, 1, 1}, {0x3266, 3731, 1, 1},
+    {0x3267, 3732, 1, 1}, {0x3268, 3733, 1, 1}, {0x3269, 3734, 1, 1}, {0x326A, 3735, 1, 1},
+    {0x326B, 3736, 1, 1}, {0x326C, 3737, 1, 1}, {0x326D, 3738, 1, 1}, {0x326E, 3739, 2, 1},
+    {0x326F, 3741, 2, 1}, {0x3270, 3743, 2, 1}, {0x3271, 3745, 2, 1}, {0x3272, 3747, 2, 1},
+    {0x3273, 3749, 2, 1}, {0x3274, 3751, 2, 1}, {0x3275, 3753, 2, 1}, {0x3276, 3755, 2, 1},
+    {0x3277, 3757, 2, 1}, {0x3278, 3759, 2, 1}, {0x3279, 3761, 2, 1}, {0x327A, 3763, 2, 1},
+    {0x327B, 3765, 2, 1}, {0x327C, 3767, 5, 1}, {0x327D, 3772, 4, 1}, {0x327E, 3776, 2, 1},
+    {0x3280, 3778, 1, 1}, {0x3281, 3779, 1, 1}, {0x3282, 3780, 1, 1}, {0x3283, 3781, 1, 1},
+    {0x3284, 3782, 1, 1}, {0x3285, 3783, 1, 1}, {0x3286, 3784, 1, 1}, {0x3287, 3785, 1, 1},
+    {0x3288, 3786, 1, 1}, {0x3289, 3787, 1, 1}, {0x328A, 3788, 1, 1}, {0x328B, 3789, 1, 1},
+    {0x328C, 3790, 1, 1}, {0x328D, 3791, 1, 1}, {0x328E, 3792, 1, 1}, {0x328F, 3793, 1, 1},
+    {0x3290, 3794, 1, 1}, {0x3291, 3795, 1, 1}, {0x3292, 3796, 1, 1}, {0x3293, 3797, 1, 1},
+    {0x3294, 3798, 1, 1}, {0x3295, 3799, 1, 1}, {0x3296, 3800, 1, 1}, {0x3297, 3801, 1, 1},
+    {0x3298, 3802, 1, 1}, {0x3299, 3803, 1, 1}, {0x329A, 3804, 1, 1}, {0x329B, 3805, 1, 1},
+    {0x329C, 3806, 1, 1}, {0x329D, 3807, 1, 1}, {0x329E, 3808, 1, 1}, {0x329F, 3809, 1, 1},
+    {0x32A0, 3810, 1, 1}, {0x32A1, 3811, 1, 1}, {0x32A2, 3812, 1, 1}, {0x32A3, 3813, 1, 1},
+    {0x32A4, 3814, 1, 1}, {0x32A5, 3815, 1, 1}, {0x32A6, 3816, 1, 1}, {0x32A7, 3817, 1, 1},
+    {0x32A8, 3818, 1, 1}, {0x32A9, 3819, 1, 1}, {0x32AA, 3820, 1, 1}, {0x32AB, 3821, 1, 1},
+    {0x32AC, 3822, 1, 1}, {0x32AD, 3823, 1, 1}, {0x32AE, 3824, 1, 1}, {0x32AF, 3825, 1, 1},
+    {0x32B0, 3826, 1, 1}, {0x32B1, 3827, 2, 1}, {0x32B2, 3829, 2, 1}, {0x32B3, 3831, 2, 1},
+    {0x32B4, 3833, 2, 1}, {0x32B5, 3835, 2, 1}, {0x32B6, 3837, 2, 1}, {0x32B7, 3839, 2, 1},
+    {0x32B8, 3841, 2, 1}, {0x32B9, 3843, 2, 1}, {0x32BA, 3845, 2, 1}, {0x32BB, 3847, 2, 1},
+    {0x32BC, 3849, 2, 1}, {0x32BD, 3851, 2, 1}, {0x32BE, 3853, 2, 1}, {0x32BF, 3855, 2, 1},
+    {0x32C0, 3857, 2, 1}, {0x32C1, 3859, 2, 1}, {0x32C2, 3861, 2, 1}, {0x32C3, 3863, 2, 1},
+    {0x32C4, 3865, 2, 1}, {0x32C5, 3867, 2, 1}, {0x32C6, 3869, 2, 1}, {0x32C7, 3871, 2, 1},
+    {0x32C8, 3873, 2, 1}, {0x32C9, 3875, 3, 1}, {0x32CA, 3878, 3, 1}, {0x32CB, 3881, 3, 1},
+    {0x32CC, 3884, 2, 1}, {0x32CD, 3886, 3, 1}, {0x32CE, 3889, 2, 1}, {0x32CF, 3891, 3, 1},
+    {0x32D0, 3894, 1, 1}, {0x32D1, 3895, 1, 1}, {0x32D2, 3896, 1, 1}, {0x32D3, 3897, 1, 1},
+    {0x32D4, 3898, 1, 1}, {0x32D5, 3899, 1, 1}, {0x32D6, 3900, 1, 1}, {0x32D7, 3901, 1, 1},
+    {0x32D8, 3902, 1, 1}, {0x32D9, 3903, 1, 1}, {0x32DA, 3904, 1, 1}, {0x32DB, 3905, 1, 1},
+    {0x32DC, 3906, 1, 1}, {0x32DD, 3907, 1, 1}, {0x32DE, 3908, 1, 1}, {0x32DF, 3909, 1, 1},
+    {0x32E0, 3910, 1, 1}, {0x32E1, 3911, 1, 1}, {0x32E2, 3912, 1, 1}, {0x32E3, 3913, 1, 1},
+    {0x32E4, 3914, 1, 1}, {0x32E5, 3915, 1, 1}, {0x32E6, 3916, 1, 1}, {0x32E7, 3917, 1, 1},
+    {0x32E8, 3918, 1, 1}, {0x32E9, 3919, 1, 1}, {0x32EA, 3920, 1, 1}, {0x32EB, 3921, 1, 1},
+    {0x32EC, 3922, 1, 1}, {0x32ED, 3923, 1, 1}, {0x32EE, 3924, 1, 1}, {0x32EF, 3925, 1, 1},
+    {0x32F0, 3926, 1, 1}, {0x32F1, 3927, 1, 1}, {0x32F2, 3928, 1, 1}, {0x32F3, 3929, 1, 1},
+    {0x32F4, 3930, 1, 1}, {0x32F5, 3931, 1, 1}, {0x32F6, 3932, 1, 1}, {0x32F7, 3933, 1, 1},
+    {0x32F8, 3934, 1, 1}, {0x32F9, 3935, 1, 1}, {0x32FA, 3936, 1, 1}, {0x32FB, 3937, 1, 1},
+    {0x32FC, 3938, 1, 1}, {0x32FD, 3939, 1, 1}, {0x32FE, 3940, 1, 1}, {0x32FF, 3941, 2, 1},
+    {0x3300, 3943, 5, 1}, {0x3301, 3948, 4, 1}, {0x3302, 3952, 5, 1}, {0x3303, 3957, 3, 1},
+    {0x3304, 3960, 5, 1}, {0x3305, 3965, 3, 1}, {0x3306, 3968, 3, 1}, {0x3307, 3971, 6, 1},
+    {0x3308, 3977, 4, 1}, {0x3309, 3981, 3, 1}, {0x330A, 3984, 3, 1}, {0x330B, 3987, 3, 1},
+    {0x330C, 3990, 4, 1}, {0x330D, 3994, 4, 1}, {0x330E, 3998, 4, 1}, {0x330F, 4002, 4, 1},
+    {0x3310, 4006, 4, 1}, {0x3311, 4010, 4, 1}, {0x3312, 4014, 4, 1}, {0x3313, 4018, 6, 1},
+    {0x3314, 4024, 2, 1}, {0x3315, 4026, 6, 1}, {0x3316, 4032, 6, 1}, {0x3317, 4038, 5, 1},
+    {0x3318, 4043, 4, 1}, {0x3319, 4047, 6, 1}, {0x331A, 4053, 6, 1}, {0x331B, 4059, 4, 1},
+    {0x331C, 4063, 3, 1}, {0x331D, 4066, 3, 1}, {0x331E, 4069, 4, 1}, {0x331F, 4073, 4, 1},
+    {0x3320, 4077, 5, 1}, {0x3321, 4082, 5, 1}, {0x3322, 4087, 3, 1}, {0x3323, 4090, 3, 1},
+    {0x3324, 4093, 4, 1}, {0x3325, 4097, 3, 1}, {0x3326, 4100, 3, 1}, {0x3327, 4103, 2, 1},
+    {0x3328, 4105, 2, 1}, {0x3329, 4107, 3, 1}, {0x332A, 4110, 3, 1}, {0x332B, 4113, 6, 1},
+    {0x332C, 4119, 4, 1}, {0x332D, 4123, 5, 1}, {0x332E, 4128, 6, 1}, {0x332F, 4134, 4, 1},
+    {0x3330, 4138, 3, 1}, {0x3331, 4141, 3, 1}, {0x3332, 4144, 6, 1}, {0x3333, 4150, 4, 1},
+    {0x3334, 4154, 6, 1}, {0x3335, 4160, 3, 1}, {0x3336, 4163, 5, 1}, {0x3337, 4168, 3, 1},
+    {0x3338, 4171, 4, 1}, {0x3339, 4175, 3, 1}, {0x333A, 4178, 4, 1}, {0x333B, 4182, 5, 1},
+    {0x333C, 4187, 4, 1}, {0x333D, 4191, 5, 1}, {0x333E, 4196, 4, 1}, {0x333F, 4200, 2, 1},
+    {0x3340, 4202, 5, 1}, {0x3341, 4207, 3, 1}, {0x3342, 4210, 3, 1}, {0x3343, 4213, 4, 1},
+    {0x3344, 4217, 3, 1}, {0x3345, 4220, 3, 1}, {0x3346, 4223, 3, 1}, {0x3347, 4226, 5, 1},
+    {0x3348, 4231, 4, 1}, {0x3349, 4235, 2, 1}, {0x334A, 4237, 6, 1}, {0x334B, 4243, 3, 1},
+    {0x334C, 4246, 5, 1}, {0x334D, 4251, 4, 1}, {0x334E, 4255, 4, 1}, {0x334F, 4259, 3, 1},
+    {0x3350, 4262, 3, 1}, {0x3351, 4265, 4, 1}, {0x3352, 4269, 2, 1}, {0x3353, 4271, 4, 1},
+    {0x3354, 4275, 5, 1}, {0x3355, 4280, 2, 1}, {0x3356, 4282, 6, 1}, {0x3357, 4288, 3, 1},
+    {0x3358, 4291, 2, 1}, {0x3359, 4293, 2, 1}, {0x335A, 4295, 2, 1}, {0x335B, 4297, 2, 1},
+    {0x335C, 4299, 2, 1}, {0x335D, 4301, 2, 1}, {0x335E, 4303, 2, 1}, {0x335F, 4305, 2, 1},
+    {0x3360, 4307, 2, 1}, {0x3361, 4309, 2, 1}, {0x3362, 4311, 3, 1}, {0x3363, 4314, 3, 1},
+    {0x3364, 4317, 3, 1}, {0x3365, 4320, 3, 1}, {0x3366, 4323, 3, 1}, {0x3367, 4326, 3, 1},
+    {0x3368, 4329, 3, 1}, {0x3369, 4332, 3, 1}, {0x336A, 4335, 3, 1}, {0x336B, 4338, 3, 1},
+    {0x336C, 4341, 3, 1}, {0x336D, 4344, 3, 1}, {0x336E, 4347, 3, 1}, {0x336F, 4350, 3, 1},
+    {0x3370, 4353, 3, 1}, {0x3371, 4356, 3, 1}, {0x3372, 4359, 2, 1}, {0x3373, 4361, 2, 1},
+    {0x3374, 4363, 3, 1}, {0x3375, 4366, 2, 1}, {0x3376, 4368, 2, 1}, {0x3377, 4370, 2, 1},
+    {0x3378, 4372, 3, 1}, {0x3379, 4375, 3, 1}, {0x337A, 4378, 2, 1}, {0x337B, 4380, 2, 1},
+    {0x337C, 4382, 2, 1}, {0x337D, 4384, 2, 1}, {0x337E, 4386, 2, 1}, {0x337F, 4388, 4, 1},
+    {0x3380, 4392, 2, 1}, {0x3381, 4394, 2, 1}, {0x3382, 4396, 2, 1}, {0x3383, 4398, 2, 1},
+    {0x3384, 4400, 2, 1}, {0x3385, 4402, 2, 1}, {0x3386, 4404, 2, 1}, {0x3387, 4406, 2, 1},
+    {0x3388, 4408, 3, 1}, {0x3389, 4411, 4, 1}, {0x338A, 4415, 2, 1}, {0x338B, 4417, 2, 1},
+    {0x338C, 4419, 2, 1}, {0x338D, 4421, 2, 1}, {0x338E, 4423, 2, 1}, {0x338F, 4425, 2, 1},
+    {0x3390, 4427, 2, 1}, {0x3391, 4429, 3, 1}, {0x3392, 4432, 3, 1}, {0x3393, 4435, 3, 1},
+    {0x3394, 4438, 3, 1}, {0x3395, 4441, 2, 1}, {0x3396, 4443, 2, 1}, {0x3397, 4445, 2, 1},
+    {0x3398, 4447, 2, 1}, {0x3399, 4449, 2, 1}, {0x339A, 4451, 2, 1}, {0x339B, 4453, 2, 1},
+    {0x339C, 4455, 2, 1}, {0x339D, 4457, 2, 1}, {0x339E, 4459, 2, 1}, {0x339F, 4461, 3, 1},
+    {0x33A0, 4464, 3, 1}, {0x33A1, 4467, 2, 1}, {0x33A2, 4469, 3, 1}, {0x33A3, 4472, 3, 1},
+    {0x33A4, 4475, 3, 1}, {0x33A5, 4478, 2, 1}, {0x33A6, 4480, 3, 1}, {0x33A7, 4483, 3, 1},
+    {0x33A8, 4486, 4, 1}, {0x33A9, 4490, 2, 1}, {0x33AA, 4492, 3, 1}, {0x33AB, 4495, 3, 1},
+    {0x33AC, 4498, 3, 1}, {0x33AD, 4501, 3, 1}, {0x33AE, 4504, 5, 1}, {0x33AF, 4509, 6, 1},
+    {0x33B0, 4515, 2, 1}, {0x33B1, 4517, 2, 1}, {0x33B2, 4519, 2, 1}, {0x33B3, 4521, 2, 1},
+    {0x33B4, 4523, 2, 1}, {0x33B5, 4525, 2, 1}, {0x33B6, 4527, 2, 1}, {0x33B7, 4529, 2, 1},
+    {0x33B8, 4531, 2, 1}, {0x33B9, 4533, 2, 1}, {0x33BA, 4535, 2, 1}, {0x33BB, 4537, 2, 1},
+    {0x33BC, 4539, 2, 1}, {0x33BD, 4541, 2, 1}, {0x33BE, 4543, 2, 1}, {0x33BF, 4545, 2, 1},
+    {0x33C0, 4547, 2, 1}, {0x33C1, 4549, 2, 1}, {0x33C2, 4551, 4, 1}, {0x33C3, 4555, 2, 1},
+    {0x33C4, 4557, 2, 1}, {0x33C5, 4559, 2, 1}, {0x33C6, 4561, 4, 1}, {0x33C7, 4565, 3, 1},
+    {0x33C8, 4568, 2, 1}, {0x33C9, 4570, 2, 1}, {0x33CA, 4572, 2, 1}, {0x33CB, 4574, 2, 1},
+    {0x33CC, 4576, 2, 1}, {0x33CD, 4578, 2, 1}, {0x33CE, 4580, 2, 1}, {0x33CF, 4582, 2, 1},
+    {0x33D0, 4584, 2, 1}, {0x33D1, 4586, 2, 1}, {0x33D2, 4588, 3, 1}, {0x33D3, 4591, 2, 1},
+    {0x33D4, 4593, 2, 1}, {0x33D5, 4595, 3, 1}, {0x33D6, 4598, 3, 1}, {0x33D7, 4601, 2, 1},
+    {0x33D8, 4603, 4, 1}, {0x33D9, 4607, 3, 1}, {0x33DA, 4610, 2, 1}, {0x33DB, 4612, 2, 1},
+    {0x33DC, 4614, 2, 1}, {0x33DD, 4616, 2, 1}, {0x33DE, 4618, 3, 1}, {0x33DF, 4621, 3, 1},
+    {0x33E0, 4624, 2, 1}, {0x33E1, 4626, 2, 1}, {0x33E2, 4628, 2, 1}, {0x33E3, 4630, 2, 1},
+    {0x33E4, 4632, 2, 1}, {0x33E5, 4634, 2, 1}, {0x33E6, 4636, 2, 1}, {0x33E7, 4638, 2, 1},
+    {0x33E8, 4640, 2, 1}, {0x33E9, 4642, 3, 1}, {0x33EA, 4645, 3, 1}, {0x33EB, 4648, 3, 1},
+    {0x33EC, 4651, 3, 1}, {0x33ED, 4654, 3, 1}, {0x33EE, 4657, 3, 1}, {0x33EF, 4660, 3, 1},
+    {0x33F0, 4663, 3, 1}, {0x33F1, 4666, 3, 1}, {0x33F2, 4669, 3, 1}, {0x33F3, 4672, 3, 1},
+    {0x33F4, 4675, 3, 1}, {0x33F5, 4678, 3, 1}, {0x33F6, 4681, 3, 1}, {0x33F7, 4684, 3, 1},
+    {0x33F8, 4687, 3, 1}, {0x33F9, 4690, 3, 1}, {0x33FA, 4693, 3, 1}, {0x33FB, 4696, 3, 1},
+    {0x33FC, 4699, 3, 1}, {0x33FD, 4702, 3, 1}, {0x33FE, 4705, 3, 1}, {0x33FF, 4708, 3, 1},
+    {0xA69C, 4711, 1, 1}, {0xA69D, 4712, 1, 1}, {0xA770, 4713, 1, 1}, {0xA7F2, 4714, 1, 1},
+    {0xA7F3, 4715, 1, 1}, {0xA7F4, 4716, 1, 1}, {0xA7F8, 4717, 1, 1}, {0xA7F9, 4718, 1, 1},
+    {0xAB5C, 4719, 1, 1}, {0xAB5D, 4720, 1, 1}, {0xAB5E, 4721, 1, 1}, {0xAB5F, 4722, 1, 1},
+    {0xAB69, 4723, 1, 1}, {0xF900, 4724, 1, 0}, {0xF901, 4725, 1, 0}, {0xF902, 4726, 1, 0},
+    {0xF903, 4727, 1, 0}, {0xF904, 4728, 1, 0}, {0xF905, 4729, 1, 0}, {0xF906, 4730, 1, 0},
+    {0xF907, 4731, 1, 0}, {0xF908, 4732, 1, 0}, {0xF909, 4733, 1, 0}, {0xF90A, 4734, 1, 0},
+    {0xF90B, 4735, 1, 0}, {0xF90C, 4736, 1, 0}, {0xF90D, 4737, 1, 0}, {0xF90E, 4738, 1, 0},
+    {0xF90F, 4739, 1, 0}, {0xF910, 4740, 1, 0}, {0xF911, 4741, 1, 0}, {0xF912, 4742, 1, 0},
+    {0xF913, 4743, 1, 0}, {0xF914, 4744, 1, 0}, {0xF915, 4745, 1, 0}, {0xF916, 4746, 1, 0},
+    {0xF917, 4747, 1, 0}, {0xF918, 4748, 1, 0}, {0xF919, 4749, 1, 0}, {0xF91A, 4750, 1, 0},
+    {0xF91B, 4751, 1, 0}, {0xF91C, 4752, 1, 0}, {0xF91D, 4753, 1, 0}, {0xF91E, 4754, 1, 0},
+    {0xF91F, 4755, 1, 0}, {0xF920, 4756, 1, 0}, {0xF921, 4757, 1, 0}, {0xF922, 4758, 1, 0},
+    {0xF923, 4759, 1, 0}, {0xF924, 4760, 1, 0}, {0xF925, 4761, 1, 0}, {0xF926, 4762, 1, 0},
+    {0xF927, 4763, 1, 0}, {0xF928, 4764, 1, 0}, {0xF929, 4765, 1, 0}, {0xF92A, 4766, 1, 0},
+    {0xF92B, 4767, 1, 0}, {0xF92C, 4768, 1, 0}, {0xF92D, 4769, 1, 0}, {0xF92E, 4770, 1, 0},
+    {0xF92F, 4771, 1, 0}, {0xF930, 4772, 1, 0}, {0xF931, 4773, 1, 0}, {0xF932, 4774, 1, 0},
+    {0xF933, 4775, 1, 0}, {0xF934, 4776, 1, 0}, {0xF935, 4777, 1, 0}, {0xF936, 4778, 1, 0},
+    {0xF937, 4779, 1, 0}, {0xF938, 4780, 1, 0}, {0xF939, 4781, 1, 0}, {0xF93A, 4782, 1, 0},
+    {0xF93B, 4783, 1, 0}, {0xF93C, 4784, 1, 0}, {0xF93D, 4785, 1, 0}, {0xF93E, 4786, 1, 0},
+    {0xF93F, 4787, 1, 0}, {0xF940, 4788, 1, 0}, {0xF941, 4789, 1, 0}, {0xF942, 4790, 1, 0},
+    {0xF943, 4791, 1, 0}, {0xF944, 4792, 1, 0}, {0xF945, 4793, 1, 0}, {0xF946, 4794, 1, 0},
+    {0xF947, 4795, 1, 0}, {0xF948, 4796, 1, 0}, {0xF949, 4797, 1, 0}, {0xF94A, 4798, 1, 0},
+    {0xF94B, 4799, 1, 0}, {0xF94C, 4800, 1, 0}, {0xF94D, 4801, 1, 0}, {0xF94E, 4802, 1, 0},
+    {0xF94F, 4803, 1, 0}, {0xF950, 4804, 1, 0}, {0xF951, 4805, 1, 0}, {0xF952, 4806, 1, 0},
+    {0xF953, 4807, 1, 0}, {0xF954, 4808, 1, 0}, {0xF955, 4809, 1, 0}, {0xF956, 4810, 1, 0},
+    {0xF957, 4811, 1, 0}, {0xF958, 4812, 1, 0}, {0xF959, 4813, 1, 0}, {0xF95A, 4814, 1, 0},
+    {0xF95B, 4815, 1, 0}, {0xF95C, 4816, 1, 0}, {0xF95D, 4817, 1, 0}, {0xF95E, 4818, 1, 0},
+    {0xF95F, 4819, 1, 0}, {0xF960, 4820, 1, 0}, {0xF961, 4821, 1, 0}, {0xF962, 4822, 1, 0},
+    {0xF963, 4823, 1, 0}, {0xF964, 4824, 1, 0}, {0xF965, 4825, 1, 0}, {0xF966, 4826, 1, 0},
+    {0xF967, 4827, 1, 0}, {0xF968, 4828, 1, 0}, {0xF969, 4829, 1, 0}, {0xF96A, 4830, 1, 0},
+    {0xF96B, 4831, 1, 0}, {0xF96C, 4832, 1, 0}, {0xF96D, 4833, 1, 0}, {0xF96E, 4834, 1, 0},
+    {0xF96F, 4835, 1, 0}, {0xF970, 4836, 1, 0}, {0xF971, 4837, 1, 0}, {0xF972, 4838, 1, 0},
+    {0xF973, 4839, 1, 0}, {0xF974, 4840, 1, 0}, {0xF975, 4841, 1, 0}, {0xF976, 4842, 1, 0},
+    {0xF977, 4843, 1, 0}, {0xF978, 4844, 1, 0}, {0xF979, 4845, 1, 0}, {0xF97A, 4846, 1, 0},
+    {0xF97B, 4847, 1, 0}, {0xF97C, 4848, 1, 0}, {0xF97D, 4849, 1, 0}, {0xF97E, 4850, 1, 0},
+    {0xF97F, 4851, 1, 0}, {0xF980, 4852, 1, 0}, {0xF981, 4853, 1, 0}, {0xF982, 4854, 1, 0},
+    {0xF983, 4855, 1, 0}, {0xF984, 4856, 1, 0}, {0xF985, 4857, 1, 0}, {0xF986, 4858, 1, 0},
+    {0xF987, 4859, 1, 0}, {0xF988, 4860, 1, 0}, {0xF989, 4861, 1, 0}, {0xF98A, 4862, 1, 0},
+    {0xF98B, 4863, 1, 0}, {0xF98C, 4864, 1, 0}, {0xF98D, 4865, 1, 0}, {0xF98E, 4866, 1, 0},
+    {0xF98F, 4867, 1, 0}, {0xF990, 4868, 1, 0}, {0xF991, 4869, 1, 0}, {0xF992, 4870, 1, 0},
+    {0xF993, 4871, 1, 0}, {0xF994, 4872, 1, 0}, {0xF995, 4873, 1, 0}, {0xF996, 4874, 1, 0},
+    {0xF997, 4875, 1, 0}, {0xF998, 4876, 1, 0}, {0xF999, 4877, 1, 0}, {0xF99A, 4878, 1, 0},
+    {0xF99B, 4879, 1, 0}, {0xF99C, 4880, 1, 0}, {0xF99D, 4881, 1, 0}, {0xF99E, 4882, 1, 0},
+    {0xF99F, 4883, 1, 0}, {0xF9A0, 4884, 1, 0}, {0xF9A1, 4885, 1, 0}, {0xF9A2, 4886, 1, 0},
+    {0xF9A3, 4887, 1, 0}, {0xF9A4, 4888, 1, 0}, {0xF9A5, 4889, 1, 0}, {0xF9A6, 4890, 1, 0},
+    {0xF9A7, 4891, 1, 0}, {0xF9A8, 4892, 1, 0}, {0xF9A9, 4893, 1, 0}, {0xF9AA, 4894, 1, 0},
+    {0xF9AB, 4895, 1, 0}, {0xF9AC, 4896, 1, 0}, {0xF9AD, 4897, 1, 0}, {0xF9AE, 4898, 1, 0},
+    {0xF9AF, 4899, 1, 0}, {0xF9B0, 4900, 1, 0}, {0xF9B1, 4901, 1, 0}, {0xF9B2, 4902, 1, 0},
+    {0xF9B3, 4903, 1, 0}, {0xF9B4, 4904, 1, 0}, {0xF9B5, 4905, 1, 0}, {0xF9B6, 4906, 1, 0},
+    {0xF9B7, 4907, 1, 0}, {0xF9B8, 4908, 1, 0}, {0xF9B9, 4909, 1, 0}, {0xF9BA, 4910, 1, 0},
+    {0xF9BB, 4911, 1, 0}, {0xF9BC, 4912, 1, 0}, {0xF9BD, 4913, 1, 0}, {0xF9BE, 4914, 1, 0},
+    {0xF9BF, 4915, 1, 0}, {0xF9C0, 4916, 1, 0}, {0xF9C1, 4917, 1, 0}, {0xF9C2, 4918, 1, 0},
+    {0xF9C3, 4919, 1, 0}, {0xF9C4, 4920, 1, 0}, {0xF9C5, 4921, 1, 0}, {0xF9C6, 4922, 1, 0},
+    {0xF9C7, 4923, 1, 0}, {0xF9C8, 4924, 1, 0}, {0xF9C9, 4925, 1, 0}, {0xF9CA, 4926, 1, 0},
+    {0xF9CB, 4927, 1, 0}, {0xF9CC, 4928, 1, 0}, {0xF9CD, 4929, 1, 0}, {0xF9CE, 4930, 1, 0},
+    {0xF9CF, 4931, 1, 0}, {0xF9D0, 4932, 1, 0}, {0xF9D1, 4933, 1, 0}, {0xF9D2, 4934, 1, 0},
+    {0xF9D3, 4935, 1, 0}, {0xF9D4, 4936, 1, 0}, {0xF9D5, 4937, 1, 0}, {0xF9D6, 4938, 1, 0},
+    {0xF9D7, 4939, 1, 0}, {0xF9D8, 4940, 1, 0}, {0xF9D9, 4941, 1, 0}, {0xF9DA, 4942, 1, 0},
+    {0xF9DB, 4943, 1, 0}, {0xF9DC, 4944, 1, 0}, {0xF9DD, 4945, 1, 0}, {0xF9DE, 4946, 1, 0},
+    {0xF9DF, 4947, 1, 0}, {0xF9E0, 4948, 1, 0}, {0xF9E1, 4949, 1, 0}, {0xF9E2, 4950, 1, 0},
+    {0xF9E3, 4951, 1, 0}, {0xF9E4, 4952, 1, 0}, {0xF9E5, 4953, 1, 0}, {0xF9E6, 4954, 1, 0},
+    {0xF9E7, 4955, 1, 0}, {0xF9E8, 4956, 1, 0}, {0xF9E9, 4957, 1, 0}, {0xF9EA, 4958, 1, 0},
+    {0xF9EB, 4959, 1, 0}, {0xF9EC, 4960, 1, 0}, {0xF9ED, 4961, 1, 0}, {0xF9EE, 4962, 1, 0},
+    {0xF9EF, 4963, 1, 0}, {0xF9F0, 4964, 1, 0}, {0xF9F1, 4965, 1, 0}, {0xF9F2, 4966, 1, 0},
+    {0xF9F3, 4967, 1, 0}, {0xF9F4, 4968, 1, 0}, {0xF9F5, 4969, 1, 0}, {0xF9F6, 4970, 1, 0},
+    {0xF9F7, 4971, 1, 0}, {0xF9F8, 4972, 1, 0}, {0xF9F9, 4973, 1, 0}, {0xF9FA, 4974, 1, 0},
+    {0xF9FB, 4975, 1, 0}, {0xF9FC, 4976, 1, 0}, {0xF9FD, 4977, 1, 0}, {0xF9FE, 4978, 1, 0},
+    {0xF9FF, 4979, 1, 0}, {0xFA00, 4980, 1, 0}, {0xFA01, 4981, 1, 0}, {0xFA02, 4982, 1, 0},
+    {0xFA03, 4983, 1, 0}, {0xFA04, 4984, 1, 0}, {0xFA05, 4985, 1, 0}, {0xFA06, 4986, 1, 0},
+    {0xFA07, 4987, 1, 0}, {0xFA08, 4988, 1, 0}, {0xFA09, 4989, 1, 0}, {0xFA0A, 4990, 1, 0},
+    {0xFA0B, 4991, 1, 0}, {0xFA0C, 4992, 1, 0}, {0xFA0D, 4993, 1, 0}, {0xFA10, 4994, 1, 0},
+    {0xFA12, 4995, 1, 0}, {0xFA15, 4996, 1, 0}, {0xFA16, 4997, 1, 0}, {0xFA17, 4998, 1, 0},
+    {0xFA18, 4999, 1, 0}, {0xFA19, 5000, 1, 0}, {0xFA1A, 5001, 1, 0}, {0xFA1B, 5002, 1, 0},
+    {0xFA1C, 5003, 1, 0}, {0xFA1D, 5004, 1, 0}, {0xFA1E, 5005, 1, 0}, {0xFA20, 5006, 1, 0},
+    {0xFA22, 5007, 1, 0}, {0xFA25, 5008, 1, 0}, {0xFA26, 5009, 1, 0}, {0xFA2A, 5010, 1, 0},
+    {0xFA2B, 5011, 1, 0}, {0xFA2C, 5012, 1, 0}, {0xFA2D, 5013, 1, 0}, {0xFA2E, 5014, 1, 0},
+    {0xFA2F, 5015, 1, 0}, {0xFA30, 5016, 1, 0}, {0xFA31, 5017, 1, 0}, {0xFA32, 5018, 1, 0},
+    {0xFA33, 5019, 1, 0}, {0xFA34, 5020, 1, 0}, {0xFA35, 5021, 1, 0}, {0xFA36, 5022, 1, 0},
+    {0xFA37, 5023, 1, 0}, {0xFA38, 5024, 1, 0}, {0xFA39, 5025, 1, 0}, {0xFA3A, 5026, 1, 0},
+    {0xFA3B, 5027, 1, 0}, {0xFA3C, 5028, 1, 0}, {0xFA3D, 5029, 1, 0}, {0xFA3E, 5030, 1, 0},
+    {0xFA3F, 5031, 1, 0}, {0xFA40, 5032, 1, 0}, {0xFA41, 5033, 1, 0}, {0xFA42, 5034, 1, 0},
+    {0xFA43, 5035, 1, 0}, {0xFA44, 5036, 1, 0}, {0xFA45, 5037, 1, 0}, {0xFA46, 5038, 1, 0},
+    {0xFA47, 5039, 1, 0}, {0xFA48, 5040, 1, 0}, {0xFA49, 5041, 1, 0}, {0xFA4A, 5042, 1, 0},
+    {0xFA4B, 5043, 1, 0}, {0xFA4C, 5044, 1, 0}, {0xFA4D, 5045, 1, 0}, {0xFA4E, 5046, 1, 0},
+    {0xFA4F, 5047, 1, 0}, {0xFA50, 5048, 1, 0}, {0xFA51, 5049, 1, 0}, {0xFA52, 5050, 1, 0},
+    {0xFA53, 5051, 1, 0}, {0xFA54, 5052, 1, 0}, {0xFA55, 5053, 1, 0}, {0xFA56, 5054, 1, 0},
+    {0xFA57, 5055, 1, 0}, {0xFA58, 5056, 1, 0}, {0xFA59, 5057, 1, 0}, {0xFA5A, 5058, 1, 0},
+    {0xFA5B, 5059, 1, 0}, {0xFA5C, 5060, 1, 0}, {0xFA5D, 5061, 1, 0}, {0xFA5E, 5062, 1, 0},
+    {0xFA5F, 5063, 1, 0}, {0xFA60, 5064, 1, 0}, {0xFA61, 5065, 1, 0}, {0xFA62, 5066, 1, 0},
+    {0xFA63, 5067, 1, 0}, {0xFA64, 5068, 1, 0}, {0xFA65, 5069, 1, 0}, {0xFA66, 5070, 1, 0},
+    {0xFA67, 5071, 1, 0}, {0xFA68, 5072, 1, 0}, {0xFA69, 5073, 1, 0}, {0xFA6A, 5074, 1, 0},
+    {0xFA6B, 5075, 1, 0}, {0xFA6C, 5076, 1, 0}, {0xFA6D, 5077, 1, 0}, {0xFA70, 5078, 1, 0},
+    {0xFA71, 5079, 1, 0}, {0xFA72, 5080, 1, 0}, {0xFA73, 5081, 1, 0}, {0xFA74, 5082, 1, 0},
+    {0xFA75, 5083, 1, 0}, {0xFA76, 5084, 1, 0}, {0xFA77, 5085, 1, 0}, {0xFA78, 5086, 1, 0},
+    {0xFA79, 5087, 1, 0}, {0xFA7A, 5088, 1, 0}, {0xFA7B, 5089, 1, 0}, {0xFA7C, 5090, 1, 0},
+    {0xFA7D, 5091, 1, 0}, {0xFA7E, 5092, 1, 0}, {0xFA7F, 5093, 1, 0}, {0xFA80, 5094, 1, 0},
+    {0xFA81, 5095, 1, 0}, {0xFA82, 5096, 1, 0}, {0xFA83, 5097, 1, 0}, {0xFA84, 5098, 1, 0},
+    {0xFA85, 5099, 1, 0}, {0xFA86, 5100, 1, 0}, {0xFA87, 5101, 1, 0}, {0xFA88, 5102, 1, 0},
+    {0xFA89, 5103, 1, 0}, {0xFA8A, 5104, 1, 0}, {0xFA8B, 5105, 1, 0}, {0xFA8C, 5106, 1, 0},
+    {0xFA8D, 5107, 1, 0}, {0xFA8E, 5108, 1, 0}, {0xFA8F, 5109, 1, 0}, {0xFA90, 5110, 1, 0},
+    {0xFA91, 5111, 1, 0}, {0xFA92, 5112, 1, 0}, {0xFA93, 5113, 1, 0}, {0xFA94, 5114, 1, 0},
+    {0xFA95, 5115, 1, 0}, {0xFA96, 5116, 1, 0}, {0xFA97, 5117, 1, 0}, {0xFA98, 5118, 1, 0},
+    {0xFA99, 5119, 1, 0}, {0xFA9A, 5120, 1, 0}, {0xFA9B, 5121, 1, 0}, {0xFA9C, 5122, 1, 0},
+    {0xFA9D, 5123, 1, 0}, {0xFA9E, 5124, 1, 0}, {0xFA9F, 5125, 1, 0}, {0xFAA0, 5126, 1, 0},
+    {0xFAA1, 5127, 1, 0}, {0xFAA2, 5128, 1, 0}, {0xFAA3, 5129, 1, 0}, {0xFAA4, 5130, 1, 0},
+    {0xFAA5, 5131, 1, 0}, {0xFAA6, 5132, 1, 0}, {0xFAA7, 5133, 1, 0}, {0xFAA8, 5134, 1, 0},
+    {0xFAA9, 5135, 1, 0}, {0xFAAA, 5136, 1, 0}, {0xFAAB, 5137, 1, 0}, {0xFAAC, 5138, 1, 0},
+    {0xFAAD, 5139, 1, 0}, {0xFAAE, 5140, 1, 0}, {0xFAAF, 5141, 1, 0}, {0xFAB0, 5142, 1, 0},
+    {0xFAB1, 5143, 1, 0}, {0xFAB2, 5144, 1, 0}, {0xFAB3, 5145, 1, 0}, {0xFAB4, 5146, 1, 0},
+    {0xFAB5, 5147, 1, 0}, {0xFAB6, 5148, 1, 0}, {0xFAB7, 5149, 1, 0}, {0xFAB8, 5150, 1, 0},
+    {0xFAB9, 5151, 1, 0}, {0xFABA, 5152, 1, 0}, {0xFABB, 5153, 1, 0}, {0xFABC, 5154, 1, 0},
+    {0xFABD, 5155, 1, 0}, {0xFABE, 5156, 1, 0}, {0xFABF, 5157, 1, 0}, {0xFAC0, 5158, 1, 0},
+    {0xFAC1, 5159, 1, 0}, {0xFAC2, 5160, 1, 0}, {0xFAC3, 5161, 1, 0}, {0xFAC4, 5162, 1, 0},
+    {0xFAC5, 5163, 1, 0}, {0xFAC6, 5164, 1, 0}, {0xFAC7, 5165, 1, 0}, {0xFAC8, 5166, 1, 0},
+    {0xFAC9, 5167, 1, 0}, {0xFACA, 5168, 1, 0}, {0xFACB, 5169, 1, 0}, {0xFACC, 5170, 1, 0},
+    {0xFACD, 5171, 1, 0}, {0xFACE, 5172, 1, 0}, {0xFACF, 5173, 1, 0}, {0xFAD0, 5174, 1, 0},
+    {0xFAD1, 5175, 1, 0}, {0xFAD2, 5176, 1, 0}, {0xFAD3, 5177, 1, 0}, {0xFAD4, 5178, 1, 0},
+    {0xFAD5, 5179, 1, 0}, {0xFAD6, 5180, 1, 0}, {0xFAD7, 5181, 1, 0}, {0xFAD8, 5182, 1, 0},
+    {0xFAD9, 5183, 1, 0}, {0xFB00, 5184, 2, 1}, {0xFB01, 5186, 2, 1}, {0xFB02, 5188, 2, 1},
+    {0xFB03, 5190, 3, 1}, {0xFB04, 5193, 3, 1}, {0xFB05, 5196, 2, 1}, {0xFB06, 5198, 2, 1},
+    {0xFB13, 5200, 2, 1}, {0xFB14, 5202, 2, 1}, {0xFB15, 5204, 2, 1}, {0xFB16, 5206, 2, 1},
+    {0xFB17, 5208, 2, 1}, {0xFB1D, 5210, 2, 0}, {0xFB1F, 5212, 2, 0}, {0xFB20, 5214, 1, 1},
+    {0xFB21, 5215, 1, 1}, {0xFB22, 5216, 1, 1}, {0xFB23, 5217, 1, 1}, {0xFB24, 5218, 1, 1},
+    {0xFB25, 5219, 1, 1}, {0xFB26, 5220, 1, 1}, {0xFB27, 5221, 1, 1}, {0xFB28, 5222, 1, 1},
+    {0xFB29, 5223, 1, 1}, {0xFB2A, 5224, 2, 0}, {0xFB2B, 5226, 2, 0}, {0xFB2C, 5228, 3, 0},
+    {0xFB2D, 5231, 3, 0}, {0xFB2E, 5234, 2, 0}, {0xFB2F, 5236, 2, 0}, {0xFB30, 5238, 2, 0},
+    {0xFB31, 5240, 2, 0}, {0xFB32, 5242, 2, 0}, {0xFB33, 5244, 2, 0}, {0xFB34, 5246, 2, 0},
+    {0xFB35, 5248, 2, 0}, {0xFB36, 5250, 2, 0}, {0xFB38, 5252, 2, 0}, {0xFB39, 5254, 2, 0},
+    {0xFB3A, 5256, 2, 0}, {0xFB3B, 5258, 2, 0}, {0xFB3C, 5260, 2, 0}, {0xFB3E, 5262, 2, 0},
+    {0xFB40, 5264, 2, 0}, {0xFB41, 5266, 2, 0}, {0xFB43, 5268, 2, 0}, {0xFB44, 5270, 2, 0},
+    {0xFB46, 5272, 2, 0}, {0xFB47, 5274, 2, 0}, {0xFB48, 5276, 2, 0}, {0xFB49, 5278, 2, 0},
+    {0xFB4A, 5280, 2, 0}, {0xFB4B, 5282, 2, 0}, {0xFB4C, 5284, 2, 0}, {0xFB4D, 5286, 2, 0},
+    {0xFB4E, 5288, 2, 0}, {0xFB4F, 5290, 2, 1}, {0xFB50, 5292, 1, 1}, {0xFB51, 5293, 1, 1},
+    {0xFB52, 5294, 1, 1}, {0xFB53, 5295, 1, 1}, {0xFB54, 5296, 1, 1}, {0xFB55, 5297, 1, 1},
+    {0xFB56, 5298, 1, 1}, {0xFB57, 5299, 1, 1}, {0xFB58, 5300, 1, 1}, {0xFB59, 5301, 1, 1},
+    {0xFB5A, 5302, 1, 1}, {0xFB5B, 5303, 1, 1}, {0xFB5C, 5304, 1, 1}, {0xFB5D, 5305, 1, 1},
+    {0xFB5E, 5306, 1, 1}, {0xFB5F, 5307, 1, 1}, {0xFB60, 5308, 1, 1}, {0xFB61, 5309, 1, 1},
+    {0xFB62, 5310, 1, 1}, {0xFB63, 5311, 1, 1}, {0xFB64, 5312, 1, 1}, {0xFB65, 5313, 1, 1},
+    {0xFB66, 5314, 1, 1}, {0xFB67, 5315, 1, 1}, {0xFB68, 5316, 1, 1}, {0xFB69, 5317, 1, 1},
+    {0xFB6A, 5318, 1, 1}, {0xFB6B, 5319, 1, 1}, {0xFB6C, 5320, 1, 1}, {0xFB6D, 5321, 1, 1},
+    {0xFB6E, 5322, 1, 1}, {0xFB6F, 5323, 1, 1}, {0xFB70, 5324, 1, 1}, {0xFB71, 5325, 1, 1},
+    {0xFB72, 5326, 1, 1}, {0xFB73, 5327, 1, 1}, {0xFB74, 5328, 1, 1}, {0xFB75, 5329, 1, 1},
+    {0xFB76, 5330, 1, 1}, {0xFB77, 5331, 1, 1}, {0xFB78, 5332, 1, 1}, {0xFB79, 5333, 1, 1},
+    {0xFB7A, 5334, 1, 1}, {0xFB7B, 5335, 1, 1}, {0xFB7C, 5336, 1, 1}, {0xFB7D, 5337, 1, 1},
+    {0xFB7E, 5338, 1, 1}, {0xFB7F, 5339, 1, 1}, {0xFB80, 5340, 1, 1}, {0xFB81, 5341, 1, 1},
+    {0xFB82, 5342, 1, 1}, {0xFB83, 5343, 1, 1}, {0xFB84, 5344, 1, 1}, {0xFB85, 5345, 1, 1},
+    {0xFB86, 5346, 1, 1}, {0xFB87, 5347, 1, 1}, {0xFB88, 5348, 1, 1}, {0xFB89, 5349, 1, 1},
+    {0xFB8A, 5350, 1, 1}, {0xFB8B, 5351, 1, 1}, {0xFB8C, 5352, 1, 1}, {0xFB8D, 5353, 1, 1},
+    {0xFB8E, 5354, 1, 1}, {0xFB8F, 5355, 1, 1}, {0xFB90, 5356, 1, 1}, {0xFB91, 5357, 1, 1},
+    {0xFB92, 5358, 1, 1}, {0xFB93, 5359, 1, 1}, {0xFB94, 5360, 1, 1}, {0xFB95, 5361, 1, 1},
+    {0xFB96, 5362, 1, 1}, {0xFB97, 5363, 1, 1}, {0xFB98, 5364, 1, 1}, {0xFB99, 5365, 1, 1},
+    {0xFB9A, 5366, 1, 1}, {0xFB9B, 5367, 1, 1}, {0xFB9C, 5368, 1, 1}, {0xFB9D, 5369, 1, 1},
+    {0xFB9E, 5370, 1, 1}, {0xFB9F, 5371, 1, 1}, {0xFBA0, 5372, 1, 1}, {0xFBA1, 5373, 1, 1},
+    {0xFBA2, 5374, 1, 1}, {0xFBA3, 5375, 1, 1}, {0xFBA4, 5376, 2, 1}, {0xFBA5, 5378, 2, 1},
+    {0xFBA6, 5380, 1, 1}, {0xFBA7, 5381, 1, 1}, {0xFBA8, 5382, 1, 1}, {0xFBA9, 5383, 1, 1},
+    {0xFBAA, 5384, 1, 1}, {0xFBAB, 5385, 1, 1}, {0xFBAC, 5386, 1, 1}, {0xFBAD, 5387, 1, 1},
+    {0xFBAE, 5388, 1, 1}, {0xFBAF, 5389, 1, 1}, {0xFBB0, 5390, 2, 1}, {0xFBB1, 5392, 2, 1},
+    {0xFBD3, 5394, 1, 1}, {0xFBD4, 5395, 1, 1}, {0xFBD5, 5396, 1, 1}, {0xFBD6, 5397, 1, 1},
+    {0xFBD7, 5398, 1, 1}, {0xFBD8, 5399, 1, 1}, {0xFBD9, 5400, 1, 1}, {0xFBDA, 5401, 1, 1},
+    {0xFBDB, 5402, 1, 1}, {0xFBDC, 5403, 1, 1}, {0xFBDD, 5404, 2, 1}, {0xFBDE, 5406, 1, 1},
+    {0xFBDF, 5407, 1, 1}, {0xFBE0, 5408, 1, 1}, {0xFBE1, 5409, 1, 1}, {0xFBE2, 5410, 1, 1},
+    {0xFBE3, 5411, 1, 1}, {0xFBE4, 5412, 1, 1}, {0xFBE5, 5413, 1, 1}, {0xFBE6, 5414, 1, 1},
+    {0xFBE7, 5415, 1, 1}, {0xFBE8, 5416, 1, 1}, {0xFBE9, 5417, 1, 1}, {0xFBEA, 5418, 3, 1},
+    {0xFBEB, 5421, 3, 1}, {0xFBEC, 5424, 3, 1}, {0xFBED, 5427, 3, 1}, {0xFBEE, 5430, 3, 1},
+    {0xFBEF, 5433, 3, 1}, {0xFBF0, 5436, 3, 1}, {0xFBF1, 5439, 3, 1}, {0xFBF2, 5442, 3, 1},
+    {0xFBF3, 5445, 3, 1}, {0xFBF4, 5448, 3, 1}, {0xFBF5, 5451, 3, 1}, {0xFBF6, 5454, 3, 1},
+    {0xFBF7, 5457, 3, 1}, {0xFBF8, 5460, 3, 1}, {0xFBF9, 5463, 3, 1}, {0xFBFA, 5466, 3, 1},
+    {0xFBFB, 5469, 3, 1}, {0xFBFC, 5472, 1, 1}, {0xFBFD, 5473, 1, 1}, {0xFBFE, 5474, 1, 1},
+    {0xFBFF, 5475, 1, 1}, {0xFC00, 5476, 3, 1}, {0xFC01, 5479, 3, 1}, {0xFC02, 5482, 3, 1},
+    {0xFC03, 5485, 3, 1}, {0xFC04, 5488, 3, 1}, {0xFC05, 5491, 2, 1}, {0xFC06, 5493, 2, 1},
+    {0xFC07, 5495, 2, 1}, {0xFC08, 5497, 2, 1}, {0xFC09, 5499, 2, 1}, {0xFC0A, 5501, 2, 1},
+    {0xFC0B, 5503, 2, 1}, {0xFC0C, 5505, 2, 1}, {0xFC0D, 5507, 2, 1}, {0xFC0E, 5509, 2, 1},
+    {0xFC0F, 5511, 2, 1}, {0xFC10, 5513, 2, 1}, {0xFC11, 5515, 2, 1}, {0xFC12, 5517, 2, 1},
+    {0xFC13, 5519, 2, 1}, {0xFC14, 5521, 2, 1}, {0xFC15, 5523, 2, 1}, {0xFC16, 5525, 2, 1},
+    {0xFC17, 5527, 2, 1}, {0xFC18, 5529, 2, 1}, {0xFC19, 5531, 2, 1}, {0xFC1A, 5533, 2, 1},
+    {0xFC1B, 5535, 2, 1}, {0xFC1C, 5537, 2, 1}, {0xFC1D, 5539, 2, 1}, {0xFC1E, 5541, 2, 1},
+    {0xFC1F, 5543, 2, 1}, {0xFC20, 5545, 2, 1}, {0xFC21, 5547, 2, 1}, {0xFC22, 5549, 2, 1},
+    {0xFC23, 5551, 2, 1}, {0xFC24, 5553, 2, 1}, {0xFC25, 5555, 2, 1}, {0xFC26, 5557, 2, 1},
+    {0xFC27, 5559, 2, 1}, {0xFC28, 5561, 2, 1}, {0xFC29, 5563, 2, 1}, {0xFC2A, 5565, 2, 1},
+    {0xFC2B, 5567, 2, 1}, {0xFC2C, 5569, 2, 1}, {0xFC2D, 5571, 2, 1}, {0xFC2E, 5573, 2, 1},
+    {0xFC2F, 5575, 2, 1}, {0xFC30, 5577, 2, 1}, {0xFC31, 5579, 2, 1}, {0xFC32, 5581, 2, 1},
+    {0xFC33, 5583, 2, 1}, {0xFC34, 5585, 2, 1}, {0xFC35, 5587, 2, 1}, {0xFC36, 5589, 2, 1},
+    {0xFC37, 5591, 2, 1}, {0xFC38, 5593, 2, 1}, {0xFC39, 5595, 2, 1}, {0xFC3A, 5597, 2, 1},
+    {0xFC3B, 5599, 2, 1}, {0xFC3C, 5601, 2, 1}, {0xFC3D, 5603, 2, 1}, {0xFC3E, 5605, 2, 1},
+    {0xFC3F, 5607, 2, 1}, {0xFC40, 5609, 2, 1}, {0xFC41, 5611, 2, 1}, {0xFC42, 5613, 2, 1},
+    {0xFC43, 5615, 2, 1}, {0xFC44, 5617, 2, 1}, {0xFC45, 5619, 2, 1}, {0xFC46, 5621, 2, 1},
+    {0xFC47, 5623, 2, 1}, {0xFC48, 5625, 2, 1}, {0xFC49, 5627, 2, 1}, {0xFC4A, 5629, 2, 1},
+    {0xFC4B, 5631, 2, 1}, {0xFC4C, 5633, 2, 1}, {0xFC4D, 5635, 2, 1}, {0xFC4E, 5637, 2, 1},
+    {0xFC4F, 5639, 2, 1}, {0xFC50, 5641, 2, 1}, {0xFC51, 5643, 2, 1}, {0xFC52, 5645, 2, 1},
+    {0xFC53, 5647, 2, 1}, {0xFC54, 5649, 2, 1}, {0xFC55, 5651, 2, 1}, {0xFC56, 5653, 2, 1},
+    {0xFC57, 5655, 2, 1}, {0xFC58, 5657, 2, 1}, {0xFC59, 5659, 2, 1}, {0xFC5A, 5661, 2, 1},
+    {0xFC5B, 5663, 2, 1}, {0xFC5C, 5665, 2, 1}, {0xFC5D, 5667, 2, 1}, {0xFC5E, 5669, 3, 1},
+    {0xFC5F, 5672, 3, 1}, {0xFC60, 5675, 3, 1}, {0xFC61, 5678, 3, 1}, {0xFC62, 5681, 3, 1},
+    {0xFC63, 5684, 3, 1}, {0xFC64, 5687, 3, 1}, {0xFC65, 5690, 3, 1}, {0xFC66, 5693, 3, 1},
+    {0xFC67, 5696, 3, 1}, {0xFC68, 5699, 3, 1}, {0xFC69, 5702, 3, 1}, {0xFC6A, 5705, 2, 1},
+    {0xFC6B, 5707, 2, 1}, {0xFC6C, 5709, 2, 1}, {0xFC6D, 5711, 2, 1}, {0xFC6E, 5713, 2, 1},
+    {0xFC6F, 5715, 2, 1}, {0xFC70, 5717, 2, 1}, {0xFC71, 5719, 2, 1}, {0xFC72, 5721, 2, 1},
+    {0xFC73, 5723, 2, 1}, {0xFC74, 5725, 2, 1}, {0xFC75, 5727, 2, 1}, {0xFC76, 5729, 2, 1},
+    {0xFC77, 5731, 2, 1}, {0xFC78, 5733, 2, 1}, {0xFC79, 5735, 2, 1}, {0xFC7A, 5737, 2, 1},
+    {0xFC7B, 5739, 2, 1}, {0xFC7C, 5741, 2, 1}, {0xFC7D, 5743, 2, 1}, {0xFC7E, 5745, 2, 1},
+    {0xFC7F, 5747, 2, 1}, {0xFC80, 5749, 2, 1}, {0xFC81, 5751, 2, 1}, {0xFC82, 5753, 2, 1},
+    {0xFC83, 5755, 2, 1}, {0xFC84, 5757, 2, 1}, {0xFC85, 5759, 2, 1}, {0xFC86, 5761, 2, 1},
+    {0xFC87, 5763, 2, 1}, {0xFC88, 5765, 2, 1}, {0xFC89, 5767, 2, 1}, {0xFC8A, 5769, 2, 1},
+    {0xFC8B, 5771, 2, 1}, {0xFC8C, 5773, 2, 1}, {0xFC8D, 5775, 2, 1}, {0xFC8E, 5777, 2, 1},
+    {0xFC8F, 5779, 2, 1}, {0xFC90, 5781, 2, 1}, {0xFC91, 5783, 2, 1}, {0xFC92, 5785, 2, 1},
+    {0xFC93, 5787, 2, 1}, {0xFC94, 5789, 2, 1}, {0xFC95, 5791, 2, 1}, {0xFC96, 5793, 2, 1},
+    {0xFC97, 5795, 3, 1}, {0xFC98, 5798, 3, 1}, {0xFC99, 5801, 3, 1}, {0xFC9A, 5804, 3, 1},
+    {0xFC9B, 5807, 3, 1}, {0xFC9C, 5810, 2, 1}, {0xFC9D, 5812, 2, 1}, {0xFC9E, 5814, 2, 1},
+    {0xFC9F, 5816, 2, 1}, {0xFCA0, 5818, 2, 1}, {0xFCA1, 5820, 2, 1}, {0xFCA2, 5822, 2, 1},
+    {0xFCA3, 5824, 2, 1}, {0xFCA4, 5826, 2, 1}, {0xFCA5, 5828, 2, 1}, {0xFCA6, 5830, 2, 1},
+    {0xFCA7, 5832, 2, 1}, {0xFCA8, 5834, 2, 1}, {0xFCA9, 5836, 2, 1}, {0xFCAA, 5838, 2, 1},
+    {0xFCAB, 5840, 2, 1}, {0xFCAC, 5842, 2, 1}, {0xFCAD, 5844, 2, 1}, {0xFCAE, 5846, 2, 1},
+    {0xFCAF, 5848, 2, 1}, {0xFCB0, 5850, 2, 1}, {0xFCB1, 5852, 2, 1}, {0xFCB2, 5854, 2, 1},
+    {0xFCB3, 5856, 2, 1}, {0xFCB4, 5858, 2, 1}, {0xFCB5, 5860, 2, 1}, {0xFCB6, 5862, 2, 1},
+    {0xFCB7, 5864, 2, 1}, {0xFCB8, 5866, 2, 1}, {0xFCB9, 5868, 2, 1}, {0xFCBA, 5870, 2, 1},
+    {0xFCBB, 5872, 2, 1}, {0xFCBC, 5874, 2, 1}, {0xFCBD, 5876, 2, 1}, {0xFCBE, 5878, 2, 1},
+    {0xFCBF, 5880, 2, 1}, {0xFCC0, 5882, 2, 1}, {0xFCC1, 5884, 2, 1}, {0xFCC2, 5886, 2, 1},
+    {0xFCC3, 5888, 2, 1}, {0xFCC4, 5890, 2, 1}, {0xFCC5, 5892, 2, 1}, {0xFCC6, 5894, 2, 1},
+    {0xFCC7, 5896, 2, 1}, {0xFCC8, 5898, 2, 1}, {0xFCC9, 5900, 2, 1}, {0xFCCA, 5902, 2, 1},
+    {0xFCCB, 5904, 2, 1}, {0xFCCC, 5906, 2, 1}, {0xFCCD, 5908, 2, 1}, {0xFCCE, 5910, 2, 1},
+    {0xFCCF, 5912, 2, 1}, {0xFCD0, 5914, 2, 1}, {0xFCD1, 5916, 2, 1}, {0xFCD2, 5918, 2, 1},
+    {0xFCD3, 5920, 2, 1}, {0xFCD4, 5922, 2, 1}, {0xFCD5, 5924, 2, 1}, {0xFCD6, 5926, 2, 1},
+    {0xFCD7, 5928, 2, 1}, {0xFCD8, 5930, 2, 1}, {0xFCD9, 5932, 2, 1}, {0xFCDA, 5934, 2, 1},
+    {0xFCDB, 5936, 2, 1}, {0xFCDC, 5938, 2, 1}, {0xFCDD, 5940, 2, 1}, {0xFCDE, 5942, 2, 1},
+    {0xFCDF, 5944, 3, 1}, {0xFCE0, 5947, 3, 1}, {0xFCE1, 5950, 2, 1}, {0xFCE2, 5952, 2, 1},
+    {0xFCE3, 5954, 2, 1}, {0xFCE4, 5956, 2, 1}, {0xFCE5, 5958, 2, 1}, {0xFCE6, 5960, 2, 1},
+    {0xFCE7, 5962, 2, 1}, {0xFCE8, 5964, 2, 1}, {0xFCE9, 5966, 2, 1}, {0xFCEA, 5968, 2, 1},
+    {0xFCEB, 5970, 2, 1}, {0xFCEC, 5972, 2, 1}, {0xFCED, 5974, 2, 1}, {0xFCEE, 5976, 2, 1},
+    {0xFCEF, 5978, 2, 1}, {0xFCF0, 5980, 2, 1}, {0xFCF1, 5982, 2, 1}, {0xFCF2, 5984, 3, 1},
+    {0xFCF3, 5987, 3, 1}, {0xFCF4, 5990, 3, 1}, {0xFCF5, 5993, 2, 1}, {0xFCF6, 5995, 2, 1},
+    {0xFCF7, 5997, 2, 1}, {0xFCF8, 5999, 2, 1}, {0xFCF9, 6001, 2, 1}, {0xFCFA, 6003, 2, 1},
+    {0xFCFB, 6005, 2, 1}, {0xFCFC, 6007, 2, 1}, {0xFCFD, 6009, 2, 1}, {0xFCFE, 6011, 2, 1},
+    {0xFCFF, 6013, 2, 1}, {0xFD00, 6015, 2, 1}, {0xFD01, 6017, 2, 1}, {0xFD02, 6019, 2, 1},
+    {0xFD03, 6021, 2, 1}, {0xFD04, 6023, 2, 1}, {0xFD05, 6025, 2, 1}, {0xFD06, 6027, 2, 1},
+    {0xFD07, 6029, 2, 1}, {0xFD08, 6031, 2, 1}, {0xFD09, 6033, 2, 1}, {0xFD0A, 6035, 2, 1},
+    {0xFD0B, 6037, 2, 1}, {0xFD0C, 6039, 2, 1}, {0xFD0D, 6041, 2, 1}, {0xFD0E, 6043, 2, 1},
+    {0xFD0F, 6045, 2, 1}, {0xFD10, 6047, 2, 1}, {0xFD11, 6049, 2, 1}, {0xFD12, 6051, 2, 1},
+    {0xFD13, 6053, 2, 1}, {0xFD14, 6055, 2, 1}, {0xFD15, 6057, 2, 1}, {0xFD16, 6059, 2, 1},
+    {0xFD17, 6061, 2, 1}, {0xFD18, 6063, 2, 1}, {0xFD19, 6065, 2, 1}, {0xFD1A, 6067, 2, 1},
+    {0xFD1B, 6069, 2, 1}, {0xFD1C, 6071, 2, 1}, {0xFD1D, 6073, 2, 1}, {0xFD1E, 6075, 2, 1},
+    {0xFD1F, 6077, 2, 1}, {0xFD20, 6079, 2, 1}, {0xFD21, 6081, 2, 1}, {0xFD22, 6083, 2, 1},
+    {0xFD23, 6085, 2, 1}, {0xFD24, 6087, 2, 1}, {0xFD25, 6089, 2, 1}, {0xFD26, 6091, 2, 1},
+    {0xFD27, 6093, 2, 1}, {0xFD28, 6095, 2, 1}, {0xFD29, 6097, 2, 1}, {0xFD2A, 6099, 2, 1},
+    {0xFD2B, 6101, 2, 1}, {0xFD2C, 6103, 2, 1}, {0xFD2D, 6105, 2, 1}, {0xFD2E, 6107, 2, 1},
+    {0xFD2F, 6109, 2, 1}, {0xFD30, 6111, 2, 1}, {0xFD31, 6113, 2, 1}, {0xFD32, 6115, 2, 1},
+    {0xFD33, 6117, 2, 1}, {0xFD34, 6119, 2, 1}, {0xFD35, 6121, 2, 1}, {0xFD36, 6123, 2, 1},
+    {0xFD37, 6125, 2, 1}, {0xFD38, 6127, 2, 1}, {0xFD39, 6129, 2, 1}, {0xFD3A, 6131, 2, 1},
+    {0xFD3B, 6133, 2, 1}, {0xFD3C, 6135, 2, 1}, {0xFD3D, 6137, 2, 1}, {0xFD50, 6139, 3, 1},
+    {0xFD51, 6142, 3, 1}, {0xFD52, 6145, 3, 1}, {0xFD53, 6148, 3, 1}, {0xFD54, 6151, 3, 1},
+    {0xFD55, 6154, 3, 1}, {0xFD56, 6157, 3, 1}, {0xFD57, 6160, 3, 1}, {0xFD58, 6163, 3, 1},
+    {0xFD59, 6166, 3, 1}, {0xFD5A, 6169, 3, 1}, {0xFD5B, 6172, 3, 1}, {0xFD5C, 6175, 3, 1},
+    {0xFD5D, 6178, 3, 1}, {0xFD5E, 6181, 3, 1}, {0xFD5F, 6184, 3, 1}, {0xFD60, 6187, 3, 1},
+    {0xFD61, 6190, 3, 1}, {0xFD62, 6193, 3, 1}, {0xFD63, 6196, 3, 1}, {0xFD64, 6199, 3, 1},
+    {0xFD65, 6202, 3, 1}, {0xFD66, 6205, 3, 1}, {0xFD67, 6208, 3, 1}, {0xFD68, 6211, 3, 1},
+    {0xFD69, 6214, 3, 1}, {0xFD6A, 6217, 3, 1}, {0xFD6B, 6220, 3, 1}, {0xFD6C, 6223, 3, 1},
+    {0xFD6D, 6226, 3, 1}, {0xFD6E, 6229, 3, 1}, {0xFD6F, 6232, 3, 1}, {0xFD70, 6235, 3, 1},
+    {0xFD71, 6238, 3, 1}, {0xFD72, 6241, 3, 1}, {0xFD73, 6244, 3, 1}, {0xFD74, 6247, 3, 1},
+    {0xFD75, 6250, 3, 1}, {0xFD76, 6253, 3, 1}, {0xFD77, 6256, 3, 1}, {0xFD78, 6259, 3, 1},
+    {0xFD79, 6262, 3, 1}, {0xFD7A, 6265, 3, 1}, {0xFD7B, 6268, 3, 1}, {0xFD7C, 6271, 3, 1},
+    {0xFD7D, 6274, 3, 1}, {0xFD7E, 6277, 3, 1}, {0xFD7F, 6280, 3, 1}, {0xFD80, 6283, 3, 1},
+    {0xFD81, 6286, 3, 1}, {0xFD82, 6289, 3, 1}, {0xFD83, 6292, 3, 1}, {0xFD84, 6295, 3, 1},
+    {0xFD85, 6298, 3, 1}, {0xFD86, 6301, 3, 1}, {0xFD87, 6304, 3, 1}, {0xFD88, 6307, 3, 1},
+    {0xFD89, 6310, 3, 1}, {0xFD8A, 6313, 3, 1}, {0xFD8B, 6316, 3, 1}, {0xFD8C, 6319, 3, 1},
+    {0xFD8D, 6322, 3, 1}, {0xFD8E, 6325, 3, 1}, {0xFD8F, 6328, 3, 1}, {0xFD92, 6331, 3, 1},
+    {0xFD93, 6334, 3, 1}, {0xFD94, 6337, 3, 1}, {0xFD95, 6340, 3, 1}, {0xFD96, 6343, 3, 1},
+    {0xFD97, 6346, 3, 1}, {0xFD98, 6349, 3, 1}, {0xFD99, 6352, 3, 1}, {0xFD9A, 6355, 3, 1},
+    {0xFD9B, 6358, 3, 1}, {0xFD9C, 6361, 3, 1}, {0xFD9D, 6364, 3, 1}, {0xFD9E, 6367, 3, 1},
+    {0xFD9F, 6370, 3, 1}, {0xFDA0, 6373, 3, 1}, {0xFDA1, 6376, 3, 1}, {0xFDA2, 6379, 3, 1},
+    {0xFDA3, 6382, 3, 1}, {0xFDA4, 6385, 3, 1}, {0xFDA5, 6388, 3, 1}, {0xFDA6, 6391, 3, 1},
+    {0xFDA7, 6394, 3, 1}, {0xFDA8, 6397, 3, 1}, {0xFDA9, 6400, 3, 1}, {0xFDAA, 6403, 3, 1},
+    {0xFDAB, 6406, 3, 1}, {0xFDAC, 6409, 3, 1}, {0xFDAD, 6412, 3, 1}, {0xFDAE, 6415, 3, 1},
+    {0xFDAF, 6418, 3, 1}, {0xFDB0, 6421, 3, 1}, {0xFDB1, 6424, 3, 1}, {0xFDB2, 6427, 3, 1},
+    {0xFDB3, 6430, 3, 1}, {0xFDB4, 6433, 3, 1}, {0xFDB5, 6436, 3, 1}, {0xFDB6, 6439, 3, 1},
+    {0xFDB7, 6442, 3, 1}, {0xFDB8, 6445, 3, 1}, {0xFDB9, 6448, 3, 1}, {0xFDBA, 6451, 3, 1},
+    {0xFDBB, 6454, 3, 1}, {0xFDBC, 6457, 3, 1}, {0xFDBD, 6460, 3, 1}, {0xFDBE, 6463, 3, 1},
+    {0xFDBF, 6466, 3, 1}, {0xFDC0, 6469, 3, 1}, {0xFDC1, 6472, 3, 1}, {0xFDC2, 6475, 3, 1},
+    {0xFDC3, 6478, 3, 1}, {0xFDC4, 6481, 3, 1}, {0xFDC5, 6484, 3, 1}, {0xFDC6, 6487, 3, 1},
+    {0xFDC7, 6490, 3, 1}, {0xFDF0, 6493, 3, 1}, {0xFDF1, 6496, 3, 1}, {0xFDF2, 6499, 4, 1},
+    {0xFDF3, 6503, 4, 1}, {0xFDF4, 6507, 4, 1}, {0xFDF5, 6511, 4, 1}, {0xFDF6, 6515, 4, 1},
+    {0xFDF7, 6519, 4, 1}, {0xFDF8, 6523, 4, 1}, {0xFDF9, 6527, 3, 1}, {0xFDFA, 6530, 18, 1},
+    {0xFDFB, 6548, 8, 1}, {0xFDFC, 6556, 4, 1}, {0xFE10, 6560, 1, 1}, {0xFE11, 6561, 1, 1},
+    {0xFE12, 6562, 1, 1}, {0xFE13, 6563, 1, 1}, {0xFE14, 6564, 1, 1}, {0xFE15, 6565, 1, 1},
+    {0xFE16, 6566, 1, 1}, {0xFE17, 6567, 1, 1}, {0xFE18, 6568, 1, 1}, {0xFE19, 6569, 3, 1},
+    {0xFE30, 6572, 2, 1}, {0xFE31, 6574, 1, 1}, {0xFE32, 6575, 1, 1}, {0xFE33, 6576, 1, 1},
+    {0xFE34, 6577, 1, 1}, {0xFE35, 6578, 1, 1}, {0xFE36, 6579, 1, 1}, {0xFE37, 6580, 1, 1},
+    {0xFE38, 6581, 1, 1}, {0xFE39, 6582, 1, 1}, {0xFE3A, 6583, 1, 1}, {0xFE3B, 6584, 1, 1},
+    {0xFE3C, 6585, 1, 1}, {0xFE3D, 6586, 1, 1}, {0xFE3E, 6587, 1, 1}, {0xFE3F, 6588, 1, 1},
+    {0xFE40, 6589, 1, 1}, {0xFE41, 6590, 1, 1}, {0xFE42, 6591, 1, 1}, {0xFE43, 6592, 1, 1},
+    {0xFE44, 6593, 1, 1}, {0xFE47, 6594, 1, 1}, {0xFE48, 6595, 1, 1}, {0xFE49, 6596, 2, 1},
+    {0xFE4A, 6598, 2, 1}, {0xFE4B, 6600, 2, 1}, {0xFE4C, 6602, 2, 1}, {0xFE4D, 6604, 1, 1},
+    {0xFE4E, 6605, 1, 1}, {0xFE4F, 6606, 1, 1}, {0xFE50, 6607, 1, 1}, {0xFE51, 6608, 1, 1},
+    {0xFE52, 6609, 1, 1}, {0xFE54, 6610, 1, 1}, {0xFE55, 6611, 1, 1}, {0xFE56, 6612, 1, 1},
+    {0xFE57, 6613, 1, 1}, {0xFE58, 6614, 1, 1}, {0xFE59, 6615, 1, 1}, {0xFE5A, 6616, 1, 1},
+    {0xFE5B, 6617, 1, 1}, {0xFE5C, 6618, 1, 1}, {0xFE5D, 6619, 1, 1}, {0xFE5E, 6620, 1, 1},
+    {0xFE5F, 6621, 1, 1}, {0xFE60, 6622, 1, 1}, {0xFE61, 6623, 1, 1}, {0xFE62, 6624, 1, 1},
+    {0xFE63, 6625, 1, 1}, {0xFE64, 6626, 1, 1}, {0xFE65, 6627, 1, 1}, {0xFE66, 6628, 1, 1},
+    {0xFE68, 6629, 1, 1}, {0xFE69, 6630, 1, 1}, {0xFE6A, 6631, 1, 1}, {0xFE6B, 6632, 1, 1},
+    {0xFE70, 6633, 2, 1}, {0xFE71, 6635, 2, 1}, {0xFE72, 6637, 2, 1}, {0xFE74, 6639, 2, 1},
+    {0xFE76, 6641, 2, 1}, {0xFE77, 6643, 2, 1}, {0xFE78, 6645, 2, 1}, {0xFE79, 6647, 2, 1},
+    {0xFE7A, 6649, 2, 1}, {0xFE7B, 6651, 2, 1}, {0xFE7C, 6653, 2, 1}, {0xFE7D, 6655, 2, 1},
+    {0xFE7E, 6657, 2, 1}, {0xFE7F, 6659, 2, 1}, {0xFE80, 6661, 1, 1}, {0xFE81, 6662, 2, 1},
+    {0xFE82, 6664, 2, 1}, {0xFE83, 6666, 2, 1}, {0xFE84, 6668, 2, 1}, {0xFE85, 6670, 2, 1},
+    {0xFE86, 6672, 2, 1}, {0xFE87, 6674, 2, 1}, {0xFE88, 6676, 2, 1}, {0xFE89, 6678, 2, 1},
+    {0xFE8A, 6680, 2, 1}, {0xFE8B, 6682, 2, 1}, {0xFE8C, 6684, 2, 1}, {0xFE8D, 6686, 1, 1},
+    {0xFE8E, 6687, 1, 1}, {0xFE8F, 6688, 1, 1}, {0xFE90, 6689, 1, 1}, {0xFE91, 6690, 1, 1},
+    {0xFE92, 6691, 1, 1}, {0xFE93, 6692, 1, 1}, {0xFE94, 6693, 1, 1}, {0xFE95, 6694, 1, 1},
+    {0xFE96, 6695, 1, 1}, {0xFE97, 6696, 1, 1}, {0xFE98, 6697, 1, 1}, {0xFE99, 6698, 1, 1},
+    {0xFE9A, 6699, 1, 1}, {0xFE9B, 6700, 1, 1}, {0xFE9C, 6701, 1, 1}, {0xFE9D, 6702, 1, 1},
+    {0xFE9E, 6703, 1, 1}, {0xFE9F, 6704, 1, 1}, {0xFEA0, 6705, 1, 1}, {0xFEA1, 6706, 1, 1},
+    {0xFEA2, 6707, 1, 1}, {0xFEA3, 6708, 1, 1}, {0xFEA4, 6709, 1, 1}, {0xFEA5, 6710, 1, 1},
+    {0xFEA6, 6711, 1, 1}, {0xFEA7, 6712, 1, 1}, {0xFEA8, 6713, 1, 1}, {0xFEA9, 6714, 1, 1},
+    {0xFEAA, 6715, 1, 1}, {0xFEAB, 6716, 1, 1}, {0xFEAC, 6717, 1, 1}, {0xFEAD, 6718, 1, 1},
+    {0xFEAE, 6719, 1, 1}, {0xFEAF, 6720, 1, 1}, {0xFEB0, 6721, 1, 1}, {0xFEB1, 6722, 1, 1},
+    {0xFEB2, 6723, 1, 1}, {0xFEB3, 6724, 1, 1}, {0xFEB4, 6725, 1, 1}, {0xFEB5, 6726, 1, 1},
+    {0xFEB6, 6727, 1, 1}, {0xFEB7, 6728, 1, 1}, {0xFEB8, 6729, 1, 1}, {0xFEB9, 6730, 1, 1},
+    {0xFEBA, 6731, 1, 1}, {0xFEBB, 6732, 1, 1}, {0xFEBC, 6733, 1, 1}, {0xFEBD, 6734, 1, 1},
+    {0xFEBE, 6735, 1, 1}, {0xFEBF, 6736, 1, 1}, {0xFEC0, 6737, 1, 1}, {0xFEC1, 6738, 1, 1},
+    {0xFEC2, 6739, 1, 1}, {0xFEC3, 6740, 1, 1}, {0xFEC4, 6741, 1, 1}, {0xFEC5, 6742, 1, 1},
+    {0xFEC6, 6743, 1, 1}, {0xFEC7, 6744, 1, 1}, {0xFEC8, 6745, 1, 1}, {0xFEC9, 6746, 1, 1},
+    {0xFECA, 6747, 1, 1}, {0xFECB, 6748, 1, 1}, {0xFECC, 6749, 1, 1}, {0xFECD, 6750, 1, 1},
+    {0xFECE, 6751, 1, 1}, {0xFECF, 6752, 1, 1}, {0xFED0, 6753, 1, 1}, {0xFED1, 6754, 1, 1},
+    {0xFED2, 6755, 1, 1}, {0xFED3, 6756, 1, 1}, {0xFED4, 6757, 1, 1}, {0xFED5, 6758, 1, 1},
+    {0xFED6, 6759, 1, 1}, {0xFED7, 6760, 1, 1}, {0xFED8, 6761, 1, 1}, {0xFED9, 6762, 1, 1},
+    {0xFEDA, 6763, 1, 1}, {0xFEDB, 6764, 1, 1}, {0xFEDC, 6765, 1, 1}, {0xFEDD, 6766, 1, 1},
+    {0xFEDE, 6767, 1, 1}, {0xFEDF, 6768, 1, 1}, {0xFEE0, 6769, 1, 1}, {0xFEE1, 6770, 1, 1},
+    {0xFEE2, 6771, 1, 1}, {0xFEE3, 6772, 1, 1}, {0xFEE4, 6773, 1, 1}, {0xFEE5, 6774, 1, 1},
+    {0xFEE6, 6775, 1, 1}, {0xFEE7, 6776, 1, 1}, {0xFEE8, 6777, 1, 1}, {0xFEE9, 6778, 1, 1},
+    {0xFEEA, 6779, 1, 1}, {0xFEEB, 6780, 1, 1}, {0xFEEC, 6781, 1, 1}, {0xFEED, 6782, 1, 1},
+    {0xFEEE, 6783, 1, 1}, {0xFEEF, 6784, 1, 1}, {0xFEF0, 6785, 1, 1}, {0xFEF1, 6786, 1, 1},
+    {0xFEF2, 6787, 1, 1}, {0xFEF3, 6788, 1, 1}, {0xFEF4, 6789, 1, 1}, {0xFEF5, 6790, 3, 1},
+    {0xFEF6, 6793, 3, 1}, {0xFEF7, 6796, 3, 1}, {0xFEF8, 6799, 3, 1}, {0xFEF9, 6802, 3, 1},
+    {0xFEFA, 6805, 3, 1}, {0xFEFB, 6808, 2, 1}, {0xFEFC, 6810, 2, 1}, {0xFF01, 6812, 1, 1},
+    {0xFF02, 6813, 1, 1}, {0xFF03, 6814, 1, 1}, {0xFF04, 6815, 1, 1}, {0xFF05, 6816, 1, 1},
+    {0xFF06, 6817, 1, 1}, {0xFF07, 6818, 1, 1}, {0xFF08, 6819, 1, 1}, {0xFF09, 6820, 1, 1},
+    {0xFF0A, 6821, 1, 1}, {0xFF0B, 6822, 1, 1}, {0xFF0C, 6823, 1, 1}, {0xFF0D, 6824, 1, 1},
+    {0xFF0E, 6825, 1, 1}, {0xFF0F, 6826, 1, 1}, {0xFF10, 6827, 1, 1}, {0xFF11, 6828, 1, 1},
+    {0xFF12, 6829, 1, 1}, {0xFF13, 6830, 1, 1}, {0xFF14, 6831, 1, 1}, {0xFF15, 6832, 1, 1},
+    {0xFF16, 6833, 1, 1}, {0xFF17, 6834, 1, 1}, {0xFF18, 6835, 1, 1}, {0xFF19, 6836, 1, 1},
+    {0xFF1A, 6837, 1, 1}, {0xFF1B, 6838, 1, 1}, {0xFF1C, 6839, 1, 1}, {0xFF1D, 6840, 1, 1},
+    {0xFF1E, 6841, 1, 1}, {0xFF1F, 6842, 1, 1}, {0xFF20, 6843, 1, 1}, {0xFF21, 6844, 1, 1},
+    {0xFF22, 6845, 1, 1}, {0xFF23, 6846, 1, 1}, {0xFF24, 6847, 1, 1}, {0xFF25, 6848, 1, 1},
+    {0xFF26, 6849, 1, 1}, {0xFF27, 6850, 1, 1}, {0xFF28, 6851, 1, 1}, {0xFF29, 6852, 1, 1},
+    {0xFF2A, 6853, 1, 1}, {0xFF2B, 6854, 1, 1}, {0xFF2C, 6855, 1, 1}, {0xFF2D, 6856, 1, 1},
+    {0xFF2E, 6857, 1, 1}, {0xFF2F, 6858, 1, 1}, {0xFF30, 6859, 1, 1}, {0xFF31, 6860, 1, 1},
+    {0xFF32, 6861, 1, 1}, {0xFF33, 6862, 1, 1}, {0xFF34, 6863, 1, 1}, {0xFF35, 6864, 1, 1},
+    {0xFF36, 6865, 1, 1}, {0xFF37, 6866, 1, 1}, {0xFF38, 6867, 1, 1}, {0xFF39, 6868, 1, 1},
+    {0xFF3A, 6869, 1, 1}, {0xFF3B, 6870, 1, 1}, {0xFF3C, 6871, 1, 1}, {0xFF3D, 6872, 1, 1},
+    {0xFF3E, 6873, 1, 1}, {0xFF3F, 6874, 1, 1}, {0xFF40, 6875, 1, 1}, {0xFF41, 6876, 1, 1},
+    {0xFF42, 6877, 1, 1}, {0xFF43, 6878, 1, 1}, {0xFF44, 6879, 1, 1}, {0xFF45, 6880, 1, 1},
+    {0xFF46, 6881, 1, 1}, {0xFF47, 6882, 1, 1}, {0xFF48, 6883, 1, 1}, {0xFF49, 6884, 1, 1},
+    {0xFF4A, 6885, 1, 1}, {0xFF4B, 6886, 1, 1}, {0xFF4C, 6887, 1, 1}, {0xFF4D, 6888, 1, 1},
+    {0xFF4E, 6889, 1, 1}, {0xFF4F, 6890, 1, 1}, {0xFF50, 6891, 1, 1}, {0xFF51, 6892, 1, 1},
+    {0xFF52, 6893, 1, 1}, {0xFF53, 6894, 1, 1}, {0xFF54, 6895, 1, 1}, {0xFF55, 6896, 1, 1},
+    {0xFF56, 6897, 1, 1}, {0xFF57, 6898, 1, 1}, {0xFF58, 6899, 1, 1}, {0xFF59, 6900, 1, 1},
+    {0xFF5A, 6901, 1, 1}, {0xFF5B, 6902, 1, 1}, {0xFF5C, 6903, 1, 1}, {0xFF5D, 6904, 1, 1},
+    {0xFF5E, 6905, 1, 1}, {0xFF5F, 6906, 1, 1}, {0xFF60, 6907, 1, 1}, {0xFF61, 6908, 1, 1},
+    {0xFF62, 6909, 1, 1}, {0xFF63, 6910, 1, 1}, {0xFF64, 6911, 1, 1}, {0xFF65, 6912, 1, 1},
+    {0xFF66, 6913, 1, 1}, {0xFF67, 6914, 1, 1}, {0xFF68, 6915, 1, 1}, {0xFF69, 6916, 1, 1},
+    {0xFF6A, 6917, 1, 1}, {0xFF6B, 6918, 1, 1}, {0xFF6C, 6919, 1, 1}, {0xFF6D, 6920, 1, 1},
+    {0xFF6E, 6921, 1, 1}, {0xFF6F, 6922, 1, 1}, {0xFF70, 6923, 1, 1}, {0xFF71, 6924, 1, 1},
+    {0xFF72, 6925, 1, 1}, {0xFF73, 6926, 1, 1}, {0xFF74, 6927, 1, 1}, {0xFF75, 6928, 1, 1},
+    {0xFF76, 6929, 1, 1}, {0xFF77, 6930, 1, 1}, {0xFF78, 6931, 1, 1}, {0xFF79, 6932, 1, 1},
+    {0xFF7A, 6933, 1, 1}, {0xFF7B, 6934, 1, 1}, {0xFF7C, 6935, 1, 1}, {0xFF7D, 6936, 1, 1},
+    {0xFF7E, 6937, 1, 1}, {0xFF7F, 6938, 1, 1}, {0xFF80, 6939, 1, 1}, {0xFF81, 6940, 1, 1},
+    {0xFF82, 6941, 1, 1}, {0xFF83, 6942, 1, 1}, {0xFF84, 6943, 1, 1}, {0xFF85, 6944, 1, 1},
+    {0xFF86, 6945, 1, 1}, {0xFF87, 6946, 1, 1}, {0xFF88, 6947, 1, 1}, {0xFF89, 6948, 1, 1},
+    {0xFF8A, 6949, 1, 1}, {0xFF8B, 6950, 1, 1}, {0xFF8C, 6951, 1, 1}, {0xFF8D, 6952, 1, 1},
+    {0xFF8E, 6953, 1, 1}, {0xFF8F, 6954, 1, 1}, {0xFF90, 6955, 1, 1}, {0xFF91, 6956, 1, 1},
+    {0xFF92, 6957, 1, 1}, {0xFF93, 6958, 1, 1}, {0xFF94, 6959, 1, 1}, {0xFF95, 6960, 1, 1},
+    {0xFF96, 6961, 1, 1}, {0xFF97, 6962, 1, 1}, {0xFF98, 6963, 1, 1}, {0xFF99, 6964, 1, 1},
+    {0xFF9A, 6965, 1, 1}, {0xFF9B, 6966, 1, 1}, {0xFF9C, 6967, 1, 1}, {0xFF9D, 6968, 1, 1},
+    {0xFF9E, 6969, 1, 1}, {0xFF9F, 6970, 1, 1}, {0xFFA0, 6971, 1, 1}, {0xFFA1, 6972, 1, 1},
+    {0xFFA2, 6973, 1, 1}, {0xFFA3, 6974, 1, 1}, {0xFFA4, 6975, 1, 1}, {0xFFA5, 6976, 1, 1},
+    {0xFFA6, 6977, 1, 1}, {0xFFA7, 6978, 1, 1}, {0xFFA8, 6979, 1, 1}, {0xFFA9, 6980, 1, 1},
+    {0xFFAA, 6981, 1, 1}, {0xFFAB, 6982, 1, 1}, {0xFFAC, 6983, 1, 1}, {0xFFAD, 6984, 1, 1},
+    {0xFFAE, 6985, 1, 1}, {0xFFAF, 6986, 1, 1}, {0xFFB0, 6987, 1, 1}, {0xFFB1, 6988, 1, 1},
+    {0xFFB2, 6989, 1, 1}, {0xFFB3, 6990, 1, 1}, {0xFFB4, 6991, 1, 1}, {0xFFB5, 6992, 1, 1},
+    {0xFFB6, 6993, 1, 1}, {0xFFB7, 6994, 1, 1}, {0xFFB8, 6995, 1, 1}, {0xFFB9, 6996, 1, 1},
+    {0xFFBA, 6997, 1, 1}, {0xFFBB, 6998, 1, 1}, {0xFFBC, 6999, 1, 1}, {0xFFBD, 7000, 1, 1},
+    {0xFFBE, 7001, 1, 1}, {0xFFC2, 7002, 1, 1}, {0xFFC3, 7003, 1, 1}, {0xFFC4, 7004, 1, 1},
+    {0xFFC5, 7005, 1, 1}, {0xFFC6, 7006, 1, 1}, {0xFFC7, 7007, 1, 1}, {0xFFCA, 7008, 1, 1},
+    {0xFFCB, 7009, 1, 1}, {0xFFCC, 7010, 1, 1}, {0xFFCD, 7011, 1, 1}, {0xFFCE, 7012, 1, 1},
+    {0xFFCF, 7013, 1, 1}, {0xFFD2, 7014, 1, 1}, {0xFFD3, 7015, 1, 1}, {0xFFD4, 7016, 1, 1},
+    {0xFFD5, 7017, 1, 1}, {0xFFD6, 7018, 1, 1}, {0xFFD7, 7019, 1, 1}, {0xFFDA, 7020, 1, 1},
+    {0xFFDB, 7021, 1, 1}, {0xFFDC, 7022, 1, 1}, {0xFFE0, 7023, 1, 1}, {0xFFE1, 7024, 1, 1},
+    {0xFFE2, 7025, 1, 1}, {0xFFE3, 7026, 2, 1}, {0xFFE4, 7028, 1, 1}, {0xFFE5, 7029, 1, 1},
+    {0xFFE6, 7030, 1, 1}, {0xFFE8, 7031, 1, 1}, {0xFFE9, 7032, 1, 1}, {0xFFEA, 7033, 1, 1},
+    {0xFFEB, 7034, 1, 1}, {0xFFEC, 7035, 1, 1}, {0xFFED, 7036, 1, 1}, {0xFFEE, 7037, 1, 1},
+    {0x10781, 7038, 1, 1}, {0x10782, 7039, 1, 1}, {0x10783, 7040, 1, 1}, {0x10784, 7041, 1, 1},
+    {0x10785, 7042, 1, 1}, {0x10787, 7043, 1, 1}, {0x10788, 7044, 1, 1}, {0x10789, 7045, 1, 1},
+    {0x1078A, 7046, 1, 1}, {0x1078B, 7047, 1, 1}, {0x1078C, 7048, 1, 1}, {0x1078D, 7049, 1, 1},
+    {0x1078E, 7050, 1, 1}, {0x1078F, 7051, 1, 1}, {0x10790, 7052, 1, 1}, {0x10791, 7053, 1, 1},
+    {0x10792, 7054, 1, 1}, {0x10793, 7055, 1, 1}, {0x10794, 7056, 1, 1}, {0x10795, 7057, 1, 1},
+    {0x10796, 7058, 1, 1}, {0x10797, 7059, 1, 1}, {0x10798, 7060, 1, 1}, {0x10799, 7061, 1, 1},
+    {0x1079A, 7062, 1, 1}, {0x1079B, 7063, 1, 1}, {0x1079C, 7064, 1, 1}, {0x1079D, 7065, 1, 1},
+    {0x1079E, 7066, 1, 1}, {0x1079F, 7067, 1, 1}, {0x107A0, 7068, 1, 1}, {0x107A1, 7069, 1, 1},
+    {0x107A2, 7070, 1, 1}, {0x107A3, 7071, 1, 1}, {0x107A4, 7072, 1, 1}, {0x107A5, 7073, 1, 1},
+    {0x107A6, 7074, 1, 1}, {0x107A7, 7075, 1, 1}, {0x107A8, 7076, 1, 1}, {0x107A9, 7077, 1, 1},
+    {0x107AA, 7078, 1, 1}, {0x107AB, 7079, 1, 1}, {0x107AC, 7080, 1, 1}, {0x107AD, 7081, 1, 1},
+    {0x107AE, 7082, 1, 1}, {0x107AF, 7083, 1, 1}, {0x107B0, 7084, 1, 1}, {0x107B2, 7085, 1, 1},
+    {0x107B3, 7086, 1, 1}, {0x107B4, 7087, 1, 1}, {0x107B5, 7088, 1, 1}, {0x107B6, 7089, 1, 1},
+    {0x107B7, 7090, 1, 1}, {0x107B8, 7091, 1, 1}, {0x107B9, 7092, 1, 1}, {0x107BA, 7093, 1, 1},
+    {0x1109A, 7094, 2, 0}, {0x1109C, 7096, 2, 0}, {0x110AB, 7098, 2, 0}, {0x1112E, 7100, 2, 0},
+    {0x1112F, 7102, 2, 0}, {0x1134B, 7104, 2, 0}, {0x1134C, 7106, 2, 0}, {0x114BB, 7108, 2, 0},
+    {0x114BC, 7110, 2, 0}, {0x114BE, 7112, 2, 0}, {0x115BA, 7114, 2, 0}, {0x115BB, 7116, 2, 0},
+    {0x11938, 7118, 2, 0}, {0x1D15E, 7120, 2, 0}, {0x1D15F, 7122, 2, 0}, {0x1D160, 7124, 3, 0},
+    {0x1D161, 7127, 3, 0}, {0x1D162, 7130, 3, 0}, {0x1D163, 7133, 3, 0}, {0x1D164, 7136, 3, 0},
+    {0x1D1BB, 7139, 2, 0}, {0x1D1BC, 7141, 2, 0}, {0x1D1BD, 7143, 3, 0}, {0x1D1BE, 7146, 3, 0},
+    {0x1D1BF, 7149, 3, 0}, {0x1D1C0, 7152, 3, 0}, {0x1D400, 7155, 1, 1}, {0x1D401, 7156, 1, 1},
+    {0x1D402, 7157, 1, 1}, {0x1D403, 7158, 1, 1}, {0x1D404, 7159, 1, 1}, {0x1D405, 7160, 1, 1},
+    {0x1D406, 7161, 1, 1}, {0x1D407, 7162, 1, 1}, {0x1D408, 7163, 1, 1}, {0x1D409, 7164, 1, 1},
+    {0x1D40A, 7165, 1, 1}, {0x1D40B, 7166, 1, 1}, {0x1D40C, 7167, 1, 1}, {0x1D40D, 7168, 1, 1},
+    {0x1D40E, 7169, 1, 1}, {0x1D40F, 7170, 1, 1}, {0x1D410, 7171, 1, 1}, {0x1D411, 7172, 1, 1},
+    {0x1D412, 7173, 1, 1}, {0x1D413, 7174, 1, 1}, {0x1D414, 7175, 1, 1}, {0x1D415, 7176, 1, 1},
+    {0x1D416, 7177, 1, 1}, {0x1D417, 7178, 1, 1}, {0x1D418, 7179, 1, 1}, {0x1D419, 7180, 1, 1},
+    {0x1D41A, 7181, 1, 1}, {0x1D41B, 7182, 1, 1}, {0x1D41C, 7183, 1, 1}, {0x1D41D, 7184, 1, 1},
+    {0x1D41E, 7185, 1, 1}, {0x1D41F, 7186, 1, 1}, {0x1D420, 7187, 1, 1}, {0x1D421, 7188, 1, 1},
+    {0x1D422, 7189, 1, 1}, {0x1D423, 7190, 1, 1}, {0x1D424, 7191, 1, 1}, {0x1D425, 7192, 1, 1},
+    {0x1D426, 7193, 1, 1}, {0x1D427, 7194, 1, 1}, {0x1D428, 7195, 1, 1}, {0x1D429, 7196, 1, 1},
+    {0x1D42A, 7197, 1, 1}, {0x1D42B, 7198, 1, 1}, {0x1D42C, 7199, 1, 1}, {0x1D42D, 7200, 1, 1},
+    {0x1D42E, 7201, 1, 1}, {0x1D42F, 7202, 1, 1}, {0x1D430, 7203, 1, 1}, {0x1D431, 7204, 1, 1},
+    {0x1D432, 7205, 1, 1}, {0x1D433, 7206, 1, 1}, {0x1D434, 7207, 1, 1}, {0x1D435, 7208, 1, 1},
+    {0x1D436, 7209, 1, 1}, {0x1D437, 7210, 1, 1}, {0x1D438, 7211, 1, 1}, {0x1D439, 7212, 1, 1},
+    {0x1D43A, 7213, 1, 1}, {0x1D43B, 7214, 1, 1}, {0x1D43C, 7215, 1, 1}, {0x1D43D, 7216, 1, 1},
+    {0x1D43E, 7217, 1, 1}, {0x1D43F, 7218, 1, 1}, {0x1D440, 7219, 1, 1}, {0x1D441, 7220, 1, 1},
+    {0x1D442, 7221, 1, 1}, {0x1D443, 7222, 1, 1}, {0x1D444, 7223, 1, 1}, {0x1D445, 7224, 1, 1},
+    {0x1D446, 7225, 1, 1}, {0x1D447, 7226, 1, 1}, {0x1D448, 7227, 1, 1}, {0x1D449, 7228, 1, 1},
+    {0x1D44A, 7229, 1, 1}, {0x1D44B, 7230, 1, 1}, {0x1D44C, 7231, 1, 1}, {0x1D44D, 7232, 1, 1},
+    {0x1D44E, 7233, 1, 1}, {0x1D44F, 7234, 1, 1}, {0x1D450, 7235, 1, 1}, {0x1D451, 7236, 1, 1},
+    {0x1D452, 7237, 1, 1}, {0x1D453, 7238, 1, 1}, {0x1D454, 7239, 1, 1}, {0x1D456, 7240, 1, 1},
+    {0x1D457, 7241, 1, 1}, {0x1D458, 7242, 1, 1}, {0x1D459, 7243, 1, 1}, {0x1D45A, 7244, 1, 1},
+    {0x1D45B, 7245, 1, 1}, {0x1D45C, 7246, 1, 1}, {0x1D45D, 7247, 1, 1}, {0x1D45E, 7248, 1, 1},
+    {0x1D45F, 7249, 1, 1}, {0x1D460, 7250, 1, 1}, {0x1D461, 7251, 1, 1}, {0x1D462, 7252, 1, 1},
+    {0x1D463, 7253, 1, 1}, {0x1D464, 7254, 1, 1}, {0x1D465, 7255, 1, 1}, {0x1D466, 7256, 1, 1},
+    {0x1D467, 7257, 1, 1}, {0x1D468, 7258, 1, 1}, {0x1D469, 7259, 1, 1}, {0x1D46A, 7260, 1, 1},
+    {0x1D46B, 7261, 1, 1}, {0x1D46C, 7262, 1, 1}, {0x1D46D, 7263, 1, 1}, {0x1D46E, 7264, 1, 1},
+    {0x1D46F, 7265, 1, 1}, {0x1D470, 7266, 1, 1}, {0x1D471, 7267, 1, 1}, {0x1D472, 7268, 1, 1},
+    {0x1D473, 7269, 1, 1}, {0x1D474, 7270, 1, 1}, {0x1D475, 7271, 1, 1}, {0x1D476, 7272, 1, 1},
+    {0x1D477, 7273, 1, 1}, {0x1D478, 7274, 1, 1}, {0x1D479, 7275, 1, 1}, {0x1D47A, 7276, 1, 1},
+    {0x1D47B, 7277, 1, 1}, {0x1D47C, 7278, 1, 1}, {0x1D47D, 7279, 1, 1}, {0x1D47E, 7280, 1, 1},
+    {0x1D47F, 7281, 1, 1}, {0x1D480, 7282, 1, 1}, {0x1D481, 7283, 1, 1}, {0x1D482, 7284, 1, 1},
+    {0x1D483, 7285, 1, 1}, {0x1D484, 7286, 1, 1}, {0x1D485, 7287, 1, 1}, {0x1D486, 7288, 1, 1},
+    {0x1D487, 7289, 1, 1}, {0x1D488, 7290, 1, 1}, {0x1D489, 7291, 1, 1}, {0x1D48A, 7292, 1, 1},
+    {0x1D48B, 7293, 1, 1}, {0x1D48C, 7294, 1, 1}, {0x1D48D, 7295, 1, 1}, {0x1D48E, 7296, 1, 1},
+    {0x1D48F, 7297, 1, 1}, {0x1D490, 7298, 1, 1}, {0x1D491, 7299, 1, 1}, {0x1D492, 7300, 1, 1},
+    {0x1D493, 7301, 1, 1}, {0x1D494, 7302, 1, 1}, {0x1D495, 7303, 1, 1}, {0x1D496, 7304, 1, 1},
+    {0x1D497, 7305, 1, 1}, {0x1D498, 7306, 1, 1}, {0x1D499, 7307, 1, 1}, {0x1D49A, 7308, 1, 1},
+    {0x1D49B, 7309, 1, 1}, {0x1D49C, 7310, 1, 1}, {0x1D49E, 7311, 1, 1}, {0x1D49F, 7312, 1, 1},
+    {0x1D4A2, 7313, 1, 1}, {0x1D4A5, 7314, 1, 1}, {0x1D4A6, 7315, 1, 1}, {0x1D4A9, 7316, 1, 1},
+    {0x1D4AA, 7317, 1, 1}, {0x1D4AB, 7318, 1, 1}, {0x1D4AC, 7319, 1, 1}, {0x1D4AE, 7320, 1, 1},
+    {0x1D4AF, 7321, 1, 1}, {0x1D4B0, 7322, 1, 1}, {0x1D4B1, 7323, 1, 1}, {0x1D4B2, 7324, 1, 1},
+    {0x1D4B3, 7325, 1, 1}, {0x1D4B4, 7326, 1, 1}, {0x1D4B5, 7327, 1, 1}, {0x1D4B6, 7328, 1, 1},
+    {0x1D4B7, 7329, 1, 1}, {0x1D4B8, 7330, 1, 1}, {0x1D4B9, 7331, 1, 1}, {0x1D4BB, 7332, 1, 1},
+    {0x1D4BD, 7333, 1, 1}, {0x1D4BE, 7334, 1, 1}, {0x1D4BF, 7335, 1, 1}, {0x1D4C0, 7336, 1, 1},
+    {0x1D4C1, 7337, 1, 1}, {0x1D4C2, 7338, 1, 1}, {0x1D4C3, 7339, 1, 1}, {0x1D4C5, 7340, 1, 1},
+    {0x1D4C6, 7341, 1, 1}, {0x1D4C7, 7342, 1, 1}, {0x1D4C8, 7343, 1, 1}, {0x1D4C9, 7344, 1, 1},
+    {0x1D4CA, 7345, 1, 1}, {0x1D4CB, 7346, 1, 1}, {0x1D4CC, 7347, 1, 1}, {0x1D4CD, 7348, 1, 1},
+    {0x1D4CE, 7349, 1, 1}, {0x1D4CF, 7350, 1, 1}, {0x1D4D0, 7351, 1, 1}, {0x1D4D1, 7352, 1, 1},
+    {0x1D4D2, 7353, 1, 1}, {0x1D4D3, 7354, 1, 1}, {0x1D4D4, 7355, 1, 1}, {0x1D4D5, 7356, 1, 1},
+    {0x1D4D6, 7357, 1, 1}, {0x1D4D7, 7358, 1, 1}, {0x1D4D8, 7359, 1, 1}, {0x1D4D9, 7360, 1, 1},
+    {0x1D4DA, 7361, 1, 1}, {0x1D4DB, 7362, 1, 1}, {0x1D4DC, 7363, 1, 1}, {0x1D4DD, 7364, 1, 1},
+    {0x1D4DE, 7365, 1, 1}, {0x1D4DF, 7366, 1, 1}, {0x1D4E0, 7367, 1, 1}, {0x1D4E1, 7368, 1, 1},
+    {0x1D4E2, 7369, 1, 1}, {0x1D4E3, 7370, 1, 1}, {0x1D4E4, 7371, 1, 1}, {0x1D4E5, 7372, 1, 1},
+    {0x1D4E6, 7373, 1, 1}, {0x1D4E7, 7374, 1, 1}, {0x1D4E8, 7375, 1, 1}, {0x1D4E9, 7376, 1, 1},
+    {0x1D4EA, 7377, 1, 1}, {0x1D4EB, 7378, 1, 1}, {0x1D4EC, 7379, 1, 1}, {0x1D4ED, 7380, 1, 1},
+    {0x1D4EE, 7381, 1, 1}, {0x1D4EF, 7382, 1, 1}, {0x1D4F0, 7383, 1, 1}, {0x1D4F1, 7384, 1, 1},
+    {0x1D4F2, 7385, 1, 1}, {0x1D4F3, 7386, 1, 1}, {0x1D4F4, 7387, 1, 1}, {0x1D4F5, 7388, 1, 1},
+    {0x1D4F6, 7389, 1, 1}, {0x1D4F7, 7390, 1, 1}, {0x1D4F8, 7391, 1, 1}, {0x1D4F9, 7392, 1, 1},
+    {0x1D4FA, 7393, 1, 1}, {0x1D4FB, 7394, 1, 1}, {0x1D4FC, 7395, 1, 1}, {0x1D4FD, 7396, 1, 1},
+    {0x1D4FE, 7397, 1, 1}, {0x1D4FF, 7398, 1, 1}, {0x1D500, 7399, 1, 1}, {0x1D501, 7400, 1, 1},
+    {0x1D502, 7401, 1, 1}, {0x1D503, 7402, 1, 1}, {0x1D504, 7403, 1, 1}, {0x1D505, 7404, 1, 1},
+    {0x1D507, 7405, 1, 1}, {0x1D508, 7406, 1, 1}, {0x1D509, 7407, 1, 1}, {0x1D50A, 7408, 1, 1},
+    {0x1D50D, 7409, 1, 1}, {0x1D50E, 7410, 1, 1}, {0x1D50F, 7411, 1, 1}, {0x1D510, 7412, 1, 1},
+    {0x1D511, 7413, 1, 1}, {0x1D512, 7414, 1, 1}, {0x1D513, 7415, 1, 1}, {0x1D514, 7416, 1, 1},
+    {0x1D516, 7417, 1, 1}, {0x1D517, 7418, 1, 1}, {0x1D518, 7419, 1, 1}, {0x1D519, 7420, 1, 1},
+    {0x1D51A, 7421, 1, 1}, {0x1D51B, 7422, 1, 1}, {0x1D51C, 7423, 1, 1}, {0x1D51E, 7424, 1, 1},
+    {0x1D51F, 7425, 1, 1}, {0x1D520, 7426, 1, 1}, {0x1D521, 7427, 1, 1}, {0x1D522, 7428, 1, 1},
+    {0x1D523, 7429, 1, 1}, {0x1D524, 7430, 1, 1}, {0x1D525, 7431, 1, 1}, {0x1D526, 7432, 1, 1},
+    {0x1D527, 7433, 1, 1}, {0x1D528, 7434, 1, 1}, {0x1D529, 7435, 1, 1}, {0x1D52A, 7436, 1, 1},
+    {0x1D52B, 7437, 1, 1}, {0x1D52C, 7438, 1, 1}, {0x1D52D, 7439, 1, 1}, {0x1D52E, 7440, 1, 1},
+    {0x1D52F, 7441, 1, 1}, {0x1D530, 7442, 1, 1}, {0x1D531, 7443, 1, 1}, {0x1D532, 7444, 1, 1},
+    {0x1D533, 7445, 1, 1}, {0x1D534, 7446, 1, 1}, {0x1D535, 7447, 1, 1}, {0x1D536, 7448, 1, 1},
+    {0x1D537, 7449, 1, 1}, {0x1D538, 7450, 1, 1}, {0x1D539, 7451, 1, 1}, {0x1D53B, 7452, 1, 1},
+    {0x1D53C, 7453, 1, 1}, {0x1D53D, 7454, 1, 1}, {0x1D53E, 7455, 1, 1}, {0x1D540, 7456, 1, 1},
+    {0x1D541, 7457, 1, 1}, {0x1D542, 7458, 1, 1}, {0x1D543, 7459, 1, 1}, {0x1D544, 7460, 1, 1},
+    {0x1D546, 7461, 1, 1}, {0x1D54A, 7462, 1, 1}, {0x1D54B, 7463, 1, 1}, {0x1D54C, 7464, 1, 1},
+    {0x1D54D, 7465, 1, 1}, {0x1D54E, 7466, 1, 1}, {0x1D54F, 7467, 1, 1}, {0x1D550, 7468, 1, 1},
+    {0x1D552, 7469, 1, 1}, {0x1D553, 7470, 1, 1}, {0x1D554, 7471, 1, 1}, {0x1D555, 7472, 1, 1},
+    {0x1D556, 7473, 1, 1}, {0x1D557, 7474, 1, 1}, {0x1D558, 7475, 1, 1}, {0x1D559, 7476, 1, 1},
+    {0x1D55A, 7477, 1, 1}, {0x1D55B, 7478, 1, 1}, {0x1D55C, 7479, 1, 1}, {0x1D55D, 7480, 1, 1},
+    {0x1D55E, 7481, 1, 1}, {0x1D55F, 7482, 1, 1}, {0x1D560, 7483, 1, 1}, {0x1D561, 7484, 1, 1},
+    {0x1D562, 7485, 1, 1}, {0x1D563, 7486, 1, 1}, {0x1D564, 7487, 1, 1}, {0x1D565, 7488, 1, 1},
+    {0x1D566, 7489, 1, 1}, {0x1D567, 7490, 1, 1}, {0x1D568, 7491, 1, 1}, {0x1D569, 7492, 1, 1},
+    {0x1D56A, 7493, 1, 1}, {0x1D56B, 7494, 1, 1}, {0x1D56C, 7495, 1, 1}, {0x1D56D, 7496, 1, 1},
+    {0x1D56E, 7497, 1, 1}, {0x1D56F, 7498, 1, 1}, {0x1D570, 7499, 1, 1}, {0x1D571, 7500, 1, 1},
+    {0x1D572, 7501, 1, 1}, {0x1D573, 7502, 1, 1}, {0x1D574, 7503, 1, 1}, {0x1D575, 7504, 1, 1},
+    {0x1D576, 7505, 1, 1}, {0x1D577, 7506, 1, 1}, {0x1D578, 7507, 1, 1}, {0x1D579, 7508, 1, 1},
+    {0x1D57A, 7509, 1, 1}, {0x1D57B, 7510, 1, 1}, {0x1D57C, 7511, 1, 1}, {0x1D57D, 7512, 1, 1},
+    {0x1D57E, 7513, 1, 1}, {0x1D57F, 7514, 1, 1}, {0x1D580, 7515, 1, 1}, {0x1D581, 7516, 1, 1},
+    {0x1D582, 7517, 1, 1}, {0x1D583, 7518, 1, 1}, {0x1D584, 7519, 1, 1}, {0x1D585, 7520, 1, 1},
+    {0x1D586, 7521, 1, 1}, {0x1D587, 7522, 1, 1}, {0x1D588, 7523, 1, 1}, {0x1D589, 7524, 1, 1},
+    {0x1D58A, 7525, 1, 1}, {0x1D58B, 7526, 1, 1}, {0x1D58C, 7527, 1, 1}, {0x1D58D, 7528, 1, 1},
+    {0x1D58E, 7529, 1, 1}, {0x1D58F, 7530, 1, 1}, {0x1D590, 7531, 1, 1}, {0x1D591, 7532, 1, 1},
+    {0x1D592, 7533, 1, 1}, {0x1D593, 7534, 1, 1}, {0x1D594, 7535, 1, 1}, {0x1D595, 7536, 1, 1},
+    {0x1D596, 7537, 1, 1}, {0x1D597, 7538, 1, 1}, {0x1D598, 7539, 1, 1}, {0x1D599, 7540, 1, 1},
+    {0x1D59A, 7541, 1, 1}, {0x1D59B, 7542, 1, 1}, {0x1D59C, 7543, 1, 1}, {0x1D59D, 7544, 1, 1},
+    {0x1D59E, 7545, 1, 1}, {0x1D59F, 7546, 1, 1}, {0x1D5A0, 7547, 1, 1}, {0x1D5A1, 7548, 1, 1},
+    {0x1D5A2, 7549, 1, 1}, {0x1D5A3, 7550, 1, 1}, {0x1D5A4, 7551, 1, 1}, {0x1D5A5, 7552, 1, 1},
+    {0x1D5A6, 7553, 1, 1}, {0x1D5A7, 7554, 1, 1}, {0x1D5A8, 7555, 1, 1}, {0x1D5A9, 7556, 1, 1},
+    {0x1D5AA, 7557, 1, 1}, {0x1D5AB, 7558, 1, 1}, {0x1D5AC, 7559, 1, 1}, {0x1D5AD, 7560, 1, 1},
+    {0x1D5AE, 7561, 1, 1}, {0x1D5AF, 7562, 1, 1}, {0x1D5B0, 7563, 1, 1}, {0x1D5B1, 7564, 1, 1},
+    {0x1D5B2, 7565, 1, 1}, {0x1D5B3, 7566, 1, 1}, {0x1D5B4, 7567, 1, 1}, {0x1D5B5, 7568, 1, 1},
+    {0x1D5B6, 7569, 1, 1}, {0x1D5B7, 7570, 1, 1}, {0x1D5B8, 7571, 1, 1}, {0x1D5B9, 7572, 1, 1},
+    {0x1D5BA, 7573, 1, 1}, {0x1D5BB, 7574, 1, 1}, {0x1D5BC, 7575, 1, 1}, {0x1D5BD, 7576, 1, 1},
+    {0x1D5BE, 7577, 1, 1}, {0x1D5BF, 7578, 1, 1}, {0x1D5C0, 7579, 1, 1}, {0x1D5C1, 7580, 1, 1},
+    {0x1D5C2, 7581, 1, 1}, {0x1D5C3, 7582, 1, 1}, {0x1D5C4, 7583, 1, 1}, {0x1D5C5, 7584, 1, 1},
+    {0x1D5C6, 7585, 1, 1}, {0x1D5C7, 7586, 1, 1}, {0x1D5C8, 7587, 1, 1}, {0x1D5C9, 7588, 1, 1},
+    {0x1D5CA, 7589, 1, 1}, {0x1D5CB, 7590, 1, 1}, {0x1D5CC, 7591, 1, 1}, {0x1D5CD, 7592, 1, 1},
+    {0x1D5CE, 7593, 1, 1}, {0x1D5CF, 7594, 1, 1}, {0x1D5D0, 7595, 1, 1}, {0x1D5D1, 7596, 1, 1},
+    {0x1D5D2, 7597, 1, 1}, {0x1D5D3, 7598, 1, 1}, {0x1D5D4, 7599, 1, 1}, {0x1D5D5, 7600, 1, 1},
+    {0x1D5D6, 7601, 1, 1}, {0x1D5D7, 7602, 1, 1}, {0x1D5D8, 7603, 1, 1}, {0x1D5D9, 7604, 1, 1},
+    {0x1D5DA, 7605, 1, 1}, {0x1D5DB, 7606, 1, 1}, {0x1D5DC, 7607, 1, 1}, {0x1D5DD, 7608, 1, 1},
+    {0x1D5DE, 7609, 1, 1}, {0x1D5DF, 7610, 1, 1}, {0x1D5E0, 7611, 1, 1}, {0x1D5E1, 7612, 1, 1},
+    {0x1D5E2, 7613, 1, 1}, {0x1D5E3, 7614, 1, 1}, {0x1D5E4, 7615, 1, 1}, {0x1D5E5, 7616, 1, 1},
+    {0x1D5E6, 7617, 1, 1}, {0x1D5E7, 7618, 1, 1}, {0x1D5E8, 7619, 1, 1}, {0x1D5E9, 7620, 1, 1},
+    {0x1D5EA, 7621, 1, 1}, {0x1D5EB, 7622, 1, 1}, {0x1D5EC, 7623, 1, 1}, {0x1D5ED, 7624, 1, 1},
+    {0x1D5EE, 7625, 1, 1}, {0x1D5EF, 7626, 1, 1}, {0x1D5F0, 7627, 1, 1}, {0x1D5F1, 7628, 1, 1},
+    {0x1D5F2, 7629, 1, 1}, {0x1D5F3, 7630, 1, 1}, {0x1D5F4, 7631, 1, 1}, {0x1D5F5, 7632, 1, 1},
+    {0x1D5F6, 7633, 1, 1}, {0x1D5F7, 7634, 1, 1}, {0x1D5F8, 7635, 1, 1}, {0x1D5F9, 7636, 1, 1},
+    {0x1D5FA, 7637, 1, 1}, {0x1D5FB, 7638, 1, 1}, {0x1D5FC, 7639, 1, 1}, {0x1D5FD, 7640, 1, 1},
+    {0x1D5FE, 7641, 1, 1}, {0x1D5FF, 7642, 1, 1}, {0x1D600, 7643, 1, 1}, {0x1D601, 7644, 1, 1},
+    {0x1D602, 7645, 1, 1}, {0x1D603, 7646, 1, 1}, {0x1D604, 7647, 1, 1}, {0x1D605, 7648, 1, 1},
+    {0x1D606, 7649, 1, 1}, {0x1D607, 7650, 1, 1}, {0x1D608, 7651, 1, 1}, {0x1D609, 7652, 1, 1},
+    {0x1D60A, 7653, 1, 1}, {0x1D60B, 7654, 1, 1}, {0x1D60C, 7655, 1, 1}, {0x1D60D, 7656, 1, 1},
+    {0x1D60E, 7657, 1, 1}, {0x1D60F, 7658, 1, 1}, {0x1D610, 7659, 1, 1}, {0x1D611, 7660, 1, 1},
+    {0x1D612, 7661, 1, 1}, {0x1D613, 7662, 1, 1}, {0x1D614, 7663, 1, 1}, {0x1D615, 7664, 1, 1},
+    {0x1D616, 7665, 1, 1}, {0x1D617, 7666, 1, 1}, {0x1D618, 7667, 1, 1}, {0x1D619, 7668, 1, 1},
+    {0x1D61A, 7669, 1, 1}, {0x1D61B, 7670, 1, 1}, {0x1D61C, 7671, 1, 1}, {0x1D61D, 7672, 1, 1},
+    {0x1D61E, 7673, 1, 1}, {0x1D61F, 7674, 1, 1}, {0x1D620, 7675, 1, 1}, {0x1D621, 7676, 1, 1},
+    {0x1D622, 7677, 1, 1}, {0x1D623, 7678, 1, 1}, {0x1D624, 7679, 1, 1}, {0x1D625, 7680, 1, 1},
+    {0x1D626, 7681, 1, 1}, {0x1D627, 7682, 1, 1}, {0x1D628, 7683, 1, 1}, {0x1D629, 7684, 1, 1},
+    {0x1D62A, 7685, 1, 1}, {0x1D62B, 7686, 1, 1}, {0x1D62C, 7687, 1, 1}, {0x1D62D, 7688, 1, 1},
+    {0x1D62E, 7689, 1, 1}, {0x1D62F, 7690, 1, 1}, {0x1D630, 7691, 1, 1}, {0x1D631, 7692, 1, 1},
+    {0x1D632, 7693, 1, 1}, {0x1D633, 7694, 1, 1}, {0x1D634, 7695, 1, 1}, {0x1D635, 7696, 1, 1},
+    {0x1D636, 7697, 1, 1}, {0x1D637, 7698, 1, 1}, {0x1D638, 7699, 1, 1}, {0x1D639, 7700, 1, 1},
+    {0x1D63A, 7701, 1, 1}, {0x1D63B, 7702, 1, 1}, {0x1D63C, 7703, 1, 1}, {0x1D63D, 7704, 1, 1},
+    {0x1D63E, 7705, 1, 1}, {0x1D63F, 7706, 1, 1}, {0x1D640, 7707, 1, 1}, {0x1D641, 7708, 1, 1},
+    {0x1D642, 7709, 1, 1}, {0x1D643, 7710, 1, 1}, {0x1D644, 7711, 1, 1}, {0x1D645, 7712, 1, 1},
+    {0x1D646, 7713, 1, 1}, {0x1D647, 7714, 1, 1}, {0x1D648, 7715, 1, 1}, {0x1D649, 7716, 1, 1},
+    {0x1D64A, 7717, 1, 1}, {0x1D64B, 7718, 1, 1}, {0x1D64C, 7719, 1, 1}, {0x1D64D, 7720, 1, 1},
+    {0x1D64E, 7721, 1, 1}, {0x1D64F, 7722, 1, 1}, {0x1D650, 7723, 1, 1}, {0x1D651, 7724, 1, 1},
+    {0x1D652, 7725, 1, 1}, {0x1D653, 7726, 1, 1}, {0x1D654, 7727, 1, 1}, {0x1D655, 7728, 1, 1},
+    {0x1D656, 7729, 1, 1}, {0x1D657, 7730, 1, 1}, {0x1D658, 7731, 1, 1}, {0x1D659, 7732, 1, 1},
+    {0x1D65A, 7733, 1, 1}, {0x1D65B, 7734, 1, 1}, {0x1D65C, 7735, 1, 1}, {0x1D65D, 7736, 1, 1},
+    {0x1D65E, 7737, 1, 1}, {0x1D65F, 7738, 1, 1}, {0x1D660, 7739, 1, 1}, {0x1D661, 7740, 1, 1},
+    {0x1D662, 7741, 1, 1}, {0x1D663, 7742, 1, 1}, {0x1D664, 7743, 1, 1}, {0x1D665, 7744, 1, 1},
+    {0x1D666, 7745, 1, 1}, {0x1D667, 7746, 1, 1}, {0x1D668, 7747, 1, 1}, {0x1D669, 7748, 1, 1},
+    {0x1D66A, 7749, 1, 1}, {0x1D66B, 7750, 1, 1}, {0x1D66C, 7751, 1, 1}, {0x1D66D, 7752, 1, 1},
+    {0x1D66E, 7753, 1, 1}, {0x1D66F, 7754, 1, 1}, {0x1D670, 7755, 1, 1}, {0x1D671, 7756, 1, 1},
+    {0x1D672, 7757, 1, 1}, {0x1D673, 7758, 1, 1}, {0x1D674, 7759, 1, 1}, {0x1D675, 7760, 1, 1},
+    {0x1D676, 7761, 1, 1}, {0x1D677, 7762, 1, 1}, {0x1D678, 7763, 1, 1}, {0x1D679, 7764, 1, 1},
+    {0x1D67A, 7765, 1, 1}, {0x1D67B, 7766, 1, 1}, {0x1D67C, 7767, 1, 1}, {0x1D67D, 7768, 1, 1},
+    {0x1D67E, 7769, 1, 1}, {0x1D67F, 7770, 1, 1}, {0x1D680, 7771, 1, 1}, {0x1D681, 7772, 1, 1},
+    {0x1D682, 7773, 1, 1}, {0x1D683, 7774, 1, 1}, {0x1D684, 7775, 1, 1}, {0x1D685, 7776, 1, 1},
+    {0x1D686, 7777, 1, 1}, {0x1D687, 7778, 1, 1}, {0x1D688, 7779, 1, 1}, {0x1D689, 7780, 1, 1},
+    {0x1D68A, 7781, 1, 1}, {0x1D68B, 7782, 1, 1}, {0x1D68C, 7783, 1, 1}, {0x1D68D, 7784, 1, 1},
+    {0x1D68E, 7785, 1, 1}, {0x1D68F, 7786, 1, 1}, {0x1D690, 7787, 1, 1}, {0x1D691, 7788, 1, 1},
+    {0x1D692, 7789, 1, 1}, {0x1D693, 7790, 1, 1}, {0x1D694, 7791, 1, 1}, {0x1D695, 7792, 1, 1},
+    {0x1D696, 7793, 1, 1}, {0x1D697, 7794, 1, 1}, {0x1D698, 7795, 1, 1}, {0x1D699, 7796, 1, 1},
+    {0x1D69A, 7797, 1, 1}, {0x1D69B, 7798, 1, 1}, {0x1D69C, 7799, 1, 1}, {0x1D69D, 7800, 1, 1},
+    {0x1D69E, 7801, 1, 1}, {0x1D69F, 7802, 1, 1}, {0x1D6A0, 7803, 1, 1}, {0x1D6A1, 7804, 1, 1},
+    {0x1D6A2, 7805, 1, 1}, {0x1D6A3, 7806, 1, 1}, {0x1D6A4, 7807, 1, 1}, {0x1D6A5, 7808, 1, 1},
+    {0x1D6A8, 7809, 1, 1}, {0x1D6A9, 7810, 1, 1}, {0x1D6AA, 7811, 1, 1}, {0x1D6AB, 7812, 1, 1},
+    {0x1D6AC, 7813, 1, 1}, {0x1D6AD, 7814, 1, 1}, {0x1D6AE, 7815, 1, 1}, {0x1D6AF, 7816, 1, 1},
+    {0x1D6B0, 7817, 1, 1}, {0x1D6B1, 7818, 1, 1}, {0x1D6B2, 7819, 1, 1}, {0x1D6B3, 7820, 1, 1},
+    {0x1D6B4, 7821, 1, 1}, {0x1D6B5, 7822, 1, 1}, {0x1D6B6, 7823, 1, 1}, {0x1D6B7, 7824, 1, 1},
+    {0x1D6B8, 7825, 1, 1}, {0x1D6B9, 7826, 1, 1}, {0x1D6BA, 7827, 1, 1}, {0x1D6BB, 7828, 1, 1},
+    {0x1D6BC, 7829, 1, 1}, {0x1D6BD, 7830, 1, 1}, {0x1D6BE, 7831, 1, 1}, {0x1D6BF, 7832, 1, 1},
+    {0x1D6C0, 7833, 1, 1}, {0x1D6C1, 7834, 1, 1}, {0x1D6C2, 7835, 1, 1}, {0x1D6C3, 7836, 1, 1},
+    {0x1D6C4, 7837, 1, 1}, {0x1D6C5, 7838, 1, 1}, {0x1D6C6, 7839, 1, 1}, {0x1D6C7, 7840, 1, 1},
+    {0x1D6C8, 7841, 1, 1}, {0x1D6C9, 7842, 1, 1}, {0x1D6CA, 7843, 1, 1}, {0x1D6CB, 7844, 1, 1},
+    {0x1D6CC, 7845, 1, 1}, {0x1D6CD, 7846, 1, 1}, {0x1D6CE, 7847, 1, 1}, {0x1D6CF, 7848, 1, 1},
+    {0x1D6D0, 7849, 1, 1}, {0x1D6D1, 7850, 1, 1}, {0x1D6D2, 7851, 1, 1}, {0x1D6D3, 7852, 1, 1},
+    {0x1D6D4, 7853, 1, 1}, {0x1D6D5, 7854, 1, 1}, {0x1D6D6, 7855, 1, 1}, {0x1D6D7, 7856, 1, 1},
+    {0x1D6D8, 7857, 1, 1}, {0x1D6D9, 7858, 1, 1}, {0x1D6DA, 7859, 1, 1}, {0x1D6DB, 7860, 1, 1},
+    {0x1D6DC, 7861, 1, 1}, {0x1D6DD, 7862, 1, 1}, {0x1D6DE, 7863, 1, 1}, {0x1D6DF, 7864, 1, 1},
+    {0x1D6E0, 7865, 1, 1}, {0x1D6E1, 7866, 1, 1}, {0x1D6E2, 7867, 1, 1}, {0x1D6E3, 7868, 1, 1},
+    {0x1D6E4, 7869, 1, 1}, {0x1D6E5, 7870, 1, 1}, {0x1D6E6, 7871, 1, 1}, {0x1D6E7, 7872, 1, 1},
+    {0x1D6E8, 7873, 1, 1}, {0x1D6E9, 7874, 1, 1}, {0x1D6EA, 7875, 1, 1}, {0x1D6EB, 7876, 1, 1},
+    {0x1D6EC, 7877, 1, 1}, {0x1D6ED, 7878, 1, 1}, {0x1D6EE, 7879, 1, 1}, {0x1D6EF, 7880, 1, 1},
+    {0x1D6F0, 7881, 1, 1}, {0x1D6F1, 7882, 1, 1}, {0x1D6F2, 7883, 1, 1}, {0x1D6F3, 7884, 1, 1},
+    {0x1D6F4, 7885, 1, 1}, {0x1D6F5, 7886, 1, 1}, {0x1D6F6, 7887, 1, 1}, {0x1D6F7, 7888, 1, 1},
+    {0x1D6F8, 7889, 1, 1}, {0x1D6F9, 7890, 1, 1}, {0x1D6FA, 7891, 1, 1}, {0x1D6FB, 7892, 1, 1},
+    {0x1D6FC, 7893, 1, 1}, {0x1D6FD, 7894, 1, 1}, {0x1D6FE, 7895, 1, 1}, {0x1D6FF, 7896, 1, 1},
+    {0x1D700, 7897, 1, 1}, {0x1D701, 7898, 1, 1}, {0x1D702, 7899, 1, 1}, {0x1D703, 7900, 1, 1},
+    {0x1D704, 7901, 1, 1}, {0x1D705, 7902, 1, 1}, {0x1D706, 7903, 1, 1}, {0x1D707, 7904, 1, 1},
+    {0x1D708, 7905, 1, 1}, {0x1D709, 7906, 1, 1}, {0x1D70A, 7907, 1, 1}, {0x1D70B, 7908, 1, 1},
+    {0x1D70C, 7909, 1, 1}, {0x1D70D, 7910, 1, 1}, {0x1D70E, 7911, 1, 1}, {0x1D70F, 7912, 1, 1},
+    {0x1D710, 7913, 1, 1}, {0x1D711, 7914, 1, 1}, {0x1D712, 7915, 1, 1}, {0x1D713, 7916, 1, 1},
+    {0x1D714, 7917, 1, 1}, {0x1D715, 7918, 1, 1}, {0x1D716, 7919, 1, 1}, {0x1D717, 7920, 1, 1},
+    {0x1D718, 7921, 1, 1}, {0x1D719, 7922, 1, 1}, {0x1D71A, 7923, 1, 1}, {0x1D71B, 7924, 1, 1},
+    {0x1D71C, 7925, 1, 1}, {0x1D71D, 7926, 1, 1}, {0x1D71E, 7927, 1, 1}, {0x1D71F, 7928, 1, 1},
+    {0x1D720, 7929, 1, 1}, {0x1D721, 7930, 1, 1}, {0x1D722, 7931, 1, 1}, {0x1D723, 7932, 1, 1},
+    {0x1D724, 7933, 1, 1}, {0x1D725, 7934, 1, 1}, {0x1D726, 7935, 1, 1}, {0x1D727, 7936, 1, 1},
+    {0x1D728, 7937, 1, 1}, {0x1D729, 7938, 1, 1}, {0x1D72A, 7939, 1, 1}, {0x1D72B, 7940, 1, 1},
+    {0x1D72C, 7941, 1, 1}, {0x1D72D, 7942, 1, 1}, {0x1D72E, 7943, 1, 1}, {0x1D72F, 7944, 1, 1},
+    {0x1D730, 7945, 1, 1}, {0x1D731, 7946, 1, 1}, {0x1D732, 7947, 1, 1}, {0x1D733, 7948, 1, 1},
+    {0x1D734, 7949, 1, 1}, {0x1D735, 7950, 1, 1}, {0x1D736, 7951, 1, 1}, {0x1D737, 7952, 1, 1},
+    {0x1D738, 7953, 1, 1}, {0x1D739, 7954, 1, 1}, {0x1D73A, 7955, 1, 1}, {0x1D73B, 7956, 1, 1},
+    {0x1D73C, 7957, 1, 1}, {0x1D73D, 7958, 1, 1}, {0x1D73E, 7959, 1, 1}, {0x1D73F, 7960, 1, 1},
+    {0x1D740, 7961, 1, 1}, {0x1D741, 7962, 1, 1}, {0x1D742, 7963, 1, 1}, {0x1D743, 7964, 1, 1},
+    {0x1D744, 7965, 1, 1}, {0x1D745, 7966, 1, 1}, {0x1D746, 7967, 1, 1}, {0x1D747, 7968, 1, 1},
+    {0x1D748, 7969, 1, 1}, {0x1D749, 7970, 1, 1}, {0x1D74A, 7971, 1, 1}, {0x1D74B, 7972, 1, 1},
+    {0x1D74C, 7973, 1, 1}, {0x1D74D, 7974, 1, 1}, {0x1D74E, 7975, 1, 1}, {0x1D74F, 7976, 1, 1},
+    {0x1D750, 7977, 1, 1}, {0x1D751, 7978, 1, 1}, {0x1D752, 7979, 1, 1}, {0x1D753, 7980, 1, 1},
+    {0x1D754, 7981, 1, 1}, {0x1D755, 7982, 1, 1}, {0x1D756, 7983, 1, 1}, {0x1D757, 7984, 1, 1},
+    {0x1D758, 7985, 1, 1}, {0x1D759, 7986, 1, 1}, {0x1D75A, 7987, 1, 1}, {0x1D75B, 7988, 1, 1},
+    {0x1D75C, 7989, 1, 1}, {0x1D75D, 7990, 1, 1}, {0x1D75E, 7991, 1, 1}, {0x1D75F, 7992, 1, 1},
+    {0x1D760, 7993, 1, 1}, {0x1D761, 7994, 1, 1}, {0x1D762, 7995, 1, 1}, {0x1D763, 7996, 1, 1},
+    {0x1D764, 7997, 1, 1}, {0x1D765, 7998, 1, 1}, {0x1D766, 7999, 1, 1}, {0x1D767, 8000, 1, 1},
+    {0x1D768, 8001, 1, 1}, {0x1D769, 8002, 1, 1}, {0x1D76A, 8003, 1, 1}, {0x1D76B, 8004, 1, 1},
+    {0x1D76C, 8005, 1, 1}, {0x1D76D, 8006, 1, 1}, {0x1D76E, 8007, 1, 1}, {0x1D76F, 8008, 1, 1},
+    {0x1D770, 8009, 1, 1}, {0x1D771, 8010, 1, 1}, {0x1D772, 8011, 1, 1}, {0x1D773, 8012, 1, 1},
+    {0x1D774, 8013, 1, 1}, {0x1D775, 8014, 1, 1}, {0x1D776, 8015, 1, 1}, {0x1D777, 8016, 1, 1},
+    {0x1D778, 8017, 1, 1}, {0x1D779, 8018, 1, 1}, {0x1D77A, 8019, 1, 1}, {0x1D77B, 8020, 1, 1},
+    {0x1D77C, 8021, 1, 1}, {0x1D77D, 8022, 1, 1}, {0x1D77E, 8023, 1, 1}, {0x1D77F, 8024, 1, 1},
+    {0x1D780, 8025, 1, 1}, {0x1D781, 8026, 1, 1}, {0x1D782, 8027, 1, 1}, {0x1D783, 8028, 1, 1},
+    {0x1D784, 8029, 1, 1}, {0x1D785, 8030, 1, 1}, {0x1D786, 8031, 1, 1}, {0x1D787, 8032, 1, 1},
+    {0x1D788, 8033, 1, 1}, {0x1D789, 8034, 1, 1}, {0x1D78A, 8035, 1, 1}, {0x1D78B, 8036, 1, 1},
+    {0x1D78C, 8037, 1, 1}, {0x1D78D, 8038, 1, 1}, {0x1D78E, 8039, 1, 1}, {0x1D78F, 8040, 1, 1},
+    {0x1D790, 8041, 1, 1}, {0x1D791, 8042, 1, 1}, {0x1D792, 8043, 1, 1}, {0x1D793, 8044, 1, 1},
+    {0x1D794, 8045, 1, 1}, {0x1D795, 8046, 1, 1}, {0x1D796, 8047, 1, 1}, {0x1D797, 8048, 1, 1},
+    {0x1D798, 8049, 1, 1}, {0x1D799, 8050, 1, 1}, {0x1D79A, 8051, 1, 1}, {0x1D79B, 8052, 1, 1},
+    {0x1D79C, 8053, 1, 1}, {0x1D79D, 8054, 1, 1}, {0x1D79E, 8055, 1, 1}, {0x1D79F, 8056, 1, 1},
+    {0x1D7A0, 8057, 1, 1}, {0x1D7A1, 8058, 1, 1}, {0x1D7A2, 8059, 1, 1}, {0x1D7A3, 8060, 1, 1},
+    {0x1D7A4, 8061, 1, 1}, {0x1D7A5, 8062, 1, 1}, {0x1D7A6, 8063, 1, 1}, {0x1D7A7, 8064, 1, 1},
+    {0x1D7A8, 8065, 1, 1}, {0x1D7A9, 8066, 1, 1}, {0x1D7AA, 8067, 1, 1}, {0x1D7AB, 8068, 1, 1},
+    {0x1D7AC, 8069, 1, 1}, {0x1D7AD, 8070, 1, 1}, {0x1D7AE, 8071, 1, 1}, {0x1D7AF, 8072, 1, 1},
+    {0x1D7B0, 8073, 1, 1}, {0x1D7B1, 8074, 1, 1}, {0x1D7B2, 8075, 1, 1}, {0x1D7B3, 8076, 1, 1},
+    {0x1D7B4, 8077, 1, 1}, {0x1D7B5, 8078, 1, 1}, {0x1D7B6, 8079, 1, 1}, {0x1D7B7, 8080, 1, 1},
+    {0x1D7B8, 8081, 1, 1}, {0x1D7B9, 8082, 1, 1}, {0x1D7BA, 8083, 1, 1}, {0x1D7BB, 8084, 1, 1},
+    {0x1D7BC, 8085, 1, 1}, {0x1D7BD, 8086, 1, 1}, {0x1D7BE, 8087, 1, 1}, {0x1D7BF, 8088, 1, 1},
+    {0x1D7C0, 8089, 1, 1}, {0x1D7C1, 8090, 1, 1}, {0x1D7C2, 8091, 1, 1}, {0x1D7C3, 8092, 1, 1},
+    {0x1D7C4, 8093, 1, 1}, {0x1D7C5, 8094, 1, 1}, {0x1D7C6, 8095, 1, 1}, {0x1D7C7, 8096, 1, 1},
+    {0x1D7C8, 8097, 1, 1}, {0x1D7C9, 8098, 1, 1}, {0x1D7CA, 8099, 1, 1}, {0x1D7CB, 8100, 1, 1},
+    {0x1D7CE, 8101, 1, 1}, {0x1D7CF, 8102, 1, 1}, {0x1D7D0, 8103, 1, 1}, {0x1D7D1, 8104, 1, 1},
+    {0x1D7D2, 8105, 1, 1}, {0x1D7D3, 8106, 1, 1}, {0x1D7D4, 8107, 1, 1}, {0x1D7D5, 8108, 1, 1},
+    {0x1D7D6, 8109, 1, 1}, {0x1D7D7, 8110, 1, 1}, {0x1D7D8, 8111, 1, 1}, {0x1D7D9, 8112, 1, 1},
+    {0x1D7DA, 8113, 1, 1}, {0x1D7DB, 8114, 1, 1}, {0x1D7DC, 8115, 1, 1}, {0x1D7DD, 8116, 1, 1},
+    {0x1D7DE, 8117, 1, 1}, {0x1D7DF, 8118, 1, 1}, {0x1D7E0, 8119, 1, 1}, {0x1D7E1, 8120, 1, 1},
+    {0x1D7E2, 8121, 1, 1}, {0x1D7E3, 8122, 1, 1}, {0x1D7E4, 8123, 1, 1}, {0x1D7E5, 8124, 1, 1},
+    {0x1D7E6, 8125, 1, 1}, {0x1D7E7, 8126, 1, 1}, {0x1D7E8, 8127, 1, 1}, {0x1D7E9, 8128, 1, 1},
+    {0x1D7EA, 8129, 1, 1}, {0x1D7EB, 8130, 1, 1}, {0x1D7EC, 8131, 1, 1}, {0x1D7ED, 8132, 1, 1},
+    {0x1D7EE, 8133, 1, 1}, {0x1D7EF, 8134, 1, 1}, {0x1D7F0, 8135, 1, 1}, {0x1D7F1, 8136, 1, 1},
+    {0x1D7F2, 8137, 1, 1}, {0x1D7F3, 8138, 1, 1}, {0x1D7F4, 8139, 1, 1}, {0x1D7F5, 8140, 1, 1},
+    {0x1D7F6, 8141, 1, 1}, {0x1D7F7, 8142, 1, 1}, {0x1D7F8, 8143, 1, 1}, {0x1D7F9, 8144, 1, 1},
+    {0x1D7FA, 8145, 1, 1}, {0x1D7FB, 8146, 1, 1}, {0x1D7FC, 8147, 1, 1}, {0x1D7FD, 8148, 1, 1},
+    {0x1D7FE, 8149, 1, 1}, {0x1D7FF, 8150, 1, 1}, {0x1EE00, 8151, 1, 1}, {0x1EE01, 8152, 1, 1},
+    {0x1EE02, 8153, 1, 1}, {0x1EE03, 8154, 1, 1}, {0x1EE05, 8155, 1, 1}, {0x1EE06, 8156, 1, 1},
+    {0x1EE07, 8157, 1, 1}, {0x1EE08, 8158, 1, 1}, {0x1EE09, 8159, 1, 1}, {0x1EE0A, 8160, 1, 1},
+    {0x1EE0B, 8161, 1, 1}, {0x1EE0C, 8162, 1, 1}, {0x1EE0D, 8163, 1, 1}, {0x1EE0E, 8164, 1, 1},
+    {0x1EE0F, 8165, 1, 1}, {0x1EE10, 8166, 1, 1}, {0x1EE11, 8167, 1, 1}, {0x1EE12, 8168, 1, 1},
+    {0x1EE13, 8169, 1, 1}, {0x1EE14, 8170, 1, 1}, {0x1EE15, 8171, 1, 1}, {0x1EE16, 8172, 1, 1},
+    {0x1EE17, 8173, 1, 1}, {0x1EE18, 8174, 1, 1}, {0x1EE19, 8175, 1, 1}, {0x1EE1A, 8176, 1, 1},
+    {0x1EE1B, 8177, 1, 1}, {0x1EE1C, 8178, 1, 1}, {0x1EE1D, 8179, 1, 1}, {0x1EE1E, 8180, 1, 1},
+    {0x1EE1F, 8181, 1, 1}, {0x1EE21, 8182, 1, 1}, {0x1EE22, 8183, 1, 1}, {0x1EE24, 8184, 1, 1},
+    {0x1EE27, 8185, 1, 1}, {0x1EE29, 8186, 1, 1}, {0x1EE2A, 8187, 1, 1}, {0x1EE2B, 8188, 1, 1},
+    {0x1EE2C, 8189, 1, 1}, {0x1EE2D, 8190, 1, 1}, {0x1EE2E, 8191, 1, 1}, {0x1EE2F, 8192, 1, 1},
+    {0x1EE30, 8193, 1, 1}, {0x1EE31, 8194, 1, 1}, {0x1EE32, 8195, 1, 1}, {0x1EE34, 8196, 1, 1},
+    {0x1EE35, 8197, 1, 1}, {0x1EE36, 8198, 1, 1}, {0x1EE37, 8199, 1, 1}, {0x1EE39, 8200, 1, 1},
+    {0x1EE3B, 8201, 1, 1}, {0x1EE42, 8202, 1, 1}, {0x1EE47, 8203, 1, 1}, {0x1EE49, 8204, 1, 1},
+    {0x1EE4B, 8205, 1, 1}, {0x1EE4D, 8206, 1, 1}, {0x1EE4E, 8207, 1, 1}, {0x1EE4F, 8208, 1, 1},
+    {0x1EE51, 8209, 1, 1}, {0x1EE52, 8210, 1, 1}, {0x1EE54, 8211, 1, 1}, {0x1EE57, 8212, 1, 1},
+    {0x1EE59, 8213, 1, 1}, {0x1EE5B, 8214, 1, 1}, {0x1EE5D, 8215, 1, 1}, {0x1EE5F, 8216, 1, 1},
+    {0x1EE61, 8217, 1, 1}, {0x1EE62, 8218, 1, 1}, {0x1EE64, 8219, 1, 1}, {0x1EE67, 8220, 1, 1},
+    {0x1EE68, 8221, 1, 1}, {0x1EE69, 8222, 1, 1}, {0x1EE6A, 8223, 1, 1}, {0x1EE6C, 8224, 1, 1},
+    {0x1EE6D, 8225, 1, 1}, {0x1EE6E, 8226, 1, 1}, {0x1EE6F, 8227, 1, 1}, {0x1EE70, 8228, 1, 1},
+    {0x1EE71, 8229, 1, 1}, {0x1EE72, 8230, 1, 1}, {0x1EE74, 8231, 1, 1}, {0x1EE75, 8232, 1, 1},
+    {0x1EE76, 8233, 1, 1}, {0x1EE77, 8234, 1, 1}, {0x1EE79, 8235, 1, 1}, {0x1EE7A, 8236, 1, 1},
+    {0x1EE7B, 8237, 1, 1}, {0x1EE7C, 8238, 1, 1}, {0x1EE7E, 8239, 1, 1}, {0x1EE80, 8240, 1, 1},
+    {0x1EE81, 8241, 1, 1}, {0x1EE82, 8242, 1, 1}, {0x1EE83, 8243, 1, 1}, {0x1EE84, 8244, 1, 1},
+    {0x1EE85, 8245, 1, 1}, {0x1EE86, 8246, 1, 1}, {0x1EE87, 8247, 1, 1}, {0x1EE88, 8248, 1, 1},
+    {0x1EE89, 8249, 1, 1}, {0x1EE8B, 8250, 1, 1}, {0x1EE8C, 8251, 1, 1}, {0x1EE8D, 8252, 1, 1},
+    {0x1EE8E, 8253, 1, 1}, {0x1EE8F, 8254, 1, 1}, {0x1EE90, 8255, 1, 1}, {0x1EE91, 8256, 1, 1},
+    {0x1EE92, 8257, 1, 1}, {0x1EE93, 8258, 1, 1}, {0x1EE94, 8259, 1, 1}, {0x1EE95, 8260, 1, 1},
+    {0x1EE96, 8261, 1, 1}, {0x1EE97, 8262, 1, 1}, {0x1EE98, 8263, 1, 1}, {0x1EE99, 8264, 1, 1},
+    {0x1EE9A, 8265, 1, 1}, {0x1EE9B, 8266, 1, 1}, {0x1EEA1, 8267, 1, 1}, {0x1EEA2, 8268, 1, 1},
+    {0x1EEA3, 8269, 1, 1}, {0x1EEA5, 8270, 1, 1}, {0x1EEA6, 8271, 1, 1}, {0x1EEA7, 8272, 1, 1},
+    {0x1EEA8, 8273, 1, 1}, {0x1EEA9, 8274, 1, 1}, {0x1EEAB, 8275, 1, 1}, {0x1EEAC, 8276, 1, 1},
+    {0x1EEAD, 8277, 1, 1}, {0x1EEAE, 8278, 1, 1}, {0x1EEAF, 8279, 1, 1}, {0x1EEB0, 8280, 1, 1},
+    {0x1EEB1, 8281, 1, 1}, {0x1EEB2, 8282, 1, 1}, {0x1EEB3, 8283, 1, 1}, {0x1EEB4, 8284, 1, 1},
+    {0x1EEB5, 8285, 1, 1}, {0x1EEB6, 8286, 1, 1}, {0x1EEB7, 8287, 1, 1}, {0x1EEB8, 8288, 1, 1},
+    {0x1EEB9, 8289, 1, 1}, {0x1EEBA, 8290, 1, 1}, {0x1EEBB, 8291, 1, 1}, {0x1F100, 8292, 2, 1},
+    {0x1F101, 8294, 2, 1}, {0x1F102, 8296, 2, 1}, {0x1F103, 8298, 2, 1}, {0x1F104, 8300, 2, 1},
+    {0x1F105, 8302, 2, 1}, {0x1F106, 8304, 2, 1}, {0x1F107, 8306, 2, 1}, {0x1F108, 8308, 2, 1},
+    {0x1F109, 8310, 2, 1}, {0x1F10A, 8312, 2, 1}, {0x1F110, 8314, 3, 1}, {0x1F111, 8317, 3, 1},
+    {0x1F112, 8320, 3, 1}, {0x1F113, 8323, 3, 1}, {0x1F114, 8326, 3, 1}, {0x1F115, 8329, 3, 1},
+    {0x1F116, 8332, 3, 1}, {0x1F117, 8335, 3, 1}, {0x1F118, 8338, 3, 1}, {0x1F119, 8341, 3, 1},
+    {0x1F11A, 8344, 3, 1}, {0x1F11B, 8347, 3, 1}, {0x1F11C, 8350, 3, 1}, {0x1F11D, 8353, 3, 1},
+    {0x1F11E, 8356, 3, 1}, {0x1F11F, 8359, 3, 1}, {0x1F120, 8362, 3, 1}, {0x1F121, 8365, 3, 1},
+    {0x1F122, 8368, 3, 1}, {0x1F123, 8371, 3, 1}, {0x1F124, 8374, 3, 1}, {0x1F125, 8377, 3, 1},
+    {0x1F126, 8380, 3, 1}, {0x1F127, 8383, 3, 1}, {0x1F128, 8386, 3, 1}, {0x1F129, 8389, 3, 1},
+    {0x1F12A, 8392, 3, 1}, {0x1F12B, 8395, 1, 1}, {0x1F12C, 8396, 1, 1}, {0x1F12D, 8397, 2, 1},
+    {0x1F12E, 8399, 2, 1}, {0x1F130, 8401, 1, 1}, {0x1F131, 8402, 1, 1}, {0x1F132, 8403, 1, 1},
+    {0x1F133, 8404, 1, 1}, {0x1F134, 8405, 1, 1}, {0x1F135, 8406, 1, 1}, {0x1F136, 8407, 1, 1},
+    {0x1F137, 8408, 1, 1}, {0x1F138, 8409, 1, 1}, {0x1F139, 8410, 1, 1}, {0x1F13A, 8411, 1, 1},
+    {0x1F13B, 8412, 1, 1}, {0x1F13C, 8413, 1, 1}, {0x1F13D, 8414, 1, 1}, {0x1F13E, 8415, 1, 1},
+    {0x1F13F, 8416, 1, 1}, {0x1F140, 8417, 1, 1}, {0x1F141, 8418, 1, 1}, {0x1F142, 8419, 1, 1},
+    {0x1F143, 8420, 1, 1}, {0x1F144, 8421, 1, 1}, {0x1F145, 8422, 1, 1}, {0x1F146, 8423, 1, 1},
+    {0x1F147, 8424, 1, 1}, {0x1F148, 8425, 1, 1}, {0x1F149, 8426, 1, 1}, {0x1F14A, 8427, 2, 1},
+    {0x1F14B, 8429, 2, 1}, {0x1F14C, 8431, 2, 1}, {0x1F14D, 8433, 2, 1}, {0x1F14E, 8435, 3, 1},
+    {0x1F14F, 8438, 2, 1}, {0x1F16A, 8440, 2, 1}, {0x1F16B, 8442, 2, 1}, {0x1F16C, 8444, 2, 1},
+    {0x1F190, 8446, 2, 1}, {0x1F200, 8448, 2, 1}, {0x1F201, 8450, 2, 1}, {0x1F202, 8452, 1, 1},
+    {0x1F210, 8453, 1, 1}, {0x1F211, 8454, 1, 1}, {0x1F212, 8455, 1, 1}, {0x1F213, 8456, 2, 1},
+    {0x1F214, 8458, 1, 1}, {0x1F215, 8459, 1, 1}, {0x1F216, 8460, 1, 1}, {0x1F217, 8461, 1, 1},
+    {0x1F218, 8462, 1, 1}, {0x1F219, 8463, 1, 1}, {0x1F21A, 8464, 1, 1}, {0x1F21B, 8465, 1, 1},
+    {0x1F21C, 8466, 1, 1}, {0x1F21D, 8467, 1, 1}, {0x1F21E, 8468, 1, 1}, {0x1F21F, 8469, 1, 1},
+    {0x1F220, 8470, 1, 1}, {0x1F221, 8471, 1, 1}, {0x1F222, 8472, 1, 1}, {0x1F223, 8473, 1, 1},
+    {0x1F224, 8474, 1, 1}, {0x1F225, 8475, 1, 1}, {0x1F226, 8476, 1, 1}, {0x1F227, 8477, 1, 1},
+    {0x1F228, 8478, 1, 1}, {0x1F229, 8479, 1, 1}, {0x1F22A, 8480, 1, 1}, {0x1F22B, 8481, 1, 1},
+    {0x1F22C, 8482, 1, 1}, {0x1F22D, 8483, 1, 1}, {0x1F22E, 8484, 1, 1}, {0x1F22F, 8485, 1, 1},
+    {0x1F230, 8486, 1, 1}, {0x1F231, 8487, 1, 1}, {0x1F232, 8488, 1, 1}, {0x1F233, 8489, 1, 1},
+    {0x1F234, 8490, 1, 1}, {0x1F235, 8491, 1, 1}, {0x1F236, 8492, 1, 1}, {0x1F237, 8493, 1, 1},
+    {0x1F238, 8494, 1, 1}, {0x1F239, 8495, 1, 1}, {0x1F23A, 8496, 1, 1}, {0x1F23B, 8497, 1, 1},
+    {0x1F240, 8498, 3, 1}, {0x1F241, 8501, 3, 1}, {0x1F242, 8504, 3, 1}, {0x1F243, 8507, 3, 1},
+    {0x1F244, 8510, 3, 1}, {0x1F245, 8513, 3, 1}, {0x1F246, 8516, 3, 1}, {0x1F247, 8519, 3, 1},
+    {0x1F248, 8522, 3, 1}, {0x1F250, 8525, 1, 1}, {0x1F251, 8526, 1, 1}, {0x1FBF0, 8527, 1, 1},
+    {0x1FBF1, 8528, 1, 1}, {0x1FBF2, 8529, 1, 1}, {0x1FBF3, 8530, 1, 1}, {0x1FBF4, 8531, 1, 1},
+    {0x1FBF5, 8532, 1, 1}, {0x1FBF6, 8533, 1, 1}, {0x1FBF7, 8534, 1, 1}, {0x1FBF8, 8535, 1, 1},
+    {0x1FBF9, 8536, 1, 1}, {0x2F800, 8537, 1, 0}, {0x2F801, 8538, 1, 0}, {0x2F802, 8539, 1, 0},
+    {0x2F803, 8540, 1, 0}, {0x2F804, 8541, 1, 0}, {0x2F805, 8542, 1, 0}, {0x2F806, 8543, 1, 0},
+    {0x2F807, 8544, 1, 0}, {0x2F808, 8545, 1, 0}, {0x2F809, 8546, 1, 0}, {0x2F80A, 8547, 1, 0},
+    {0x2F80B, 8548, 1, 0}, {0x2F80C, 8549, 1, 0}, {0x2F80D, 8550, 1, 0}, {0x2F80E, 8551, 1, 0},
+    {0x2F80F, 8552, 1, 0}, {0x2F810, 8553, 1, 0}, {0x2F811, 8554, 1, 0}, {0x2F812, 8555, 1, 0},
+    {0x2F813, 8556, 1, 0}, {0x2F814, 8557, 1, 0}, {0x2F815, 8558, 1, 0}, {0x2F816, 8559, 1, 0},
+    {0x2F817, 8560, 1, 0}, {0x2F818, 8561, 1, 0}, {0x2F819, 8562, 1, 0}, {0x2F81A, 8563, 1, 0},
+    {0x2F81B, 8564, 1, 0}, {0x2F81C, 8565, 1, 0}, {0x2F81D, 8566, 1, 0}, {0x2F81E, 8567, 1, 0},
+    {0x2F81F, 8568, 1, 0}, {0x2F820, 8569, 1, 0}, {0x2F821, 8570, 1, 0}, {0x2F822, 8571, 1, 0},
+    {0x2F823, 8572, 1, 0}, {0x2F824, 8573, 1, 0}, {0x2F825, 8574, 1, 0}, {0x2F826, 8575, 1, 0},
+    {0x2F827, 8576, 1, 0}, {0x2F828, 8577, 1, 0}, {0x2F829, 8578, 1, 0}, {0x2F82A, 8579, 1, 0},
+    {0x2F82B, 8580, 1, 0}, {0x2F82C, 8581, 1, 0}, {0x2F82D, 8582, 1, 0}, {0x2F82E, 8583, 1, 0},
+    {0x2F82F, 8584, 1, 0}, {0x2F830, 8585, 1, 0}, {0x2F831, 8586, 1, 0}, {0x2F832, 8587, 1, 0},
+    {0x2F833, 8588, 1, 0}, {0x2F834, 8589, 1, 0}, {0x2F835, 8590, 1, 0}, {0x2F836, 8591, 1, 0},
+    {0x2F837, 8592, 1, 0}, {0x2F838, 8593, 1, 0}, {0x2F839, 8594, 1, 0}, {0x2F83A, 8595, 1, 0},
+    {0x2F83B, 8596, 1, 0}, {0x2F83C, 8597, 1, 0}, {0x2F83D, 8598, 1, 0}, {0x2F83E, 8599, 1, 0},
+    {0x2F83F, 8600, 1, 0}, {0x2F840, 8601, 1, 0}, {0x2F841, 8602, 1, 0}, {0x2F842, 8603, 1, 0},
+    {0x2F843, 8604, 1, 0}, {0x2F844, 8605, 1, 0}, {0x2F845, 8606, 1, 0}, {0x2F846, 8607, 1, 0},
+    {0x2F847, 8608, 1, 0}, {0x2F848, 8609, 1, 0}, {0x2F849, 8610, 1, 0}, {0x2F84A, 8611, 1, 0},
+    {0x2F84B, 8612, 1, 0}, {0x2F84C, 8613, 1, 0}, {0x2F84D, 8614, 1, 0}, {0x2F84E, 8615, 1, 0},
+    {0x2F84F, 8616, 1, 0}, {0x2F850, 8617, 1, 0}, {0x2F851, 8618, 1, 0}, {0x2F852, 8619, 1, 0},
+    {0x2F853, 8620, 1, 0}, {0x2F854, 8621, 1, 0}, {0x2F855, 8622, 1, 0}, {0x2F856, 8623, 1, 0},
+    {0x2F857, 8624, 1, 0}, {0x2F858, 8625, 1, 0}, {0x2F859, 8626, 1, 0}, {0x2F85A, 8627, 1, 0},
+    {0x2F85B, 8628, 1, 0}, {0x2F85C, 8629, 1, 0}, {0x2F85D, 8630, 1, 0}, {0x2F85E, 8631, 1, 0},
+    {0x2F85F, 8632, 1, 0}, {0x2F860, 8633, 1, 0}, {0x2F861, 8634, 1, 0}, {0x2F862, 8635, 1, 0},
+    {0x2F863, 8636, 1, 0}, {0x2F864, 8637, 1, 0}, {0x2F865, 8638, 1, 0}, {0x2F866, 8639, 1, 0},
+    {0x2F867, 8640, 1, 0}, {0x2F868, 8641, 1, 0}, {0x2F869, 8642, 1, 0}, {0x2F86A, 8643, 1, 0},
+    {0x2F86B, 8644, 1, 0}, {0x2F86C, 8645, 1, 0}, {0x2F86D, 8646, 1, 0}, {0x2F86E, 8647, 1, 0},
+    {0x2F86F, 8648, 1, 0}, {0x2F870, 8649, 1, 0}, {0x2F871, 8650, 1, 0}, {0x2F872, 8651, 1, 0},
+    {0x2F873, 8652, 1, 0}, {0x2F874, 8653, 1, 0}, {0x2F875, 8654, 1, 0}, {0x2F876, 8655, 1, 0},
+    {0x2F877, 8656, 1, 0}, {0x2F878, 8657, 1, 0}, {0x2F879, 8658, 1, 0}, {0x2F87A, 8659, 1, 0},
+    {0x2F87B, 8660, 1, 0}, {0x2F87C, 8661, 1, 0}, {0x2F87D, 8662, 1, 0}, {0x2F87E, 8663, 1, 0},
+    {0x2F87F, 8664, 1, 0}, {0x2F880, 8665, 1, 0}, {0x2F881, 8666, 1, 0}, {0x2F882, 8667, 1, 0},
+    {0x2F883, 8668, 1, 0}, {0x2F884, 8669, 1, 0}, {0x2F885, 8670, 1, 0}, {0x2F886, 8671, 1, 0},
+    {0x2F887, 8672, 1, 0}, {0x2F888, 8673, 1, 0}, {0x2F889, 8674, 1, 0}, {0x2F88A, 8675, 1, 0},
+    {0x2F88B, 8676, 1, 0}, {0x2F88C, 8677, 1, 0}, {0x2F88D, 8678, 1, 0}, {0x2F88E, 8679, 1, 0},
+    {0x2F88F, 8680, 1, 0}, {0x2F890, 8681, 1, 0}, {0x2F891, 8682, 1, 0}, {0x2F892, 8683, 1, 0},
+    {0x2F893, 8684, 1, 0}, {0x2F894, 8685, 1, 0}, {0x2F895, 8686, 1, 0}, {0x2F896, 8687, 1, 0},
+    {0x2F897, 8688, 1, 0}, {0x2F898, 8689, 1, 0}, {0x2F899, 8690, 1, 0}, {0x2F89A, 8691, 1, 0},
+    {0x2F89B, 8692, 1, 0}, {0x2F89C, 8693, 1, 0}, {0x2F89D, 8694, 1, 0}, {0x2F89E, 8695, 1, 0},
+    {0x2F89F, 8696, 1, 0}, {0x2F8A0, 8697, 1, 0}, {0x2F8A1, 8698, 1, 0}, {0x2F8A2, 8699, 1, 0},
+    {0x2F8A3, 8700, 1, 0}, {0x2F8A4, 8701, 1, 0}, {0x2F8A5, 8702, 1, 0}, {0x2F8A6, 8703, 1, 0},
+    {0x2F8A7, 8704, 1, 0}, {0x2F8A8, 8705, 1, 0}, {0x2F8A9, 8706, 1, 0}, {0x2F8AA, 8707, 1, 0},
+    {0x2F8AB, 8708, 1, 0}, {0x2F8AC, 8709, 1, 0}, {0x2F8AD, 8710, 1, 0}, {0x2F8AE, 8711, 1, 0},
+    {0x2F8AF, 8712, 1, 0}, {0x2F8B0, 8713, 1, 0}, {0x2F8B1, 8714, 1, 0}, {0x2F8B2, 8715, 1, 0},
+    {0x2F8B3, 8716, 1, 0}, {0x2F8B4, 8717, 1, 0}, {0x2F8B5, 8718, 1, 0}, {0x2F8B6, 8719, 1, 0},
+    {0x2F8B7, 8720, 1, 0}, {0x2F8B8, 8721, 1, 0}, {0x2F8B9, 8722, 1, 0}, {0x2F8BA, 8723, 1, 0},
+    {0x2F8BB, 8724, 1, 0}, {0x2F8BC, 8725, 1, 0}, {0x2F8BD, 8726, 1, 0}, {0x2F8BE, 8727, 1, 0},
+    {0x2F8BF, 8728, 1, 0}, {0x2F8C0, 8729, 1, 0}, {0x2F8C1, 8730, 1, 0}, {0x2F8C2, 8731, 1, 0},
+    {0x2F8C3, 8732, 1, 0}, {0x2F8C4, 8733, 1, 0}, {0x2F8C5, 8734, 1, 0}, {0x2F8C6, 8735, 1, 0},
+    {0x2F8C7, 8736, 1, 0}, {0x2F8C8, 8737, 1, 0}, {0x2F8C9, 8738, 1, 0}, {0x2F8CA, 8739, 1, 0},
+    {0x2F8CB, 8740, 1, 0}, {0x2F8CC, 8741, 1, 0}, {0x2F8CD, 8742, 1, 0}, {0x2F8CE, 8743, 1, 0},
+    {0x2F8CF, 8744, 1, 0}, {0x2F8D0, 8745, 1, 0}, {0x2F8D1, 8746, 1, 0}, {0x2F8D2, 8747, 1, 0},
+    {0x2F8D3, 8748, 1, 0}, {0x2F8D4, 8749, 1, 0}, {0x2F8D5, 8750, 1, 0}, {0x2F8D6, 8751, 1, 0},
+    {0x2F8D7, 8752, 1, 0}, {0x2F8D8, 8753, 1, 0}, {0x2F8D9, 8754, 1, 0}, {0x2F8DA, 8755, 1, 0},
+    {0x2F8DB, 8756, 1, 0}, {0x2F8DC, 8757, 1, 0}, {0x2F8DD, 8758, 1, 0}, {0x2F8DE, 8759, 1, 0},
+    {0x2F8DF, 8760, 1, 0}, {0x2F8E0, 8761, 1, 0}, {0x2F8E1, 8762, 1, 0}, {0x2F8E2, 8763, 1, 0},
+    {0x2F8E3, 8764, 1, 0}, {0x2F8E4, 8765, 1, 0}, {0x2F8E5, 8766, 1, 0}, {0x2F8E6, 8767, 1, 0},
+    {0x2F8E7, 8768, 1, 0}, {0x2F8E8, 8769, 1, 0}, {0x2F8E9, 8770, 1, 0}, {0x2F8EA, 8771, 1, 0},
+    {0x2F8EB, 8772, 1, 0}, {0x2F8EC, 8773, 1, 0}, {0x2F8ED, 8774, 1, 0}, {0x2F8EE, 8775, 1, 0},
+    {0x2F8EF, 8776, 1, 0}, {0x2F8F0, 8777, 1, 0}, {0x2F8F1, 8778, 1, 0}, {0x2F8F2, 8779, 1, 0},
+    {0x2F8F3, 8780, 1, 0}, {0x2F8F4, 8781, 1, 0}, {0x2F8F5, 8782, 1, 0}, {0x2F8F6, 8783, 1, 0},
+    {0x2F8F7, 8784, 1, 0}, {0x2F8F8, 8785, 1, 0}, {0x2F8F9, 8786, 1, 0}, {0x2F8FA, 8787, 1, 0},
+    {0x2F8FB, 8788, 1, 0}, {0x2F8FC, 8789, 1, 0}, {0x2F8FD, 8790, 1, 0}, {0x2F8FE, 8791, 1, 0},
+    {0x2F8FF, 8792, 1, 0}, {0x2F900, 8793, 1, 0}, {0x2F901, 8794, 1, 0}, {0x2F902, 8795, 1, 0},
+    {0x2F903, 8796, 1, 0}, {0x2F904, 8797, 1, 0}, {0x2F905, 8798, 1, 0}, {0x2F906, 8799, 1, 0},
+    {0x2F907, 8800, 1, 0}, {0x2F908, 8801, 1, 0}, {0x2F909, 8802, 1, 0}, {0x2F90A, 8803, 1, 0},
+    {0x2F90B, 8804, 1, 0}, {0x2F90C, 8805, 1, 0}, {0x2F90D, 8806, 1, 0}, {0x2F90E, 8807, 1, 0},
+    {0x2F90F, 8808, 1, 0}, {0x2F910, 8809, 1, 0}, {0x2F911, 8810, 1, 0}, {0x2F912, 8811, 1, 0},
+    {0x2F913, 8812, 1, 0}, {0x2F914, 8813, 1, 0}, {0x2F915, 8814, 1, 0}, {0x2F916, 8815, 1, 0},
+    {0x2F917, 8816, 1, 0}, {0x2F918, 8817, 1, 0}, {0x2F919, 8818, 1, 0}, {0x2F91A, 8819, 1, 0},
+    {0x2F91B, 8820, 1, 0}, {0x2F91C, 8821, 1, 0}, {0x2F91D, 8822, 1, 0}, {0x2F91E, 8823, 1, 0},
+    {0x2F91F, 8824, 1, 0}, {0x2F920, 8825, 1, 0}, {0x2F921, 8826, 1, 0}, {0x2F922, 8827, 1, 0},
+    {0x2F923, 8828, 1, 0}, {0x2F924, 8829, 1, 0}, {0x2F925, 8830, 1, 0}, {0x2F926, 8831, 1, 0},
+    {0x2F927, 8832, 1, 0}, {0x2F928, 8833, 1, 0}, {0x2F929, 8834, 1, 0}, {0x2F92A, 8835, 1, 0},
+    {0x2F92B, 8836, 1, 0}, {0x2F92C, 8837, 1, 0}, {0x2F92D, 8838, 1, 0}, {0x2F92E, 8839, 1, 0},
+    {0x2F92F, 8840, 1, 0}, {0x2F930, 8841, 1, 0}, {0x2F931, 8842, 1, 0}, {0x2F932, 8843, 1, 0},
+    {0x2F933, 8844, 1, 0}, {0x2F934, 8845, 1, 0}, {0x2F935, 8846, 1, 0}, {0x2F936, 8847, 1, 0},
+    {0x2F937, 8848, 1, 0}, {0x2F938, 8849, 1, 0}, {0x2F939, 8850, 1, 0}, {0x2F93A, 8851, 1, 0},
+    {0x2F93B, 8852, 1, 0}, {0x2F93C, 8853, 1, 0}, {0x2F93D, 8854, 1, 0}, {0x2F93E, 8855, 1, 0},
+    {0x2F93F, 8856, 1, 0}, {0x2F940, 8857, 1, 0}, {0x2F941, 8858, 1, 0}, {0x2F942, 8859, 1, 0},
+    {0x2F943, 8860, 1, 0}, {0x2F944, 8861, 1, 0}, {0x2F945, 8862, 1, 0}, {0x2F946, 8863, 1, 0},
+    {0x2F947, 8864, 1, 0}, {0x2F948, 8865, 1, 0}, {0x2F949, 8866, 1, 0}, {0x2F94A, 8867, 1, 0},
+    {0x2F94B, 8868, 1, 0}, {0x2F94C, 8869, 1, 0}, {0x2F94D, 8870, 1, 0}, {0x2F94E, 8871, 1, 0},
+    {0x2F94F, 8872, 1, 0}, {0x2F950, 8873, 1, 0}, {0x2F951, 8874, 1, 0}, {0x2F952, 8875, 1, 0},
+    {0x2F953, 8876, 1, 0}, {0x2F954, 8877, 1, 0}, {0x2F955, 8878, 1, 0}, {0x2F956, 8879, 1, 0},
+    {0x2F957, 8880, 1, 0}, {0x2F958, 8881, 1, 0}, {0x2F959, 8882, 1, 0}, {0x2F95A, 8883, 1, 0},
+    {0x2F95B, 8884, 1, 0}, {0x2F95C, 8885, 1, 0}, {0x2F95D, 8886, 1, 0}, {0x2F95E, 8887, 1, 0},
+    {0x2F95F, 8888, 1, 0}, {0x2F960, 8889, 1, 0}, {0x2F961, 8890, 1, 0}, {0x2F962, 8891, 1, 0},
+    {0x2F963, 8892, 1, 0}, {0x2F964, 8893, 1, 0}, {0x2F965, 8894, 1, 0}, {0x2F966, 8895, 1, 0},
+    {0x2F967, 8896, 1, 0}, {0x2F968, 8897, 1, 0}, {0x2F969, 8898, 1, 0}, {0x2F96A, 8899, 1, 0},
+    {0x2F96B, 8900, 1, 0}, {0x2F96C, 8901, 1, 0}, {0x2F96D, 8902, 1, 0}, {0x2F96E, 8903, 1, 0},
+    {0x2F96F, 8904, 1, 0}, {0x2F970, 8905, 1, 0}, {0x2F971, 8906, 1, 0}, {0x2F972, 8907, 1, 0},
+    {0x2F973, 8908, 1, 0}, {0x2F974, 8909, 1, 0}, {0x2F975, 8910, 1, 0}, {0x2F976, 8911, 1, 0},
+    {0x2F977, 8912, 1, 0}, {0x2F978, 8913, 1, 0}, {0x2F979, 8914, 1, 0}, {0x2F97A, 8915, 1, 0},
+    {0x2F97B, 8916, 1, 0}, {0x2F97C, 8917, 1, 0}, {0x2F97D, 8918, 1, 0}, {0x2F97E, 8919, 1, 0},
+    {0x2F97F, 8920, 1, 0}, {0x2F980, 8921, 1, 0}, {0x2F981, 8922, 1, 0}, {0x2F982, 8923, 1, 0},
+    {0x2F983, 8924, 1, 0}, {0x2F984, 8925, 1, 0}, {0x2F985, 8926, 1, 0}, {0x2F986, 8927, 1, 0},
+    {0x2F987, 8928, 1, 0}, {0x2F988, 8929, 1, 0}, {0x2F989, 8930, 1, 0}, {0x2F98A, 8931, 1, 0},
+    {0x2F98B, 8932, 1, 0}, {0x2F98C, 8933, 1, 0}, {0x2F98D, 8934, 1, 0}, {0x2F98E, 8935, 1, 0},
+    {0x2F98F, 8936, 1, 0}, {0x2F990, 8937, 1, 0}, {0x2F991, 8938, 1, 0}, {0x2F992, 8939, 1, 0},
+    {0x2F993, 8940, 1, 0}, {0x2F994, 8941, 1, 0}, {0x2F995, 8942, 1, 0}, {0x2F996, 8943, 1, 0},
+    {0x2F997, 8944, 1, 0}, {0x2F998, 8945, 1, 0}, {0x2F999, 8946, 1, 0}, {0x2F99A, 8947, 1, 0},
+    {0x2F99B, 8948, 1, 0}, {0x2F99C, 8949, 1, 0}, {0x2F99D, 8950, 1, 0}, {0x2F99E, 8951, 1, 0},
+    {0x2F99F, 8952, 1, 0}, {0x2F9A0, 8953, 1, 0}, {0x2F9A1, 8954, 1, 0}, {0x2F9A2, 8955, 1, 0},
+    {0x2F9A3, 8956, 1, 0}, {0x2F9A4, 8957, 1, 0}, {0x2F9A5, 8958, 1, 0}, {0x2F9A6, 8959, 1, 0},
+    {0x2F9A7, 8960, 1, 0}, {0x2F9A8, 8961, 1, 0}, {0x2F9A9, 8962, 1, 0}, {0x2F9AA, 8963, 1, 0},
+    {0x2F9AB, 8964, 1, 0}, {0x2F9AC, 8965, 1, 0}, {0x2F9AD, 8966, 1, 0}, {0x2F9AE, 8967, 1, 0},
+    {0x2F9AF, 8968, 1, 0}, {0x2F9B0, 8969, 1, 0}, {0x2F9B1, 8970, 1, 0}, {0x2F9B2, 8971, 1, 0},
+    {0x2F9B3, 8972, 1, 0}, {0x2F9B4, 8973, 1, 0}, {0x2F9B5, 8974, 1, 0}, {0x2F9B6, 8975, 1, 0},
+    {0x2F9B7, 8976, 1, 0}, {0x2F9B8, 8977, 1, 0}, {0x2F9B9, 8978, 1, 0}, {0x2F9BA, 8979, 1, 0},
+    {0x2F9BB, 8980, 1, 0}, {0x2F9BC, 8981, 1, 0}, {0x2F9BD, 8982, 1, 0}, {0x2F9BE, 8983, 1, 0},
+    {0x2F9BF, 8984, 1, 0}, {0x2F9C0, 8985, 1, 0}, {0x2F9C1, 8986, 1, 0}, {0x2F9C2, 8987, 1, 0},
+    {0x2F9C3, 8988, 1, 0}, {0x2F9C4, 8989, 1, 0}, {0x2F9C5, 8990, 1, 0}, {0x2F9C6, 8991, 1, 0},
+    {0x2F9C7, 8992, 1, 0}, {0x2F9C8, 8993, 1, 0}, {0x2F9C9, 8994, 1, 0}, {0x2F9CA, 8995, 1, 0},
+    {0x2F9CB, 8996, 1, 0}, {0x2F9CC, 8997, 1, 0}, {0x2F9CD, 8998, 1, 0}, {0x2F9CE, 8999, 1, 0},
+    {0x2F9CF, 9000, 1, 0}, {0x2F9D0, 9001, 1, 0}, {0x2F9D1, 9002, 1, 0}, {0x2F9D2, 9003, 1, 0},
+    {0x2F9D3, 9004, 1, 0}, {0x2F9D4, 9005, 1, 0}, {0x2F9D5, 9006, 1, 0}, {0x2F9D6, 9007, 1, 0},
+    {0x2F9D7, 9008, 1, 0}, {0x2F9D8, 9009, 1, 0}, {0x2F9D9, 9010, 1, 0}, {0x2F9DA, 9011, 1, 0},
+    {0x2F9DB, 9012, 1, 0}, {0x2F9DC, 9013, 1, 0}, {0x2F9DD, 9014, 1, 0}, {0x2F9DE, 9015, 1, 0},
+    {0x2F9DF, 9016, 1, 0}, {0x2F9E0, 9017, 1, 0}, {0x2F9E1, 9018, 1, 0}, {0x2F9E2, 9019, 1, 0},
+    {0x2F9E3, 9020, 1, 0}, {0x2F9E4, 9021, 1, 0}, {0x2F9E5, 9022, 1, 0}, {0x2F9E6, 9023, 1, 0},
+    {0x2F9E7, 9024, 1, 0}, {0x2F9E8, 9025, 1, 0}, {0x2F9E9, 9026, 1, 0}, {0x2F9EA, 9027, 1, 0},
+    {0x2F9EB, 9028, 1, 0}, {0x2F9EC, 9029, 1, 0}, {0x2F9ED, 9030, 1, 0}, {0x2F9EE, 9031, 1, 0},
+    {0x2F9EF, 9032, 1, 0}, {0x2F9F0, 9033, 1, 0}, {0x2F9F1, 9034, 1, 0}, {0x2F9F2, 9035, 1, 0},
+    {0x2F9F3, 9036, 1, 0}, {0x2F9F4, 9037, 1, 0}, {0x2F9F5, 9038, 1, 0}, {0x2F9F6, 9039, 1, 0},
+    {0x2F9F7, 9040, 1, 0}, {0x2F9F8, 9041, 1, 0}, {0x2F9F9, 9042, 1, 0}, {0x2F9FA, 9043, 1, 0},
+    {0x2F9FB, 9044, 1, 0}, {0x2F9FC, 9045, 1, 0}, {0x2F9FD, 9046, 1, 0}, {0x2F9FE, 9047, 1, 0},
+    {0x2F9FF, 9048, 1, 0}, {0x2FA00, 9049, 1, 0}, {0x2FA01, 9050, 1, 0}, {0x2FA02, 9051, 1, 0},
+    {0x2FA03, 9052, 1, 0}, {0x2FA04, 9053, 1, 0}, {0x2FA05, 9054, 1, 0}, {0x2FA06, 9055, 1, 0},
+    {0x2FA07, 9056, 1, 0}, {0x2FA08, 9057, 1, 0}, {0x2FA09, 9058, 1, 0}, {0x2FA0A, 9059, 1, 0},
+    {0x2FA0B, 9060, 1, 0}, {0x2FA0C, 9061, 1, 0}, {0x2FA0D, 9062, 1, 0}, {0x2FA0E, 9063, 1, 0},
+    {0x2FA0F, 9064, 1, 0}, {0x2FA10, 9065, 1, 0}, {0x2FA11, 9066, 1, 0}, {0x2FA12, 9067, 1, 0},
+    {0x2FA13, 9068, 1, 0}, {0x2FA14, 9069, 1, 0}, {0x2FA15, 9070, 1, 0}, {0x2FA16, 9071, 1, 0},
+    {0x2FA17, 9072, 1, 0}, {0x2FA18, 9073, 1, 0}, {0x2FA19, 9074, 1, 0}, {0x2FA1A, 9075, 1, 0},
+    {0x2FA1B, 9076, 1, 0}, {0x2FA1C, 9077, 1, 0}, {0x2FA1D, 9078, 1, 0},
+};
+
+static const unsigned int utf8_decomp_pool[] = {
+    0x20, 0x20, 0x308, 0x61, 0x20, 0x304, 0x32, 0x33, 0x20, 0x301, 0x3BC, 0x20, 0x327, 0x31, 0x6F, 0x31,
+    0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34, 0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41,
+    0x303, 0x41, 0x308, 0x41, 0x30A, 0x43, 0x327, 0x45, 0x300, 0x45, 0x301, 0x45, 0x302, 0x45, 0x308,
+    0x49, 0x300, 0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4E, 0x303, 0x4F, 0x300, 0x4F, 0x301, 0x4F,
+    0x302, 0x4F, 0x303, 0x4F, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302, 0x55, 0x308, 0x59, 0x301,
+    0x61, 0x300, 0x61, 0x301, 0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A, 0x63, 0x327, 0x65,
+    0x300, 0x65, 0x301, 0x65, 0x302, 0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302, 0x69, 0x308,
+    0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301, 0x6F, 0x302, 0x6F, 0x303, 0x6F, 0x308, 0x75, 0x300, 0x75,
+    0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301, 0x79, 0x308, 0x41, 0x304, 0x61, 0x304, 0x41, 0x306,
+    0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301, 0x63, 0x301, 0x43, 0x302, 0x63, 0x302, 0x43,
+    0x307, 0x63, 0x307, 0x43, 0x30C, 0x63, 0x30C, 0x44, 0x30C, 0x64, 0x30C, 0x45, 0x304, 0x65, 0x304,
+    0x45, 0x306, 0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328, 0x65, 0x328, 0x45, 0x30C, 0x65,
+    0x30C, 0x47, 0x302, 0x67, 0x302, 0x47, 0x306, 0x67, 0x306, 0x47, 0x307, 0x67, 0x307, 0x47, 0x327,
+    0x67, 0x327, 0x48, 0x302, 0x68, 0x302, 0x49, 0x303, 0x69, 0x303, 0x49, 0x304, 0x69, 0x304, 0x49,
+    0x306, 0x69, 0x306, 0x49, 0x328, 0x69, 0x328, 0x49, 0x307, 0x49, 0x4A, 0x69, 0x6A, 0x4A, 0x302,
+    0x6A, 0x302, 0x4B, 0x327, 0x6B, 0x327, 0x4C, 0x301, 0x6C, 0x301, 0x4C, 0x327, 0x6C, 0x327, 0x4C,
+    0x30C, 0x6C, 0x30C, 0x4C, 0xB7, 0x6C, 0xB7, 0x4E, 0x301, 0x6E, 0x301, 0x4E, 0x327, 0x6E, 0x327,
+    0x4E, 0x30C, 0x6E, 0x30C, 0x2BC, 0x6E, 0x4F, 0x304, 0x6F, 0x304, 0x4F, 0x306, 0x6F, 0x306, 0x4F,
+    0x30B, 0x6F, 0x30B, 0x52, 0x301, 0x72, 0x301, 0x52, 0x327, 0x72, 0x327, 0x52, 0x30C, 0x72, 0x30C,
+    0x53, 0x301, 0x73, 0x301, 0x53, 0x302, 0x73, 0x302, 0x53, 0x327, 0x73, 0x327, 0x53, 0x30C, 0x73,
+    0x30C, 0x54, 0x327, 0x74, 0x327, 0x54, 0x30C, 0x74, 0x30C, 0x55, 0x303, 0x75, 0x303, 0x55, 0x304,
+    0x75, 0x304, 0x55, 0x306, 0x75, 0x306, 0x55, 0x30A, 0x75, 0x30A, 0x55, 0x30B, 0x75, 0x30B, 0x55,
+    0x328, 0x75, 0x328, 0x57, 0x302, 0x77, 0x302, 0x59, 0x302, 0x79, 0x302, 0x59, 0x308, 0x5A, 0x301,
+    0x7A, 0x301, 0x5A, 0x307, 0x7A, 0x307, 0x5A, 0x30C, 0x7A, 0x30C, 0x73, 0x4F, 0x31B, 0x6F, 0x31B,
+    0x55, 0x31B, 0x75, 0x31B, 0x44, 0x5A, 0x30C, 0x44, 0x7A, 0x30C, 0x64, 0x7A, 0x30C, 0x4C, 0x4A, 0x4C,
+    0x6A, 0x6C, 0x6A, 0x4E, 0x4A, 0x4E, 0x6A, 0x6E, 0x6A, 0x41, 0x30C, 0x61, 0x30C, 0x49, 0x30C, 0x69,
+    0x30C, 0x4F, 0x30C, 0x6F, 0x30C, 0x55, 0x30C, 0x75, 0x30C, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+    0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55, 0x308, 0x30C, 0x75, 0x308, 0x30C, 0x55, 0x308, 0x300,
+    0x75, 0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304, 0x41, 0x307, 0x304, 0x61, 0x307, 0x304,
+    0xC6, 0x304, 0xE6, 0x304, 0x47, 0x30C, 0x67, 0x30C, 0x4B, 0x30C, 0x6B, 0x30C, 0x4F, 0x328, 0x6F,
+    0x328, 0x4F, 0x328, 0x304, 0x6F, 0x328, 0x304, 0x1B7, 0x30C, 0x292, 0x30C, 0x6A, 0x30C, 0x44, 0x5A,
+    0x44, 0x7A, 0x64, 0x7A, 0x47, 0x301, 0x67, 0x301, 0x4E, 0x300, 0x6E, 0x300, 0x41, 0x30A, 0x301,
+    0x61, 0x30A, 0x301, 0xC6, 0x301, 0xE6, 0x301, 0xD8, 0x301, 0xF8, 0x301, 0x41, 0x30F, 0x61, 0x30F,
+    0x41, 0x311, 0x61, 0x311, 0x45, 0x30F, 0x65, 0x30F, 0x45, 0x311, 0x65, 0x311, 0x49, 0x30F, 0x69,
+    0x30F, 0x49, 0x311, 0x69, 0x311, 0x4F, 0x30F, 0x6F, 0x30F, 0x4F, 0x311, 0x6F, 0x311, 0x52, 0x30F,
+    0x72, 0x30F, 0x52, 0x311, 0x72, 0x311, 0x55, 0x30F, 0x75, 0x30F, 0x55, 0x311, 0x75, 0x311, 0x53,
+    0x326, 0x73, 0x326, 0x54, 0x326, 0x74, 0x326, 0x48, 0x30C, 0x68, 0x30C, 0x41, 0x307, 0x61, 0x307,
+    0x45, 0x327, 0x65, 0x327, 0x4F, 0x308, 0x304, 0x6F, 0x308, 0x304, 0x4F, 0x303, 0x304, 0x6F, 0x303,
+    0x304, 0x4F, 0x307, 0x6F, 0x307, 0x4F, 0x307, 0x304, 0x6F, 0x307, 0x304, 0x59, 0x304, 0x79, 0x304,
+    0x68, 0x266, 0x6A, 0x72, 0x279, 0x27B, 0x281, 0x77, 0x79, 0x20, 0x306, 0x20, 0x307, 0x20, 0x30A,
+    0x20, 0x328, 0x20, 0x303, 0x20, 0x30B, 0x263, 0x6C, 0x73, 0x78, 0x295, 0x300, 0x301, 0x313, 0x308,
+    0x301, 0x2B9, 0x20, 0x345, 0x3B, 0x20, 0x301, 0xA8, 0x301, 0x20, 0x308, 0x301, 0x391, 0x301, 0xB7,
+    0x395, 0x301, 0x397, 0x301, 0x399, 0x301, 0x39F, 0x301, 0x3A5, 0x301, 0x3A9, 0x301, 0x3B9, 0x308,
+    0x301, 0x399, 0x308, 0x3A5, 0x308, 0x3B1, 0x301, 0x3B5, 0x301, 0x3B7, 0x301, 0x3B9, 0x301, 0x3C5,
+    0x308, 0x301, 0x3B9, 0x308, 0x3C5, 0x308, 0x3BF, 0x301, 0x3C5, 0x301, 0x3C9, 0x301, 0x3B2, 0x3B8,
+    0x3A5, 0x3D2, 0x301, 0x3A5, 0x301, 0x3D2, 0x308, 0x3A5, 0x308, 0x3C6, 0x3C0, 0x3BA, 0x3C1, 0x3C2,
+    0x398, 0x3B5, 0x3A3, 0x415, 0x300, 0x415, 0x308, 0x413, 0x301, 0x406, 0x308, 0x41A, 0x301, 0x418,
+    0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306, 0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456,
+    0x308, 0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30F, 0x475, 0x30F, 0x416, 0x306, 0x436,
+    0x306, 0x410, 0x306, 0x430, 0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306, 0x435, 0x306, 0x4D8,
+    0x308, 0x4D9, 0x308, 0x416, 0x308, 0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304, 0x438,
+    0x304, 0x418, 0x308, 0x438, 0x308, 0x41E, 0x308, 0x43E, 0x308, 0x4E8, 0x308, 0x4E9, 0x308, 0x42D,
+    0x308, 0x44D, 0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308, 0x443, 0x308, 0x423, 0x30B, 0x443,
+    0x30B, 0x427, 0x308, 0x447, 0x308, 0x42B, 0x308, 0x44B, 0x308, 0x565, 0x582, 0x627, 0x653, 0x627,
+    0x654, 0x648, 0x654, 0x627, 0x655, 0x64A, 0x654, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A,
+    0x674, 0x6D5, 0x654, 0x6C1, 0x654, 0x6D2, 0x654, 0x928, 0x93C, 0x930, 0x93C, 0x933, 0x93C, 0x915,
+    0x93C, 0x916, 0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F,
+    0x93C, 0x9C7, 0x9BE, 0x9C7, 0x9D7, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38,
+    0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB47, 0xB56, 0xB47, 0xB3E, 0xB47,
+    0xB57, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92, 0xBD7, 0xBC6, 0xBBE, 0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46,
+    0xC56, 0xCBF, 0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6, 0xCC2, 0xCD5, 0xD46, 0xD3E,
+    0xD47, 0xD3E, 0xD46, 0xD57, 0xDD9, 0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA, 0xDD9, 0xDDF, 0xE4D,
+    0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99, 0xEAB, 0xEA1, 0xF0B, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7,
+    0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71, 0xF74, 0xFB2, 0xF80, 0xFB2, 0xF71,
+    0xF80, 0xFB3, 0xF80, 0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7,
+    0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+    0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35,
+    0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x41, 0xC6, 0x42, 0x44, 0x45, 0x18E, 0x47, 0x48,
+    0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x222, 0x50, 0x52, 0x54, 0x55, 0x57, 0x61, 0x250, 0x251,
+    0x1D02, 0x62, 0x64, 0x65, 0x259, 0x25B, 0x25C, 0x67, 0x6B, 0x6D, 0x14B, 0x6F, 0x254, 0x1D16, 0x1D17,
+    0x70, 0x74, 0x75, 0x1D1D, 0x26F, 0x76, 0x1D25, 0x3B2, 0x3B3, 0x3B4, 0x3C6, 0x3C7, 0x69, 0x72, 0x75,
+    0x76, 0x3B2, 0x3B3, 0x3C1, 0x3C6, 0x3C7, 0x43D, 0x252, 0x63, 0x255, 0xF0, 0x25C, 0x66, 0x25F, 0x261,
+    0x265, 0x268, 0x269, 0x26A, 0x1D7B, 0x29D, 0x26D, 0x1D85, 0x29F, 0x271, 0x270, 0x272, 0x273, 0x274,
+    0x275, 0x278, 0x282, 0x283, 0x1AB, 0x289, 0x28A, 0x1D1C, 0x28B, 0x28C, 0x7A, 0x290, 0x291, 0x292,
+    0x3B8, 0x41, 0x325, 0x61, 0x325, 0x42, 0x307, 0x62, 0x307, 0x42, 0x323, 0x62, 0x323, 0x42, 0x331,
+    0x62, 0x331, 0x43, 0x327, 0x301, 0x63, 0x327, 0x301, 0x44, 0x307, 0x64, 0x307, 0x44, 0x323, 0x64,
+    0x323, 0x44, 0x331, 0x64, 0x331, 0x44, 0x327, 0x64, 0x327, 0x44, 0x32D, 0x64, 0x32D, 0x45, 0x304,
+    0x300, 0x65, 0x304, 0x300, 0x45, 0x304, 0x301, 0x65, 0x304, 0x301, 0x45, 0x32D, 0x65, 0x32D, 0x45,
+    0x330, 0x65, 0x330, 0x45, 0x327, 0x306, 0x65, 0x327, 0x306, 0x46, 0x307, 0x66, 0x307, 0x47, 0x304,
+    0x67, 0x304, 0x48, 0x307, 0x68, 0x307, 0x48, 0x323, 0x68, 0x323, 0x48, 0x308, 0x68, 0x308, 0x48,
+    0x327, 0x68, 0x327, 0x48, 0x32E, 0x68, 0x32E, 0x49, 0x330, 0x69, 0x330, 0x49, 0x308, 0x301, 0x69,
+    0x308, 0x301, 0x4B, 0x301, 0x6B, 0x301, 0x4B, 0x323, 0x6B, 0x323, 0x4B, 0x331, 0x6B, 0x331, 0x4C,
+    0x323, 0x6C, 0x323, 0x4C, 0x323, 0x304, 0x6C, 0x323, 0x304, 0x4C, 0x331, 0x6C, 0x331, 0x4C, 0x32D,
+    0x6C, 0x32D, 0x4D, 0x301, 0x6D, 0x301, 0x4D, 0x307, 0x6D, 0x307, 0x4D, 0x323, 0x6D, 0x323, 0x4E,
+    0x307, 0x6E, 0x307, 0x4E, 0x323, 0x6E, 0x323, 0x4E, 0x331, 0x6E, 0x331, 0x4E, 0x32D, 0x6E, 0x32D,
+    0x4F, 0x303, 0x301, 0x6F, 0x303, 0x301, 0x4F, 0x303, 0x308, 0x6F, 0x303, 0x308, 0x4F, 0x304, 0x300,
+    0x6F, 0x304, 0x300, 0x4F, 0x304, 0x301, 0x6F, 0x304, 0x301, 0x50, 0x301, 0x70, 0x301, 0x50, 0x307,
+    0x70, 0x307, 0x52, 0x307, 0x72, 0x307, 0x52, 0x323, 0x72, 0x323, 0x52, 0x323, 0x304, 0x72, 0x323,
+    0x304, 0x52, 0x331, 0x72, 0x331, 0x53, 0x307, 0x73, 0x307, 0x53, 0x323, 0x73, 0x323, 0x53, 0x301,
+    0x307, 0x73, 0x301, 0x307, 0x53, 0x30C, 0x307, 0x73, 0x30C, 0x307, 0x53, 0x323, 0x307, 0x73, 0x323,
+    0x307, 0x54, 0x307, 0x74, 0x307, 0x54, 0x323, 0x74, 0x323, 0x54, 0x331, 0x74, 0x331, 0x54, 0x32D,
+    0x74, 0x32D, 0x55, 0x324, 0x75, 0x324, 0x55, 0x330, 0x75, 0x330, 0x55, 0x32D, 0x75, 0x32D, 0x55,
+    0x303, 0x301, 0x75, 0x303, 0x301, 0x55, 0x304, 0x308, 0x75, 0x304, 0x308, 0x56, 0x303, 0x76, 0x303,
+    0x56, 0x323, 0x76, 0x323, 0x57, 0x300, 0x77, 0x300, 0x57, 0x301, 0x77, 0x301, 0x57, 0x308, 0x77,
+    0x308, 0x57, 0x307, 0x77, 0x307, 0x57, 0x323, 0x77, 0x323, 0x58, 0x307, 0x78, 0x307, 0x58, 0x308,
+    0x78, 0x308, 0x59, 0x307, 0x79, 0x307, 0x5A, 0x302, 0x7A, 0x302, 0x5A, 0x323, 0x7A, 0x323, 0x5A,
+    0x331, 0x7A, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A, 0x61, 0x2BE, 0x17F, 0x307,
+    0x73, 0x307, 0x41, 0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309, 0x41, 0x302, 0x301, 0x61, 0x302,
+    0x301, 0x41, 0x302, 0x300, 0x61, 0x302, 0x300, 0x41, 0x302, 0x309, 0x61, 0x302, 0x309, 0x41, 0x302,
+    0x303, 0x61, 0x302, 0x303, 0x41, 0x323, 0x302, 0x61, 0x323, 0x302, 0x41, 0x306, 0x301, 0x61, 0x306,
+    0x301, 0x41, 0x306, 0x300, 0x61, 0x306, 0x300, 0x41, 0x306, 0x309, 0x61, 0x306, 0x309, 0x41, 0x306,
+    0x303, 0x61, 0x306, 0x303, 0x41, 0x323, 0x306, 0x61, 0x323, 0x306, 0x45, 0x323, 0x65, 0x323, 0x45,
+    0x309, 0x65, 0x309, 0x45, 0x303, 0x65, 0x303, 0x45, 0x302, 0x301, 0x65, 0x302, 0x301, 0x45, 0x302,
+    0x300, 0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65, 0x302, 0x309, 0x45, 0x302, 0x303, 0x65, 0x302,
+    0x303, 0x45, 0x323, 0x302, 0x65, 0x323, 0x302, 0x49, 0x309, 0x69, 0x309, 0x49, 0x323, 0x69, 0x323,
+    0x4F, 0x323, 0x6F, 0x323, 0x4F, 0x309, 0x6F, 0x309, 0x4F, 0x302, 0x301, 0x6F, 0x302, 0x301, 0x4F,
+    0x302, 0x300, 0x6F, 0x302, 0x300, 0x4F, 0x302, 0x309, 0x6F, 0x302, 0x309, 0x4F, 0x302, 0x303, 0x6F,
+    0x302, 0x303, 0x4F, 0x323, 0x302, 0x6F, 0x323, 0x302, 0x4F, 0x31B, 0x301, 0x6F, 0x31B, 0x301, 0x4F,
+    0x31B, 0x300, 0x6F, 0x31B, 0x300, 0x4F, 0x31B, 0x309, 0x6F, 0x31B, 0x309, 0x4F, 0x31B, 0x303, 0x6F,
+    0x31B, 0x303, 0x4F, 0x31B, 0x323, 0x6F, 0x31B, 0x323, 0x55, 0x323, 0x75, 0x323, 0x55, 0x309, 0x75,
+    0x309, 0x55, 0x31B, 0x301, 0x75, 0x31B, 0x301, 0x55, 0x31B, 0x300, 0x75, 0x31B, 0x300, 0x55, 0x31B,
+    0x309, 0x75, 0x31B, 0x309, 0x55, 0x31B, 0x303, 0x75, 0x31B, 0x303, 0x55, 0x31B, 0x323, 0x75, 0x31B,
+    0x323, 0x59, 0x300, 0x79, 0x300, 0x59, 0x323, 0x79, 0x323, 0x59, 0x309, 0x79, 0x309, 0x59, 0x303,
+    0x79, 0x303, 0x3B1, 0x313, 0x3B1, 0x314, 0x3B1, 0x313, 0x300, 0x3B1, 0x314, 0x300, 0x3B1, 0x313,
+    0x301, 0x3B1, 0x314, 0x301, 0x3B1, 0x313, 0x342, 0x3B1, 0x314, 0x342, 0x391, 0x313, 0x391, 0x314,
+    0x391, 0x313, 0x300, 0x391, 0x314, 0x300, 0x391, 0x313, 0x301, 0x391, 0x314, 0x301, 0x391, 0x313,
+    0x342, 0x391, 0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314, 0x3B5, 0x313, 0x300, 0x3B5, 0x314, 0x300,
+    0x3B5, 0x313, 0x301, 0x3B5, 0x314, 0x301, 0x395, 0x313, 0x395, 0x314, 0x395, 0x313, 0x300, 0x395,
+    0x314, 0x300, 0x395, 0x313, 0x301, 0x395, 0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313,
+    0x300, 0x3B7, 0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7, 0x314, 0x301, 0x3B7, 0x313, 0x342, 0x3B7,
+    0x314, 0x342, 0x397, 0x313, 0x397, 0x314, 0x397, 0x313, 0x300, 0x397, 0x314, 0x300, 0x397, 0x313,
+    0x301, 0x397, 0x314, 0x301, 0x397, 0x313, 0x342, 0x397, 0x314, 0x342, 0x3B9, 0x313, 0x3B9, 0x314,
+    0x3B9, 0x313, 0x300, 0x3B9, 0x314, 0x300, 0x3B9, 0x313, 0x301, 0x3B9, 0x314, 0x301, 0x3B9, 0x313,
+    0x342, 0x3B9, 0x314, 0x342, 0x399, 0x313, 0x399, 0x314, 0x399, 0x313, 0x300, 0x399, 0x314, 0x300,
+    0x399, 0x313, 0x301, 0x399, 0x314, 0x301, 0x399, 0x313, 0x342, 0x399, 0x314, 0x342, 0x3BF, 0x313,
+    0x3BF, 0x314, 0x3BF, 0x313, 0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF, 0x314, 0x301,
+    0x39F, 0x313, 0x39F, 0x314, 0x39F, 0x313, 0x300, 0x39F, 0x314, 0x300, 0x39F, 0x313, 0x301, 0x39F,
+    0x314, 0x301, 0x3C5, 0x313, 0x3C5, 0x314, 0x3C5, 0x313, 0x300, 0x3C5, 0x314, 0x300, 0x3C5, 0x313,
+    0x301, 0x3C5, 0x314, 0x301, 0x3C5, 0x313, 0x342, 0x3C5, 0x314, 0x342, 0x3A5, 0x314, 0x3A5, 0x314,
+    0x300, 0x3A5, 0x314, 0x301, 0x3A5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9, 0x313, 0x300,
+    0x3C9, 0x314, 0x300, 0x3C9, 0x313, 0x301, 0x3C9, 0x314, 0x301, 0x3C9, 0x313, 0x342, 0x3C9, 0x314,
+    0x342, 0x3A9, 0x313, 0x3A9, 0x314, 0x3A9, 0x313, 0x300, 0x3A9, 0x314, 0x300, 0x3A9, 0x313, 0x301,
+    0x3A9, 0x314, 0x301, 0x3A9, 0x313, 0x342, 0x3A9, 0x314, 0x342, 0x3B1, 0x300, 0x3B1, 0x301, 0x3B5,
+    0x300, 0x3B5, 0x301, 0x3B7, 0x300, 0x3B7, 0x301, 0x3B9, 0x300, 0x3B9, 0x301, 0x3BF, 0x300, 0x3BF,
+    0x301, 0x3C5, 0x300, 0x3C5, 0x301, 0x3C9, 0x300, 0x3C9, 0x301, 0x3B1, 0x313, 0x345, 0x3B1, 0x314,
+    0x345, 0x3B1, 0x313, 0x300, 0x345, 0x3B1, 0x314, 0x300, 0x345, 0x3B1, 0x313, 0x301, 0x345, 0x3B1,
+    0x314, 0x301, 0x345, 0x3B1, 0x313, 0x342, 0x345, 0x3B1, 0x314, 0x342, 0x345, 0x391, 0x313, 0x345,
+    0x391, 0x314, 0x345, 0x391, 0x313, 0x300, 0x345, 0x391, 0x314, 0x300, 0x345, 0x391, 0x313, 0x301,
+    0x345, 0x391, 0x314, 0x301, 0x345, 0x391, 0x313, 0x342, 0x345, 0x391, 0x314, 0x342, 0x345, 0x3B7,
+    0x313, 0x345, 0x3B7, 0x314, 0x345, 0x3B7, 0x313, 0x300, 0x345, 0x3B7, 0x314, 0x300, 0x345, 0x3B7,
+    0x313, 0x301, 0x345, 0x3B7, 0x314, 0x301, 0x345, 0x3B7, 0x313, 0x342, 0x345, 0x3B7, 0x314, 0x342,
+    0x345, 0x397, 0x313, 0x345, 0x397, 0x314, 0x345, 0x397, 0x313, 0x300, 0x345, 0x397, 0x314, 0x300,
+    0x345, 0x397, 0x313, 0x301, 0x345, 0x397, 0x314, 0x301, 0x345, 0x397, 0x313, 0x342, 0x345, 0x397,
+    0x314, 0x342, 0x345, 0x3C9, 0x313, 0x345, 0x3C9, 0x314, 0x345, 0x3C9, 0x313, 0x300, 0x345, 0x3C9,
+    0x314, 0x300, 0x345, 0x3C9, 0x313, 0x301, 0x345, 0x3C9, 0x314, 0x301, 0x345, 0x3C9, 0x313, 0x342,
+    0x345, 0x3C9, 0x314, 0x342, 0x345, 0x3A9, 0x313, 0x345, 0x3A9, 0x314, 0x345, 0x3A9, 0x313, 0x300,
+    0x345, 0x3A9, 0x314, 0x300, 0x345, 0x3A9, 0x313, 0x301, 0x345, 0x3A9, 0x314, 0x301, 0x345, 0x3A9,
+    0x313, 0x342, 0x345, 0x3A9, 0x314, 0x342, 0x345, 0x3B1, 0x306, 0x3B1, 0x304, 0x3B1, 0x300, 0x345,
+    0x3B1, 0x345, 0x3B1, 0x301, 0x345, 0x3B1, 0x342, 0x3B1, 0x342, 0x345, 0x391, 0x306, 0x391, 0x304,
+    0x391, 0x300, 0x391, 0x301, 0x391, 0x345, 0x20, 0x313, 0x3B9, 0x20, 0x313, 0x20, 0x342, 0xA8, 0x342,
+    0x20, 0x308, 0x342, 0x3B7, 0x300, 0x345, 0x3B7, 0x345, 0x3B7, 0x301, 0x345, 0x3B7, 0x342, 0x3B7,
+    0x342, 0x345, 0x395, 0x300, 0x395, 0x301, 0x397, 0x300, 0x397, 0x301, 0x397, 0x345, 0x1FBF, 0x300,
+    0x20, 0x313, 0x300, 0x1FBF, 0x301, 0x20, 0x313, 0x301, 0x1FBF, 0x342, 0x20, 0x313, 0x342, 0x3B9,
+    0x306, 0x3B9, 0x304, 0x3B9, 0x308, 0x300, 0x3B9, 0x308, 0x301, 0x3B9, 0x342, 0x3B9, 0x308, 0x342,
+    0x399, 0x306, 0x399, 0x304, 0x399, 0x300, 0x399, 0x301, 0x1FFE, 0x300, 0x20, 0x314, 0x300, 0x1FFE,
+    0x301, 0x20, 0x314, 0x301, 0x1FFE, 0x342, 0x20, 0x314, 0x342, 0x3C5, 0x306, 0x3C5, 0x304, 0x3C5,
+    0x308, 0x300, 0x3C5, 0x308, 0x301, 0x3C1, 0x313, 0x3C1, 0x314, 0x3C5, 0x342, 0x3C5, 0x308, 0x342,
+    0x3A5, 0x306, 0x3A5, 0x304, 0x3A5, 0x300, 0x3A5, 0x301, 0x3A1, 0x314, 0xA8, 0x300, 0x20, 0x308,
+    0x300, 0xA8, 0x301, 0x20, 0x308, 0x301, 0x60, 0x3C9, 0x300, 0x345, 0x3C9, 0x345, 0x3C9, 0x301,
+    0x345, 0x3C9, 0x342, 0x3C9, 0x342, 0x345, 0x39F, 0x300, 0x39F, 0x301, 0x3A9, 0x300, 0x3A9, 0x301,
+    0x3A9, 0x345, 0xB4, 0x20, 0x301, 0x20, 0x314, 0x2002, 0x20, 0x2003, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2010, 0x20, 0x333, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x20, 0x2032,
+    0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035, 0x21, 0x21, 0x20, 0x305,
+    0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032, 0x2032, 0x2032, 0x20, 0x30, 0x69, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x6E, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x61, 0x65, 0x6F, 0x78, 0x259, 0x68, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x52, 0x73, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73, 0x43, 0xB0,
+    0x43, 0x63, 0x2F, 0x6F, 0x63, 0x2F, 0x75, 0x190, 0xB0, 0x46, 0x67, 0x48, 0x48, 0x48, 0x68, 0x127,
+    0x49, 0x49, 0x4C, 0x6C, 0x4E, 0x4E, 0x6F, 0x50, 0x51, 0x52, 0x52, 0x52, 0x53, 0x4D, 0x54, 0x45,
+    0x4C, 0x54, 0x4D, 0x5A, 0x3A9, 0x5A, 0x4B, 0x41, 0x30A, 0x42, 0x43, 0x65, 0x45, 0x46, 0x4D, 0x6F,
+    0x5D0, 0x5D1, 0x5D2, 0x5D3, 0x69, 0x46, 0x41, 0x58, 0x3C0, 0x3B3, 0x393, 0x3A0, 0x2211, 0x44, 0x64,
+    0x65, 0x69, 0x6A, 0x31, 0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31, 0x30, 0x31, 0x2044,
+    0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34, 0x2044,
+    0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044,
+    0x38, 0x37, 0x2044, 0x38, 0x31, 0x2044, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x56, 0x56, 0x56,
+    0x49, 0x56, 0x49, 0x49, 0x56, 0x49, 0x49, 0x49, 0x49, 0x58, 0x58, 0x58, 0x49, 0x58, 0x49, 0x49,
+    0x4C, 0x43, 0x44, 0x4D, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69, 0x76,
+    0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69, 0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6C, 0x63,
+    0x64, 0x6D, 0x30, 0x2044, 0x33, 0x2190, 0x338, 0x2192, 0x338, 0x2194, 0x338, 0x21D0, 0x338, 0x21D4,
+    0x338, 0x21D2, 0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220B, 0x338, 0x2223, 0x338, 0x2225, 0x338,
+    0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x223C, 0x338,
+    0x2243, 0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3D, 0x338, 0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338,
+    0x3E, 0x338, 0x2264, 0x338, 0x2265, 0x338, 0x2272, 0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277,
+    0x338, 0x227A, 0x338, 0x227B, 0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338,
+    0x22A2, 0x338, 0x22A8, 0x338, 0x22A9, 0x338, 0x22AB, 0x338, 0x227C, 0x338, 0x227D, 0x338, 0x2291,
+    0x338, 0x2292, 0x338, 0x22B2, 0x338, 0x22B3, 0x338, 0x22B4, 0x338, 0x22B5, 0x338, 0x3008, 0x3009,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31,
+    0x33, 0x31, 0x34, 0x31, 0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30, 0x28,
+    0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36,
+    0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31,
+    0x31, 0x29, 0x28, 0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28, 0x31,
+    0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28, 0x31,
+    0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31, 0x2E, 0x32, 0x2E, 0x33, 0x2E, 0x34, 0x2E, 0x35, 0x2E,
+    0x36, 0x2E, 0x37, 0x2E, 0x38, 0x2E, 0x39, 0x2E, 0x31, 0x30, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x32,
+    0x2E, 0x31, 0x33, 0x2E, 0x31, 0x34, 0x2E, 0x31, 0x35, 0x2E, 0x31, 0x36, 0x2E, 0x31, 0x37, 0x2E,
+    0x31, 0x38, 0x2E, 0x31, 0x39, 0x2E, 0x32, 0x30, 0x2E, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28,
+    0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68,
+    0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29,
+    0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28,
+    0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28, 0x78,
+    0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x30, 0x222B, 0x222B, 0x222B,
+    0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x2ADD, 0x338, 0x6A, 0x56, 0x2D61, 0x6BCD,
+    0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165,
+    0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338,
+    0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A,
+    0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB,
+    0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61,
+    0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0,
+    0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F,
+    0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384,
+    0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE,
+    0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73,
+    0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F, 0x8089, 0x81E3,
+    0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840,
+    0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64,
+    0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1,
+    0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769, 0x97CB, 0x97ED,
+    0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25,
+    0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1,
+    0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x20,
+    0x3012, 0x5341, 0x5344, 0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051, 0x3099,
+    0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099,
+    0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F, 0x3099,
+    0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099,
+    0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x20, 0x3099, 0x20, 0x309A, 0x309D,
+    0x3099, 0x3088, 0x308A, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3,
+    0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+    0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF,
+    0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+    0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1,
+    0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC,
+    0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106,
+    0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111,
+    0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B,
+    0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114,
+    0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D,
+    0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132,
+    0x1136, 0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188,
+    0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B,
+    0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x4EBA, 0x28, 0x1100, 0x29, 0x28, 0x1102, 0x29,
+    0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29,
+    0x28, 0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29,
+    0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28, 0x1100, 0x1161, 0x29, 0x28, 0x1102, 0x1161, 0x29,
+    0x28, 0x1103, 0x1161, 0x29, 0x28, 0x1105, 0x1161, 0x29, 0x28, 0x1106, 0x1161, 0x29, 0x28, 0x1107,
+    0x1161, 0x29, 0x28, 0x1109, 0x1161, 0x29, 0x28, 0x110B, 0x1161, 0x29, 0x28, 0x110C, 0x1161, 0x29,
+    0x28, 0x110E, 0x1161, 0x29, 0x28, 0x110F, 0x1161, 0x29, 0x28, 0x1110, 0x1161, 0x29, 0x28, 0x1111,
+    0x1161, 0x29, 0x28, 0x1112, 0x1161, 0x29, 0x28, 0x110C, 0x116E, 0x29, 0x28, 0x110B, 0x1169, 0x110C,
+    0x1165, 0x11AB, 0x29, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C,
+    0x29, 0x28, 0x4E09, 0x29, 0x28, 0x56DB, 0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03,
+    0x29, 0x28, 0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B,
+    0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F, 0x29, 0x28, 0x65E5,
+    0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29, 0x28, 0x7279,
+    0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C,
+    0x29, 0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354,
+    0x29, 0x28, 0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28, 0x81F3, 0x29, 0x554F,
+    0x5E7C, 0x6587, 0x7B8F, 0x50, 0x54, 0x45, 0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32,
+    0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33, 0x30, 0x33, 0x31, 0x33, 0x32, 0x33,
+    0x33, 0x33, 0x34, 0x33, 0x35, 0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B,
+    0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161,
+    0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B, 0x1161, 0x110C, 0x1161,
+    0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161,
+    0x11B7, 0x1100, 0x1169, 0x110C, 0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x4E00, 0x4E8C, 0x4E09,
+    0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34, 0x6728, 0x91D1,
+    0x571F, 0x65E5, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537,
+    0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A, 0x4E2D, 0x4E0B,
+    0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x33, 0x36, 0x33,
+    0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34,
+    0x35, 0x34, 0x36, 0x34, 0x37, 0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708, 0x33,
+    0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31,
+    0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x48, 0x67, 0x65, 0x72, 0x67, 0x65, 0x56,
+    0x4C, 0x54, 0x44, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3,
+    0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB,
+    0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1,
+    0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1,
+    0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1,
+    0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30AF,
+    0x3099, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8,
+    0x3099, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB,
+    0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AB, 0x3099,
+    0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099,
+    0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC,
+    0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC,
+    0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AF,
+    0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x30AF,
+    0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB,
+    0x309A, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA,
+    0x30F3, 0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30BF, 0x3099, 0x30FC,
+    0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE,
+    0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF,
+    0x309A, 0x30FC, 0x30C4, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9,
+    0x30C8, 0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2, 0x309A, 0x30B3, 0x30D2, 0x3099, 0x30EB,
+    0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5, 0x3099,
+    0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB,
+    0x30D8, 0x309A, 0x30BD, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A,
+    0x30F3, 0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x30DB,
+    0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB, 0x309A,
+    0x30F3, 0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF,
+    0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3,
+    0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30CF,
+    0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x30E1,
+    0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2,
+    0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB,
+    0x30FC, 0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3,
+    0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9, 0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9, 0x35,
+    0x70B9, 0x36, 0x70B9, 0x37, 0x70B9, 0x38, 0x70B9, 0x39, 0x70B9, 0x31, 0x30, 0x70B9, 0x31, 0x31,
+    0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34, 0x70B9, 0x31, 0x35, 0x70B9, 0x31, 0x36,
+    0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9, 0x32, 0x30, 0x70B9, 0x32, 0x31,
+    0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9, 0x32, 0x34, 0x70B9, 0x68, 0x50, 0x61, 0x64, 0x61,
+    0x41, 0x55, 0x62, 0x61, 0x72, 0x6F, 0x56, 0x70, 0x63, 0x64, 0x6D, 0x64, 0x6D, 0x32, 0x64, 0x6D,
+    0x33, 0x49, 0x55, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F,
+    0x4F1A, 0x793E, 0x70, 0x41, 0x6E, 0x41, 0x3BC, 0x41, 0x6D, 0x41, 0x6B, 0x41, 0x4B, 0x42, 0x4D, 0x42,
+    0x47, 0x42, 0x63, 0x61, 0x6C, 0x6B, 0x63, 0x61, 0x6C, 0x70, 0x46, 0x6E, 0x46, 0x3BC, 0x46, 0x3BC,
+    0x67, 0x6D, 0x67, 0x6B, 0x67, 0x48, 0x7A, 0x6B, 0x48, 0x7A, 0x4D, 0x48, 0x7A, 0x47, 0x48, 0x7A,
+    0x54, 0x48, 0x7A, 0x3BC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D, 0x3BC,
+    0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D, 0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32, 0x6B,
+    0x6D, 0x32, 0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0x2215, 0x73,
+    0x6D, 0x2215, 0x73, 0x32, 0x50, 0x61, 0x6B, 0x50, 0x61, 0x4D, 0x50, 0x61, 0x47, 0x50, 0x61, 0x72,
+    0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x70, 0x73, 0x6E,
+    0x73, 0x3BC, 0x73, 0x6D, 0x73, 0x70, 0x56, 0x6E, 0x56, 0x3BC, 0x56, 0x6D, 0x56, 0x6B, 0x56, 0x4D,
+    0x56, 0x70, 0x57, 0x6E, 0x57, 0x3BC, 0x57, 0x6D, 0x57, 0x6B, 0x57, 0x4D, 0x57, 0x6B, 0x3A9, 0x4D,
+    0x3A9, 0x61, 0x2E, 0x6D, 0x2E, 0x42, 0x71, 0x63, 0x63, 0x63, 0x64, 0x43, 0x2215, 0x6B, 0x67, 0x43,
+    0x6F, 0x2E, 0x64, 0x42, 0x47, 0x79, 0x68, 0x61, 0x48, 0x50, 0x69, 0x6E, 0x4B, 0x4B, 0x4B, 0x4D,
+    0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x62, 0x6D, 0x69, 0x6C,
+    0x6D, 0x6F, 0x6C, 0x50, 0x48, 0x70, 0x2E, 0x6D, 0x2E, 0x50, 0x50, 0x4D, 0x50, 0x52, 0x73, 0x72,
+    0x53, 0x76, 0x57, 0x62, 0x56, 0x2215, 0x6D, 0x41, 0x2215, 0x6D, 0x31, 0x65E5, 0x32, 0x65E5, 0x33,
+    0x65E5, 0x34, 0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37, 0x65E5, 0x38, 0x65E5, 0x39, 0x65E5, 0x31,
+    0x30, 0x65E5, 0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31,
+    0x35, 0x65E5, 0x31, 0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32,
+    0x30, 0x65E5, 0x32, 0x31, 0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32,
+    0x35, 0x65E5, 0x32, 0x36, 0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39, 0x65E5, 0x33,
+    0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67, 0x61, 0x6C, 0x44A, 0x44C, 0xA76F, 0x43, 0x46, 0x51, 0x126,
+    0x153, 0xA727, 0xAB37, 0x26B, 0xAB52, 0x28D, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+    0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8,
+    0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+    0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A,
+    0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+    0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF,
+    0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+    0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80,
+    0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+    0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88,
+    0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+    0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B,
+    0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+    0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9,
+    0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+    0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86,
+    0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+    0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E,
+    0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+    0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2,
+    0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+    0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3,
+    0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+    0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612,
+    0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+    0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168,
+    0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+    0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0,
+    0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+    0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26,
+    0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+    0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108,
+    0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+    0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A,
+    0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+    0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996,
+    0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+    0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844,
+    0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x66, 0x66, 0x66, 0x69,
+    0x66, 0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73, 0x74, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565,
+    0x574, 0x56B, 0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E2, 0x5D0, 0x5D3, 0x5D4,
+    0x5DB, 0x5DC, 0x5DD, 0x5E8, 0x5EA, 0x2B, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC, 0x5C1, 0x5E9,
+    0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC,
+    0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC,
+    0x5DC, 0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC,
+    0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF,
+    0x5E4, 0x5BF, 0x5D0, 0x5DC, 0x671, 0x671, 0x67B, 0x67B, 0x67B, 0x67B, 0x67E, 0x67E, 0x67E, 0x67E,
+    0x680, 0x680, 0x680, 0x680, 0x67A, 0x67A, 0x67A, 0x67A, 0x67F, 0x67F, 0x67F, 0x67F, 0x679, 0x679,
+    0x679, 0x679, 0x6A4, 0x6A4, 0x6A4, 0x6A4, 0x6A6, 0x6A6, 0x6A6, 0x6A6, 0x684, 0x684, 0x684, 0x684,
+    0x683, 0x683, 0x683, 0x683, 0x686, 0x686, 0x686, 0x686, 0x687, 0x687, 0x687, 0x687, 0x68D, 0x68D,
+    0x68C, 0x68C, 0x68E, 0x68E, 0x688, 0x688, 0x698, 0x698, 0x691, 0x691, 0x6A9, 0x6A9, 0x6A9, 0x6A9,
+    0x6AF, 0x6AF, 0x6AF, 0x6AF, 0x6B3, 0x6B3, 0x6B3, 0x6B3, 0x6B1, 0x6B1, 0x6B1, 0x6B1, 0x6BA, 0x6BA,
+    0x6BB, 0x6BB, 0x6BB, 0x6BB, 0x6D5, 0x654, 0x6D5, 0x654, 0x6C1, 0x6C1, 0x6C1, 0x6C1, 0x6BE, 0x6BE,
+    0x6BE, 0x6BE, 0x6D2, 0x6D2, 0x6D2, 0x654, 0x6D2, 0x654, 0x6AD, 0x6AD, 0x6AD, 0x6AD, 0x6C7, 0x6C7,
+    0x6C6, 0x6C6, 0x6C8, 0x6C8, 0x6C7, 0x674, 0x6CB, 0x6CB, 0x6C5, 0x6C5, 0x6C9, 0x6C9, 0x6D0, 0x6D0,
+    0x6D0, 0x6D0, 0x649, 0x649, 0x64A, 0x654, 0x627, 0x64A, 0x654, 0x627, 0x64A, 0x654, 0x6D5, 0x64A,
+    0x654, 0x6D5, 0x64A, 0x654, 0x648, 0x64A, 0x654, 0x648, 0x64A, 0x654, 0x6C7, 0x64A, 0x654, 0x6C7,
+    0x64A, 0x654, 0x6C6, 0x64A, 0x654, 0x6C6, 0x64A, 0x654, 0x6C8, 0x64A, 0x654, 0x6C8, 0x64A, 0x654,
+    0x6D0, 0x64A, 0x654, 0x6D0, 0x64A, 0x654, 0x6D0, 0x64A, 0x654, 0x649, 0x64A, 0x654, 0x649, 0x64A,
+    0x654, 0x649, 0x6CC, 0x6CC, 0x6CC, 0x6CC, 0x64A, 0x654, 0x62C, 0x64A, 0x654, 0x62D, 0x64A, 0x654,
+    0x645, 0x64A, 0x654, 0x649, 0x64A, 0x654, 0x64A, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628,
+    0x645, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A,
+    0x649, 0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645, 0x62B, 0x649, 0x62B, 0x64A, 0x62C, 0x62D, 0x62C,
+    0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x62D, 0x62E, 0x645, 0x633, 0x62C, 0x633,
+    0x62D, 0x633, 0x62E, 0x633, 0x645, 0x635, 0x62D, 0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636,
+    0x62E, 0x636, 0x645, 0x637, 0x62D, 0x637, 0x645, 0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A,
+    0x62C, 0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x641, 0x649, 0x641,
+    0x64A, 0x642, 0x62D, 0x642, 0x645, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627, 0x643, 0x62C, 0x643,
+    0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649, 0x643, 0x64A, 0x644, 0x62C, 0x644,
+    0x62D, 0x644, 0x62E, 0x644, 0x645, 0x644, 0x649, 0x644, 0x64A, 0x645, 0x62C, 0x645, 0x62D, 0x645,
+    0x62E, 0x645, 0x645, 0x645, 0x649, 0x645, 0x64A, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646,
+    0x645, 0x646, 0x649, 0x646, 0x64A, 0x647, 0x62C, 0x647, 0x645, 0x647, 0x649, 0x647, 0x64A, 0x64A,
+    0x62C, 0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A, 0x649, 0x64A, 0x64A, 0x630, 0x670, 0x631,
+    0x670, 0x649, 0x670, 0x20, 0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E, 0x651, 0x20, 0x64F, 0x651,
+    0x20, 0x650, 0x651, 0x20, 0x651, 0x670, 0x64A, 0x654, 0x631, 0x64A, 0x654, 0x632, 0x64A, 0x654,
+    0x645, 0x64A, 0x654, 0x646, 0x64A, 0x654, 0x649, 0x64A, 0x654, 0x64A, 0x628, 0x631, 0x628, 0x632,
+    0x628, 0x645, 0x628, 0x646, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x631, 0x62A, 0x632, 0x62A, 0x645,
+    0x62A, 0x646, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x631, 0x62B, 0x632, 0x62B, 0x645, 0x62B, 0x646,
+    0x62B, 0x649, 0x62B, 0x64A, 0x641, 0x649, 0x641, 0x64A, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627,
+    0x643, 0x644, 0x643, 0x645, 0x643, 0x649, 0x643, 0x64A, 0x644, 0x645, 0x644, 0x649, 0x644, 0x64A,
+    0x645, 0x627, 0x645, 0x645, 0x646, 0x631, 0x646, 0x632, 0x646, 0x645, 0x646, 0x646, 0x646, 0x649,
+    0x646, 0x64A, 0x649, 0x670, 0x64A, 0x631, 0x64A, 0x632, 0x64A, 0x645, 0x64A, 0x646, 0x64A, 0x649,
+    0x64A, 0x64A, 0x64A, 0x654, 0x62C, 0x64A, 0x654, 0x62D, 0x64A, 0x654, 0x62E, 0x64A, 0x654, 0x645,
+    0x64A, 0x654, 0x647, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x647, 0x62A,
+    0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62C, 0x62D, 0x62C,
+    0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633,
+    0x62E, 0x633, 0x645, 0x635, 0x62D, 0x635, 0x62E, 0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636,
+    0x62E, 0x636, 0x645, 0x637, 0x62D, 0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A,
+    0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x642, 0x62D, 0x642, 0x645, 0x643,
+    0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x644, 0x62C, 0x644, 0x62D, 0x644,
+    0x62E, 0x644, 0x645, 0x644, 0x647, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x646,
+    0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x647, 0x647, 0x62C, 0x647, 0x645, 0x647,
+    0x670, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A, 0x647, 0x64A, 0x654, 0x645,
+    0x64A, 0x654, 0x647, 0x628, 0x645, 0x628, 0x647, 0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62B,
+    0x647, 0x633, 0x645, 0x633, 0x647, 0x634, 0x645, 0x634, 0x647, 0x643, 0x644, 0x643, 0x645, 0x644,
+    0x645, 0x646, 0x645, 0x646, 0x647, 0x64A, 0x645, 0x64A, 0x647, 0x640, 0x64E, 0x651, 0x640, 0x64F,
+    0x651, 0x640, 0x650, 0x651, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649,
+    0x63A, 0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A,
+    0x62C, 0x649, 0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636, 0x649,
+    0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631,
+    0x635, 0x631, 0x636, 0x631, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649,
+    0x63A, 0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A,
+    0x62C, 0x649, 0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636, 0x649,
+    0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631,
+    0x635, 0x631, 0x636, 0x631, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x633, 0x647,
+    0x634, 0x647, 0x637, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x634, 0x62C, 0x634, 0x62D,
+    0x634, 0x62E, 0x637, 0x645, 0x638, 0x645, 0x627, 0x64B, 0x627, 0x64B, 0x62A, 0x62C, 0x645, 0x62A,
+    0x62D, 0x62C, 0x62A, 0x62D, 0x62C, 0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A, 0x645, 0x62C,
+    0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x62D, 0x645,
+    0x64A, 0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633, 0x62C, 0x649, 0x633,
+    0x645, 0x62D, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x633, 0x645, 0x645,
+    0x635, 0x62D, 0x62D, 0x635, 0x62D, 0x62D, 0x635, 0x645, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62D,
+    0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x634,
+    0x645, 0x645, 0x636, 0x62D, 0x649, 0x636, 0x62E, 0x645, 0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D,
+    0x637, 0x645, 0x62D, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C, 0x645, 0x639, 0x645,
+    0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645, 0x64A, 0x63A,
+    0x645, 0x649, 0x641, 0x62E, 0x645, 0x641, 0x62E, 0x645, 0x642, 0x645, 0x62D, 0x642, 0x645, 0x645,
+    0x644, 0x62D, 0x645, 0x644, 0x62D, 0x64A, 0x644, 0x62D, 0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62C,
+    0x62C, 0x644, 0x62E, 0x645, 0x644, 0x62E, 0x645, 0x644, 0x645, 0x62D, 0x644, 0x645, 0x62D, 0x645,
+    0x62D, 0x62C, 0x645, 0x62D, 0x645, 0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645,
+    0x645, 0x62E, 0x62C, 0x645, 0x62E, 0x645, 0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647, 0x645,
+    0x645, 0x646, 0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646, 0x62C, 0x645, 0x646,
+    0x62C, 0x649, 0x646, 0x645, 0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645, 0x645, 0x64A, 0x645, 0x645,
+    0x628, 0x62E, 0x64A, 0x62A, 0x62C, 0x64A, 0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E,
+    0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645, 0x649, 0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C,
+    0x645, 0x649, 0x633, 0x62E, 0x649, 0x635, 0x62D, 0x64A, 0x634, 0x62D, 0x64A, 0x636, 0x62D, 0x64A,
+    0x644, 0x62C, 0x64A, 0x644, 0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C, 0x64A, 0x64A, 0x645,
+    0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x642, 0x645, 0x62D, 0x644,
+    0x62D, 0x645, 0x639, 0x645, 0x64A, 0x643, 0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A,
+    0x644, 0x62C, 0x645, 0x643, 0x645, 0x645, 0x644, 0x62C, 0x645, 0x646, 0x62C, 0x62D, 0x62C, 0x62D,
+    0x64A, 0x62D, 0x62C, 0x64A, 0x645, 0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D, 0x64A, 0x643,
+    0x645, 0x645, 0x639, 0x62C, 0x645, 0x635, 0x645, 0x645, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A,
+    0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2, 0x627, 0x644, 0x644, 0x647, 0x627, 0x643, 0x628, 0x631,
+    0x645, 0x62D, 0x645, 0x62F, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633, 0x648, 0x644, 0x639, 0x644,
+    0x64A, 0x647, 0x648, 0x633, 0x644, 0x645, 0x635, 0x644, 0x649, 0x635, 0x644, 0x649, 0x20, 0x627,
+    0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62C,
+    0x644, 0x20, 0x62C, 0x644, 0x627, 0x644, 0x647, 0x631, 0x6CC, 0x627, 0x644, 0x2C, 0x3001, 0x3002,
+    0x3A, 0x3B, 0x21, 0x3F, 0x3016, 0x3017, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2014, 0x2013, 0x5F, 0x5F,
+    0x28, 0x29, 0x7B, 0x7D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x3008, 0x3009, 0x300C,
+    0x300D, 0x300E, 0x300F, 0x5B, 0x5D, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305, 0x5F, 0x5F,
+    0x5F, 0x2C, 0x3001, 0x2E, 0x3B, 0x3A, 0x3F, 0x21, 0x2014, 0x28, 0x29, 0x7B, 0x7D, 0x3014, 0x3015,
+    0x23, 0x26, 0x2A, 0x2B, 0x2D, 0x3C, 0x3E, 0x3D, 0x5C, 0x24, 0x25, 0x40, 0x20, 0x64B, 0x640, 0x64B,
+    0x20, 0x64C, 0x20, 0x64D, 0x20, 0x64E, 0x640, 0x64E, 0x20, 0x64F, 0x640, 0x64F, 0x20, 0x650, 0x640,
+    0x650, 0x20, 0x651, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652, 0x621, 0x627, 0x653, 0x627, 0x653,
+    0x627, 0x654, 0x627, 0x654, 0x648, 0x654, 0x648, 0x654, 0x627, 0x655, 0x627, 0x655, 0x64A, 0x654,
+    0x64A, 0x654, 0x64A, 0x654, 0x64A, 0x654, 0x627, 0x627, 0x628, 0x628, 0x628, 0x628, 0x629, 0x629,
+    0x62A, 0x62A, 0x62A, 0x62A, 0x62B, 0x62B, 0x62B, 0x62B, 0x62C, 0x62C, 0x62C, 0x62C, 0x62D, 0x62D,
+    0x62D, 0x62D, 0x62E, 0x62E, 0x62E, 0x62E, 0x62F, 0x62F, 0x630, 0x630, 0x631, 0x631, 0x632, 0x632,
+    0x633, 0x633, 0x633, 0x633, 0x634, 0x634, 0x634, 0x634, 0x635, 0x635, 0x635, 0x635, 0x636, 0x636,
+    0x636, 0x636, 0x637, 0x637, 0x637, 0x637, 0x638, 0x638, 0x638, 0x638, 0x639, 0x639, 0x639, 0x639,
+    0x63A, 0x63A, 0x63A, 0x63A, 0x641, 0x641, 0x641, 0x641, 0x642, 0x642, 0x642, 0x642, 0x643, 0x643,
+    0x643, 0x643, 0x644, 0x644, 0x644, 0x644, 0x645, 0x645, 0x645, 0x645, 0x646, 0x646, 0x646, 0x646,
+    0x647, 0x647, 0x647, 0x647, 0x648, 0x648, 0x649, 0x649, 0x64A, 0x64A, 0x64A, 0x64A, 0x644, 0x627,
+    0x653, 0x644, 0x627, 0x653, 0x644, 0x627, 0x654, 0x644, 0x627, 0x654, 0x644, 0x627, 0x655, 0x644,
+    0x627, 0x655, 0x644, 0x627, 0x644, 0x627, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x2985, 0x2986, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2,
+    0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4,
+    0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB,
+    0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF,
+    0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8,
+    0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x3099, 0x309A, 0x1160, 0x1100, 0x1101,
+    0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4,
+    0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E,
+    0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168,
+    0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174,
+    0x1175, 0xA2, 0xA3, 0xAC, 0x20, 0x304, 0xA6, 0xA5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193,
+    0x25A0, 0x25CB, 0x2D0, 0x2D1, 0xE6, 0x299, 0x253, 0x2A3, 0xAB66, 0x2A5, 0x2A4, 0x256, 0x257, 0x1D91,
+    0x258, 0x25E, 0x2A9, 0x264, 0x262, 0x260, 0x29B, 0x127, 0x29C, 0x267, 0x284, 0x2AA, 0x2AB, 0x26C,
+    0x1DF04, 0xA78E, 0x26E, 0x1DF05, 0x28E, 0x1DF06, 0xF8, 0x276, 0x277, 0x71, 0x27A, 0x1DF08, 0x27D,
+    0x27E, 0x280, 0x2A8, 0x2A6, 0xAB67, 0x2A7, 0x288, 0x2C71, 0x28F, 0x2A1, 0x2A2, 0x298, 0x1C0, 0x1C1,
+    0x1C2, 0x1DF0A, 0x1DF1E, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127,
+    0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9,
+    0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165,
+    0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165,
+    0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E,
+    0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+    0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x43, 0x44, 0x47, 0x4A, 0x4B, 0x4E, 0x4F,
+    0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x66, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44, 0x45, 0x46, 0x47, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+    0x4F, 0x50, 0x51, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x44, 0x45, 0x46, 0x47, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4F,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B,
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x131, 0x237, 0x391, 0x392, 0x393, 0x394,
+    0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398,
+    0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6,
+    0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4,
+    0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392,
+    0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0,
+    0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4,
+    0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2,
+    0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0,
+    0x391, 0x392, 0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C, 0x39D, 0x39E,
+    0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207, 0x3B1, 0x3B2,
+    0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0,
+    0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6,
+    0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399, 0x39A, 0x39B, 0x39C,
+    0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8, 0x3A9, 0x2207,
+    0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE,
+    0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x391, 0x392, 0x393, 0x394, 0x395, 0x396, 0x397, 0x398, 0x399, 0x39A,
+    0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0, 0x3A1, 0x398, 0x3A3, 0x3A4, 0x3A5, 0x3A6, 0x3A7, 0x3A8,
+    0x3A9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC,
+    0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C2, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202,
+    0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3DC, 0x3DD, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x627, 0x628, 0x62C, 0x62F, 0x648,
+    0x632, 0x62D, 0x637, 0x64A, 0x643, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x631,
+    0x634, 0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x66E, 0x6BA, 0x6A1, 0x66F, 0x628, 0x62C,
+    0x647, 0x62D, 0x64A, 0x643, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x634, 0x62A,
+    0x62B, 0x62E, 0x636, 0x63A, 0x62C, 0x62D, 0x64A, 0x644, 0x646, 0x633, 0x639, 0x635, 0x642, 0x634,
+    0x62E, 0x636, 0x63A, 0x6BA, 0x66F, 0x628, 0x62C, 0x647, 0x62D, 0x637, 0x64A, 0x643, 0x645, 0x646,
+    0x633, 0x639, 0x641, 0x635, 0x642, 0x634, 0x62A, 0x62B, 0x62E, 0x636, 0x638, 0x63A, 0x66E, 0x6A1,
+    0x627, 0x628, 0x62C, 0x62F, 0x647, 0x648, 0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633,
+    0x639, 0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x628,
+    0x62C, 0x62F, 0x648, 0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635,
+    0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x30, 0x2E, 0x30, 0x2C, 0x31,
+    0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C, 0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39,
+    0x2C, 0x28, 0x41, 0x29, 0x28, 0x42, 0x29, 0x28, 0x43, 0x29, 0x28, 0x44, 0x29, 0x28, 0x45, 0x29,
+    0x28, 0x46, 0x29, 0x28, 0x47, 0x29, 0x28, 0x48, 0x29, 0x28, 0x49, 0x29, 0x28, 0x4A, 0x29, 0x28,
+    0x4B, 0x29, 0x28, 0x4C, 0x29, 0x28, 0x4D, 0x29, 0x28, 0x4E, 0x29, 0x28, 0x4F, 0x29, 0x28, 0x50,
+    0x29, 0x28, 0x51, 0x29, 0x28, 0x52, 0x29, 0x28, 0x53, 0x29, 0x28, 0x54, 0x29, 0x28, 0x55, 0x29,
+    0x28, 0x56, 0x29, 0x28, 0x57, 0x29, 0x28, 0x58, 0x29, 0x28, 0x59, 0x29, 0x28, 0x5A, 0x29, 0x3014,
+    0x53, 0x3015, 0x43, 0x52, 0x43, 0x44, 0x57, 0x5A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5A, 0x48, 0x56, 0x4D, 0x56, 0x53, 0x44, 0x53, 0x53, 0x50, 0x50, 0x56, 0x57, 0x43, 0x4D,
+    0x43, 0x4D, 0x44, 0x4D, 0x52, 0x44, 0x4A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x30B5, 0x624B, 0x5B57,
+    0x53CC, 0x30C6, 0x3099, 0x4E8C, 0x591A, 0x89E3, 0x5929, 0x4EA4, 0x6620, 0x7121, 0x6599, 0x524D,
+    0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295, 0x6355,
+    0x4E00, 0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307, 0x8D70, 0x6253, 0x7981, 0x7A7A, 0x5408,
+    0x6E80, 0x6709, 0x6708, 0x7533, 0x5272, 0x55B6, 0x914D, 0x3014, 0x672C, 0x3015, 0x3014, 0x4E09,
+    0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015, 0x3014, 0x6253,
+    0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60,
+    0x4FAE, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154, 0x5164,
+    0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF,
+    0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA,
+    0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C,
+    0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2,
+    0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606,
+    0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC,
+    0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27,
+    0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3,
+    0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43,
+    0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862,
+    0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22,
+    0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081,
+    0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2,
+    0x61A4, 0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C,
+    0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E,
+    0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08,
+    0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753,
+    0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942,
+    0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F,
+    0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E,
+    0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7,
+    0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A, 0x707D,
+    0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280,
+    0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471,
+    0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8,
+    0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F, 0x774A,
+    0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A,
+    0x256C5, 0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202,
+    0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63,
+    0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95,
+    0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B,
+    0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B,
+    0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323,
+    0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1,
+    0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C,
+    0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1,
+    0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966,
+    0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F,
+    0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111,
+    0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7,
+    0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2,
+    0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE,
+    0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291,
+    0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+static const utf8_compose_pair utf8_compose_table[] = {
+    {0x3C, 0x338, 0x226E}, {0x3D, 0x338, 0x2260}, {0x3E, 0x338, 0x226F}, {0x41, 0x300, 0xC0},
+    {0x41, 0x301, 0xC1}, {0x41, 0x302, 0xC2}, {0x41, 0x303, 0xC3}, {0x41, 0x304, 0x100},
+    {0x41, 0x306, 0x102}, {0x41, 0x307, 0x226}, {0x41, 0x308, 0xC4}, {0x41, 0x309, 0x1EA2},
+    {0x41, 0x30A, 0xC5}, {0x41, 0x30C, 0x1CD}, {0x41, 0x30F, 0x200}, {0x41, 0x311, 0x202},
+    {0x41, 0x323, 0x1EA0}, {0x41, 0x325, 0x1E00}, {0x41, 0x328, 0x104}, {0x42, 0x307, 0x1E02},
+    {0x42, 0x323, 0x1E04}, {0x42, 0x331, 0x1E06}, {0x43, 0x301, 0x106}, {0x43, 0x302, 0x108},
+    {0x43, 0x307, 0x10A}, {0x43, 0x30C, 0x10C}, {0x43, 0x327, 0xC7}, {0x44, 0x307, 0x1E0A},
+    {0x44, 0x30C, 0x10E}, {0x44, 0x323, 0x1E0C}, {0x44, 0x327, 0x1E10}, {0x44, 0x32D, 0x1E12},
+    {0x44, 0x331, 0x1E0E}, {0x45, 0x300, 0xC8}, {0x45, 0x301, 0xC9}, {0x45, 0x302, 0xCA},
+    {0x45, 0x303, 0x1EBC}, {0x45, 0x304, 0x112}, {0x45, 0x306, 0x114}, {0x45, 0x307, 0x116},
+    {0x45, 0x308, 0xCB}, {0x45, 0x309, 0x1EBA}, {0x45, 0x30C, 0x11A}, {0x45, 0x30F, 0x204},
+    {0x45, 0x311, 0x206}, {0x45, 0x323, 0x1EB8}, {0x45, 0x327, 0x228}, {0x45, 0x328, 0x118},
+    {0x45, 0x32D, 0x1E18}, {0x45, 0x330, 0x1E1A}, {0x46, 0x307, 0x1E1E}, {0x47, 0x301, 0x1F4},
+    {0x47, 0x302, 0x11C}, {0x47, 0x304, 0x1E20}, {0x47, 0x306, 0x11E}, {0x47, 0x307, 0x120},
+    {0x47, 0x30C, 0x1E6}, {0x47, 0x327, 0x122}, {0x48, 0x302, 0x124}, {0x48, 0x307, 0x1E22},
+    {0x48, 0x308, 0x1E26}, {0x48, 0x30C, 0x21E}, {0x48, 0x323, 0x1E24}, {0x48, 0x327, 0x1E28},
+    {0x48, 0x32E, 0x1E2A}, {0x49, 0x300, 0xCC}, {0x49, 0x301, 0xCD}, {0x49, 0x302, 0xCE},
+    {0x49, 0x303, 0x128}, {0x49, 0x304, 0x12A}, {0x49, 0x306, 0x12C}, {0x49, 0x307, 0x130},
+    {0x49, 0x308, 0xCF}, {0x49, 0x309, 0x1EC8}, {0x49, 0x30C, 0x1CF}, {0x49, 0x30F, 0x208},
+    {0x49, 0x311, 0x20A}, {0x49, 0x323, 0x1ECA}, {0x49, 0x328, 0x12E}, {0x49, 0x330, 0x1E2C},
+    {0x4A, 0x302, 0x134}, {0x4B, 0x301, 0x1E30}, {0x4B, 0x30C, 0x1E8}, {0x4B, 0x323, 0x1E32},
+    {0x4B, 0x327, 0x136}, {0x4B, 0x331, 0x1E34}, {0x4C, 0x301, 0x139}, {0x4C, 0x30C, 0x13D},
+    {0x4C, 0x323, 0x1E36}, {0x4C, 0x327, 0x13B}, {0x4C, 0x32D, 0x1E3C}, {0x4C, 0x331, 0x1E3A},
+    {0x4D, 0x301, 0x1E3E}, {0x4D, 0x307, 0x1E40}, {0x4D, 0x323, 0x1E42}, {0x4E, 0x300, 0x1F8},
+    {0x4E, 0x301, 0x143}, {0x4E, 0x303, 0xD1}, {0x4E, 0x307, 0x1E44}, {0x4E, 0x30C, 0x147},
+    {0x4E, 0x323, 0x1E46}, {0x4E, 0x327, 0x145}, {0x4E, 0x32D, 0x1E4A}, {0x4E, 0x331, 0x1E48},
+    {0x4F, 0x300, 0xD2}, {0x4F, 0x301, 0xD3}, {0x4F, 0x302, 0xD4}, {0x4F, 0x303, 0xD5},
+    {0x4F, 0x304, 0x14C}, {0x4F, 0x306, 0x14E}, {0x4F, 0x307, 0x22E}, {0x4F, 0x308, 0xD6},
+    {0x4F, 0x309, 0x1ECE}, {0x4F, 0x30B, 0x150}, {0x4F, 0x30C, 0x1D1}, {0x4F, 0x30F, 0x20C},
+    {0x4F, 0x311, 0x20E}, {0x4F, 0x31B, 0x1A0}, {0x4F, 0x323, 0x1ECC}, {0x4F, 0x328, 0x1EA},
+    {0x50, 0x301, 0x1E54}, {0x50, 0x307, 0x1E56}, {0x52, 0x301, 0x154}, {0x52, 0x307, 0x1E58},
+    {0x52, 0x30C, 0x158}, {0x52, 0x30F, 0x210}, {0x52, 0x311, 0x212}, {0x52, 0x323, 0x1E5A},
+    {0x52, 0x327, 0x156}, {0x52, 0x331, 0x1E5E}, {0x53, 0x301, 0x15A}, {0x53, 0x302, 0x15C},
+    {0x53, 0x307, 0x1E60}, {0x53, 0x30C, 0x160}, {0x53, 0x323, 0x1E62}, {0x53, 0x326, 0x218},
+    {0x53, 0x327, 0x15E}, {0x54, 0x307, 0x1E6A}, {0x54, 0x30C, 0x164}, {0x54, 0x323, 0x1E6C},
+    {0x54, 0x326, 0x21A}, {0x54, 0x327, 0x162}, {0x54, 0x32D, 0x1E70}, {0x54, 0x331, 0x1E6E},
+    {0x55, 0x300, 0xD9}, {0x55, 0x301, 0xDA}, {0x55, 0x302, 0xDB}, {0x55, 0x303, 0x168},
+    {0x55, 0x304, 0x16A}, {0x55, 0x306, 0x16C}, {0x55, 0x308, 0xDC}, {0x55, 0x309, 0x1EE6},
+    {0x55, 0x30A, 0x16E}, {0x55, 0x30B, 0x170}, {0x55, 0x30C, 0x1D3}, {0x55, 0x30F, 0x214},
+    {0x55, 0x311, 0x216}, {0x55, 0x31B, 0x1AF}, {0x55, 0x323, 0x1EE4}, {0x55, 0x324, 0x1E72},
+    {0x55, 0x328, 0x172}, {0x55, 0x32D, 0x1E76}, {0x55, 0x330, 0x1E74}, {0x56, 0x303, 0x1E7C},
+    {0x56, 0x323, 0x1E7E}, {0x57, 0x300, 0x1E80}, {0x57, 0x301, 0x1E82}, {0x57, 0x302, 0x174},
+    {0x57, 0x307, 0x1E86}, {0x57, 0x308, 0x1E84}, {0x57, 0x323, 0x1E88}, {0x58, 0x307, 0x1E8A},
+    {0x58, 0x308, 0x1E8C}, {0x59, 0x300, 0x1EF2}, {0x59, 0x301, 0xDD}, {0x59, 0x302, 0x176},
+    {0x59, 0x303, 0x1EF8}, {0x59, 0x304, 0x232}, {0x59, 0x307, 0x1E8E}, {0x59, 0x308, 0x178},
+    {0x59, 0x309, 0x1EF6}, {0x59, 0x323, 0x1EF4}, {0x5A, 0x301, 0x179}, {0x5A, 0x302, 0x1E90},
+    {0x5A, 0x307, 0x17B}, {0x5A, 0x30C, 0x17D}, {0x5A, 0x323, 0x1E92}, {0x5A, 0x331, 0x1E94},
+    {0x61, 0x300, 0xE0}, {0x61, 0x301, 0xE1}, {0x61, 0x302, 0xE2}, {0x61, 0x303, 0xE3},
+    {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103}, {0x61, 0x307, 0x227}, {0x61, 0x308, 0xE4},
+    {0x61, 0x309, 0x1EA3}, {0x61, 0x30A, 0xE5}, {0x61, 0x30C, 0x1CE}, {0x61, 0x30F, 0x201},
+    {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1EA1}, {0x61, 0x325, 0x1E01}, {0x61, 0x328, 0x105},
+    {0x62, 0x307, 0x1E03}, {0x62, 0x323, 0x1E05}, {0x62, 0x331, 0x1E07}, {0x63, 0x301, 0x107},
+    {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10B}, {0x63, 0x30C, 0x10D}, {0x63, 0x327, 0xE7},
+    {0x64, 0x307, 0x1E0B}, {0x64, 0x30C, 0x10F}, {0x64, 0x323, 0x1E0D}, {0x64, 0x327, 0x1E11},
+    {0x64, 0x32D, 0x1E13}, {0x64, 0x331, 0x1E0F}, {0x65, 0x300, 0xE8}, {0x65, 0x301, 0xE9},
+    {0x65, 0x302, 0xEA}, {0x65, 0x303, 0x1EBD}, {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115},
+    {0x65, 0x307, 0x117}, {0x65, 0x308, 0xEB}, {0x65, 0x309, 0x1EBB}, {0x65, 0x30C, 0x11B},
+    {0x65, 0x30F, 0x205}, {0x65, 0x311, 0x207}, {0x65, 0x323, 0x1EB9}, {0x65, 0x327, 0x229},
+    {0x65, 0x328, 0x119}, {0x65, 0x32D, 0x1E19}, {0x65, 0x330, 0x1E1B}, {0x66, 0x307, 0x1E1F},
+    {0x67, 0x301, 0x1F5}, {0x67, 0x302, 0x11D}, {0x67, 0x304, 0x1E21}, {0x67, 0x306, 0x11F},
+    {0x67, 0x307, 0x121}, {0x67, 0x30C, 0x1E7}, {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125},
+    {0x68, 0x307, 0x1E23}, {0x68, 0x308, 0x1E27}, {0x68, 0x30C, 0x21F}, {0x68, 0x323, 0x1E25},
+    {0x68, 0x327, 0x1E29}, {0x68, 0x32E, 0x1E2B}, {0x68, 0x331, 0x1E96}, {0x69, 0x300, 0xEC},
+    {0x69, 0x301, 0xED}, {0x69, 0x302, 0xEE}, {0x69, 0x303, 0x129}, {0x69, 0x304, 0x12B},
+    {0x69, 0x306, 0x12D}, {0x69, 0x308, 0xEF}, {0x69, 0x309, 0x1EC9}, {0x69, 0x30C, 0x1D0},
+    {0x69, 0x30F, 0x209}, {0x69, 0x311, 0x20B}, {0x69, 0x323, 0x1ECB}, {0x69, 0x328, 0x12F},
+    {0x69, 0x330, 0x1E2D}, {0x6A, 0x302, 0x135}, {0x6A, 0x30C, 0x1F0}, {0x6B, 0x301, 0x1E31},
+    {0x6B, 0x30C, 0x1E9}, {0x6B, 0x323, 0x1E33}, {0x6B, 0x327, 0x137}, {0x6B, 0x331, 0x1E35},
+    {0x6C, 0x301, 0x13A}, {0x6C, 0x30C, 0x13E}, {0x6C, 0x323, 0x1E37}, {0x6C, 0x327, 0x13C},
+    {0x6C, 0x32D, 0x1E3D}, {0x6C, 0x331, 0x1E3B}, {0x6D, 0x301, 0x1E3F}, {0x6D, 0x307, 0x1E41},
+    {0x6D, 0x323, 0x1E43}, {0x6E, 0x300, 0x1F9}, {0x6E, 0x301, 0x144}, {0x6E, 0x303, 0xF1},
+    {0x6E, 0x307, 0x1E45}, {0x6E, 0x30C, 0x148}, {0x6E, 0x323, 0x1E47}, {0x6E, 0x327, 0x146},
+    {0x6E, 0x32D, 0x1E4B}, {0x6E, 0x331, 0x1E49}, {0x6F, 0x300, 0xF2}, {0x6F, 0x301, 0xF3},
+    {0x6F, 0x302, 0xF4}, {0x6F, 0x303, 0xF5}, {0x6F, 0x304, 0x14D}, {0x6F, 0x306, 0x14F},
+    {0x6F, 0x307, 0x22F}, {0x6F, 0x308, 0xF6}, {0x6F, 0x309, 0x1ECF}, {0x6F, 0x30B, 0x151},
+    {0x6F, 0x30C, 0x1D2}, {0x6F, 0x30F, 0x20D}, {0x6F, 0x311, 0x20F}, {0x6F, 0x31B, 0x1A1},
+    {0x6F, 0x323, 0x1ECD}, {0x6F, 0x328, 0x1EB}, {0x70, 0x301, 0x1E55}, {0x70, 0x307, 0x1E57},
+    {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1E59}, {0x72, 0x30C, 0x159}, {0x72, 0x30F, 0x211},
+    {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1E5B}, {0x72, 0x327, 0x157}, {0x72, 0x331, 0x1E5F},
+    {0x73, 0x301, 0x15B}, {0x73, 0x302, 0x15D}, {0x73, 0x307, 0x1E61}, {0x73, 0x30C, 0x161},
+    {0x73, 0x323, 0x1E63}, {0x73, 0x326, 0x219}, {0x73, 0x327, 0x15F}, {0x74, 0x307, 0x1E6B},
+    {0x74, 0x308, 0x1E97}, {0x74, 0x30C, 0x165}, {0x74, 0x323, 0x1E6D}, {0x74, 0x326, 0x21B},
+    {0x74, 0x327, 0x163}, {0x74, 0x32D, 0x1E71}, {0x74, 0x331, 0x1E6F}, {0x75, 0x300, 0xF9},
+    {0x75, 0x301, 0xFA}, {0x75, 0x302, 0xFB}, {0x75, 0x303, 0x169}, {0x75, 0x304, 0x16B},
+    {0x75, 0x306, 0x16D}, {0x75, 0x308, 0xFC}, {0x75, 0x309, 0x1EE7}, {0x75, 0x30A, 0x16F},
+    {0x75, 0x30B, 0x171}, {0x75, 0x30C, 0x1D4}, {0x75, 0x30F, 0x215}, {0x75, 0x311, 0x217},
+    {0x75, 0x31B, 0x1B0}, {0x75, 0x323, 0x1EE5}, {0x75, 0x324, 0x1E73}, {0x75, 0x328, 0x173},
+    {0x75, 0x32D, 0x1E77}, {0x75, 0x330, 0x1E75}, {0x76, 0x303, 0x1E7D}, {0x76, 0x323, 0x1E7F},
+    {0x77, 0x300, 0x1E81}, {0x77, 0x301, 0x1E83}, {0x77, 0x302, 0x175}, {0x77, 0x307, 0x1E87},
+    {0x77, 0x308, 0x1E85}, {0x77, 0x30A, 0x1E98}, {0x77, 0x323, 0x1E89}, {0x78, 0x307, 0x1E8B},
+    {0x78, 0x308, 0x1E8D}, {0x79, 0x300, 0x1EF3}, {0x79, 0x301, 0xFD}, {0x79, 0x302, 0x177},
+    {0x79, 0x303, 0x1EF9}, {0x79, 0x304, 0x233}, {0x79, 0x307, 0x1E8F}, {0x79, 0x308, 0xFF},
+    {0x79, 0x309, 0x1EF7}, {0x79, 0x30A, 0x1E99}, {0x79, 0x323, 0x1EF5}, {0x7A, 0x301, 0x17A},
+    {0x7A, 0x302, 0x1E91}, {0x7A, 0x307, 0x17C}, {0x7A, 0x30C, 0x17E}, {0x7A, 0x323, 0x1E93},
+    {0x7A, 0x331, 0x1E95}, {0xA8, 0x300, 0x1FED}, {0xA8, 0x301, 0x385}, {0xA8, 0x342, 0x1FC1},
+    {0xC2, 0x300, 0x1EA6}, {0xC2, 0x301, 0x1EA4}, {0xC2, 0x303, 0x1EAA}, {0xC2, 0x309, 0x1EA8},
+    {0xC4, 0x304, 0x1DE}, {0xC5, 0x301, 0x1FA}, {0xC6, 0x301, 0x1FC}, {0xC6, 0x304, 0x1E2},
+    {0xC7, 0x301, 0x1E08}, {0xCA, 0x300, 0x1EC0}, {0xCA, 0x301, 0x1EBE}, {0xCA, 0x303, 0x1EC4},
+    {0xCA, 0x309, 0x1EC2}, {0xCF, 0x301, 0x1E2E}, {0xD4, 0x300, 0x1ED2}, {0xD4, 0x301, 0x1ED0},
+    {0xD4, 0x303, 0x1ED6}, {0xD4, 0x309, 0x1ED4}, {0xD5, 0x301, 0x1E4C}, {0xD5, 0x304, 0x22C},
+    {0xD5, 0x308, 0x1E4E}, {0xD6, 0x304, 0x22A}, {0xD8, 0x301, 0x1FE}, {0xDC, 0x300, 0x1DB},
+    {0xDC, 0x301, 0x1D7}, {0xDC, 0x304, 0x1D5}, {0xDC, 0x30C, 0x1D9}, {0xE2, 0x300, 0x1EA7},
+    {0xE2, 0x301, 0x1EA5}, {0xE2, 0x303, 0x1EAB}, {0xE2, 0x309, 0x1EA9}, {0xE4, 0x304, 0x1DF},
+    {0xE5, 0x301, 0x1FB}, {0xE6, 0x301, 0x1FD}, {0xE6, 0x304, 0x1E3}, {0xE7, 0x301, 0x1E09},
+    {0xEA, 0x300, 0x1EC1}, {0xEA, 0x301, 0x1EBF}, {0xEA, 0x303, 0x1EC5}, {0xEA, 0x309, 0x1EC3},
+    {0xEF, 0x301, 0x1E2F}, {0xF4, 0x300, 0x1ED3}, {0xF4, 0x301, 0x1ED1}, {0xF4, 0x303, 0x1ED7},
+    {0xF4, 0x309, 0x1ED5}, {0xF5, 0x301, 0x1E4D}, {0xF5, 0x304, 0x22D}, {0xF5, 0x308, 0x1E4F},
+    {0xF6, 0x304, 0x22B}, {0xF8, 0x301, 0x1FF}, {0xFC, 0x300, 0x1DC}, {0xFC, 0x301, 0x1D8},
+    {0xFC, 0x304, 0x1D6}, {0xFC, 0x30C, 0x1DA}, {0x102, 0x300, 0x1EB0}, {0x102, 0x301, 0x1EAE},
+    {0x102, 0x303, 0x1EB4}, {0x102, 0x309, 0x1EB2}, {0x103, 0x300, 0x1EB1}, {0x103, 0x301, 0x1EAF},
+    {0x103, 0x303, 0x1EB5}, {0x103, 0x309, 0x1EB3}, {0x112, 0x300, 0x1E14}, {0x112, 0x301, 0x1E16},
+    {0x113, 0x300, 0x1E15}, {0x113, 0x301, 0x1E17}, {0x14C, 0x300, 0x1E50}, {0x14C, 0x301, 0x1E52},
+    {0x14D, 0x300, 0x1E51}, {0x14D, 0x301, 0x1E53}, {0x15A, 0x307, 0x1E64}, {0x15B, 0x307, 0x1E65},
+    {0x160, 0x307, 0x1E66}, {0x161, 0x307, 0x1E67}, {0x168, 0x301, 0x1E78}, {0x169, 0x301, 0x1E79},
+    {0x16A, 0x308, 0x1E7A}, {0x16B, 0x308, 0x1E7B}, {0x17F, 0x307, 0x1E9B}, {0x1A0, 0x300, 0x1EDC},
+    {0x1A0, 0x301, 0x1EDA}, {0x1A0, 0x303, 0x1EE0}, {0x1A0, 0x309, 0x1EDE}, {0x1A0, 0x323, 0x1EE2},
+    {0x1A1, 0x300, 0x1EDD}, {0x1A1, 0x301, 0x1EDB}, {0x1A1, 0x303, 0x1EE1}, {0x1A1, 0x309, 0x1EDF},
+    {0x1A1, 0x323, 0x1EE3}, {0x1AF, 0x300, 0x1EEA}, {0x1AF, 0x301, 0x1EE8}, {0x1AF, 0x303, 0x1EEE},
+    {0x1AF, 0x309, 0x1EEC}, {0x1AF, 0x323, 0x1EF0}, {0x1B0, 0x300, 0x1EEB}, {0x1B0, 0x301, 0x1EE9},
+    {0x1B0, 0x303, 0x1EEF}, {0x1B0, 0x309, 0x1EED}, {0x1B0, 0x323, 0x1EF1}, {0x1B7, 0x30C, 0x1EE},
+    {0x1EA, 0x304, 0x1EC}, {0x1EB, 0x304, 0x1ED}, {0x226, 0x304, 0x1E0}, {0x227, 0x304, 0x1E1},
+    {0x228, 0x306, 0x1E1C}, {0x229, 0x306, 0x1E1D}, {0x22E, 0x304, 0x230}, {0x22F, 0x304, 0x231},
+    {0x292, 0x30C, 0x1EF}, {0x391, 0x300, 0x1FBA}, {0x391, 0x301, 0x386}, {0x391, 0x304, 0x1FB9},
+    {0x391, 0x306, 0x1FB8}, {0x391, 0x313, 0x1F08}, {0x391, 0x314, 0x1F09}, {0x391, 0x345, 0x1FBC},
+    {0x395, 0x300, 0x1FC8}, {0x395, 0x301, 0x388}, {0x395, 0x313, 0x1F18}, {0x395, 0x314, 0x1F19},
+    {0x397, 0x300, 0x1FCA}, {0x397, 0x301, 0x389}, {0x397, 0x313, 0x1F28}, {0x397, 0x314, 0x1F29},
+    {0x397, 0x345, 0x1FCC}, {0x399, 0x300, 0x1FDA}, {0x399, 0x301, 0x38A}, {0x399, 0x304, 0x1FD9},
+    {0x399, 0x306, 0x1FD8}, {0x399, 0x308, 0x3AA}, {0x399, 0x313, 0x1F38}, {0x399, 0x314, 0x1F39},
+    {0x39F, 0x300, 0x1FF8}, {0x39F, 0x301, 0x38C}, {0x39F, 0x313, 0x1F48}, {0x39F, 0x314, 0x1F49},
+    {0x3A1, 0x314, 0x1FEC}, {0x3A5, 0x300, 0x1FEA}, {0x3A5, 0x301, 0x38E}, {0x3A5, 0x304, 0x1FE9},
+    {0x3A5, 0x306, 0x1FE8}, {0x3A5, 0x308, 0x3AB}, {0x3A5, 0x314, 0x1F59}, {0x3A9, 0x300, 0x1FFA},
+    {0x3A9, 0x301, 0x38F}, {0x3A9, 0x313, 0x1F68}, {0x3A9, 0x314, 0x1F69}, {0x3A9, 0x345, 0x1FFC},
+    {0x3AC, 0x345, 0x1FB4}, {0x3AE, 0x345, 0x1FC4}, {0x3B1, 0x300, 0x1F70}, {0x3B1, 0x301, 0x3AC},
+    {0x3B1, 0x304, 0x1FB1}, {0x3B1, 0x306, 0x1FB0}, {0x3B1, 0x313, 0x1F00}, {0x3B1, 0x314, 0x1F01},
+    {0x3B1, 0x342, 0x1FB6}, {0x3B1, 0x345, 0x1FB3}, {0x3B5, 0x300, 0x1F72}, {0x3B5, 0x301, 0x3AD},
+    {0x3B5, 0x313, 0x1F10}, {0x3B5, 0x314, 0x1F11}, {0x3B7, 0x300, 0x1F74}, {0x3B7, 0x301, 0x3AE},
+    {0x3B7, 0x313, 0x1F20}, {0x3B7, 0x314, 0x1F21}, {0x3B7, 0x342, 0x1FC6}, {0x3B7, 0x345, 0x1FC3},
+    {0x3B9, 0x300, 0x1F76}, {0x3B9, 0x301, 0x3AF}, {0x3B9, 0x304, 0x1FD1}, {0x3B9, 0x306, 0x1FD0},
+    {0x3B9, 0x308, 0x3CA}, {0x3B9, 0x313, 0x1F30}, {0x3B9, 0x314, 0x1F31}, {0x3B9, 0x342, 0x1FD6},
+    {0x3BF, 0x300, 0x1F78}, {0x3BF, 0x301, 0x3CC}, {0x3BF, 0x313, 0x1F40}, {0x3BF, 0x314, 0x1F41},
+    {0x3C1, 0x313, 0x1FE4}, {0x3C1, 0x314, 0x1FE5}, {0x3C5, 0x300, 0x1F7A}, {0x3C5, 0x301, 0x3CD},
+    {0x3C5, 0x304, 0x1FE1}, {0x3C5, 0x306, 0x1FE0}, {0x3C5, 0x308, 0x3CB}, {0x3C5, 0x313, 0x1F50},
+    {0x3C5, 0x314, 0x1F51}, {0x3C5, 0x342, 0x1FE6}, {0x3C9, 0x300, 0x1F7C}, {0x3C9, 0x301, 0x3CE},
+    {0x3C9, 0x313, 0x1F60}, {0x3C9, 0x314, 0x1F61}, {0x3C9, 0x342, 0x1FF6}, {0x3C9, 0x345, 0x1FF3},
+    {0x3CA, 0x300, 0x1FD2}, {0x3CA, 0x301, 0x390}, {0x3CA, 0x342, 0x1FD7}, {0x3CB, 0x300, 0x1FE2},
+    {0x3CB, 0x301, 0x3B0}, {0x3CB, 0x342, 0x1FE7}, {0x3CE, 0x345, 0x1FF4}, {0x3D2, 0x301, 0x3D3},
+    {0x3D2, 0x308, 0x3D4}, {0x406, 0x308, 0x407}, {0x410, 0x306, 0x4D0}, {0x410, 0x308, 0x4D2},
+    {0x413, 0x301, 0x403}, {0x415, 0x300, 0x400}, {0x415, 0x306, 0x4D6}, {0x415, 0x308, 0x401},
+    {0x416, 0x306, 0x4C1}, {0x416, 0x308, 0x4DC}, {0x417, 0x308, 0x4DE}, {0x418, 0x300, 0x40D},
+    {0x418, 0x304, 0x4E2}, {0x418, 0x306, 0x419}, {0x418, 0x308, 0x4E4}, {0x41A, 0x301, 0x40C},
+    {0x41E, 0x308, 0x4E6}, {0x423, 0x304, 0x4EE}, {0x423, 0x306, 0x40E}, {0x423, 0x308, 0x4F0},
+    {0x423, 0x30B, 0x4F2}, {0x427, 0x308, 0x4F4}, {0x42B, 0x308, 0x4F8}, {0x42D, 0x308, 0x4EC},
+    {0x430, 0x306, 0x4D1}, {0x430, 0x308, 0x4D3}, {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450},
+    {0x435, 0x306, 0x4D7}, {0x435, 0x308, 0x451}, {0x436, 0x306, 0x4C2}, {0x436, 0x308, 0x4DD},
+    {0x437, 0x308, 0x4DF}, {0x438, 0x300, 0x45D}, {0x438, 0x304, 0x4E3}, {0x438, 0x306, 0x439},
+    {0x438, 0x308, 0x4E5}, {0x43A, 0x301, 0x45C}, {0x43E, 0x308, 0x4E7}, {0x443, 0x304, 0x4EF},
+    {0x443, 0x306, 0x45E}, {0x443, 0x308, 0x4F1}, {0x443, 0x30B, 0x4F3}, {0x447, 0x308, 0x4F5},
+    {0x44B, 0x308, 0x4F9}, {0x44D, 0x308, 0x4ED}, {0x456, 0x308, 0x457}, {0x474, 0x30F, 0x476},
+    {0x475, 0x30F, 0x477}, {0x4D8, 0x308, 0x4DA}, {0x4D9, 0x308, 0x4DB}, {0x4E8, 0x308, 0x4EA},
+    {0x4E9, 0x308, 0x4EB}, {0x627, 0x653, 0x622}, {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625},
+    {0x648, 0x654, 0x624}, {0x64A, 0x654, 0x626}, {0x6C1, 0x654, 0x6C2}, {0x6D2, 0x654, 0x6D3},
+    {0x6D5, 0x654, 0x6C0}, {0x928, 0x93C, 0x929}, {0x930, 0x93C, 0x931}, {0x933, 0x93C, 0x934},
+    {0x9C7, 0x9BE, 0x9CB}, {0x9C7, 0x9D7, 0x9CC}, {0xB47, 0xB3E, 0xB4B}, {0xB47, 0xB56, 0xB48},
+    {0xB47, 0xB57, 0xB4C}, {0xB92, 0xBD7, 0xB94}, {0xBC6, 0xBBE, 0xBCA}, {0xBC6, 0xBD7, 0xBCC},
+    {0xBC7, 0xBBE, 0xBCB}, {0xC46, 0xC56, 0xC48}, {0xCBF, 0xCD5, 0xCC0}, {0xCC6, 0xCC2, 0xCCA},
+    {0xCC6, 0xCD5, 0xCC7}, {0xCC6, 0xCD6, 0xCC8}, {0xCCA, 0xCD5, 0xCCB}, {0xD46, 0xD3E, 0xD4A},
+    {0xD46, 0xD57, 0xD4C}, {0xD47, 0xD3E, 0xD4B}, {0xDD9, 0xDCA, 0xDDA}, {0xDD9, 0xDCF, 0xDDC},
+    {0xDD9, 0xDDF, 0xDDE}, {0xDDC, 0xDCA, 0xDDD}, {0x1025, 0x102E, 0x1026}, {0x1B05, 0x1B35, 0x1B06},
+    {0x1B07, 0x1B35, 0x1B08}, {0x1B09, 0x1B35, 0x1B0A}, {0x1B0B, 0x1B35, 0x1B0C},
+    {0x1B0D, 0x1B35, 0x1B0E}, {0x1B11, 0x1B35, 0x1B12}, {0x1B3A, 0x1B35, 0x1B3B},
+    {0x1B3C, 0x1B35, 0x1B3D}, {0x1B3E, 0x1B35, 0x1B40}, {0x1B3F, 0x1B35, 0x1B41},
+    {0x1B42, 0x1B35, 0x1B43}, {0x1E36, 0x304, 0x1E38}, {0x1E37, 0x304, 0x1E39}, {0x1E5A, 0x304, 0x1E5C},
+    {0x1E5B, 0x304, 0x1E5D}, {0x1E62, 0x307, 0x1E68}, {0x1E63, 0x307, 0x1E69}, {0x1EA0, 0x302, 0x1EAC},
+    {0x1EA0, 0x306, 0x1EB6}, {0x1EA1, 0x302, 0x1EAD}, {0x1EA1, 0x306, 0x1EB7}, {0x1EB8, 0x302, 0x1EC6},
+    {0x1EB9, 0x302, 0x1EC7}, {0x1ECC, 0x302, 0x1ED8}, {0x1ECD, 0x302, 0x1ED9}, {0x1F00, 0x300, 0x1F02},
+    {0x1F00, 0x301, 0x1F04}, {0x1F00, 0x342, 0x1F06}, {0x1F00, 0x345, 0x1F80}, {0x1F01, 0x300, 0x1F03},
+    {0x1F01, 0x301, 0x1F05}, {0x1F01, 0x342, 0x1F07}, {0x1F01, 0x345, 0x1F81}, {0x1F02, 0x345, 0x1F82},
+    {0x1F03, 0x345, 0x1F83}, {0x1F04, 0x345, 0x1F84}, {0x1F05, 0x345, 0x1F85}, {0x1F06, 0x345, 0x1F86},
+    {0x1F07, 0x345, 0x1F87}, {0x1F08, 0x300, 0x1F0A}, {0x1F08, 0x301, 0x1F0C}, {0x1F08, 0x342, 0x1F0E},
+    {0x1F08, 0x345, 0x1F88}, {0x1F09, 0x300, 0x1F0B}, {0x1F09, 0x301, 0x1F0D}, {0x1F09, 0x342, 0x1F0F},
+    {0x1F09, 0x345, 0x1F89}, {0x1F0A, 0x345, 0x1F8A}, {0x1F0B, 0x345, 0x1F8B}, {0x1F0C, 0x345, 0x1F8C},
+    {0x1F0D, 0x345, 0x1F8D}, {0x1F0E, 0x345, 0x1F8E}, {0x1F0F, 0x345, 0x1F8F}, {0x1F10, 0x300, 0x1F12},
+    {0x1F10, 0x301, 0x1F14}, {0x1F11, 0x300, 0x1F13}, {0x1F11, 0x301, 0x1F15}, {0x1F18, 0x300, 0x1F1A},
+    {0x1F18, 0x301, 0x1F1C}, {0x1F19, 0x300, 0x1F1B}, {0x1F19, 0x301, 0x1F1D}, {0x1F20, 0x300, 0x1F22},
+    {0x1F20, 0x301, 0x1F24}, {0x1F20, 0x342, 0x1F26}, {0x1F20, 0x345, 0x1F90}, {0x1F21, 0x300, 0x1F23},
+    {0x1F21, 0x301, 0x1F25}, {0x1F21, 0x342, 0x1F27}, {0x1F21, 0x345, 0x1F91}, {0x1F22, 0x345, 0x1F92},
+    {0x1F23, 0x345, 0x1F93}, {0x1F24, 0x345, 0x1F94}, {0x1F25, 0x345, 0x1F95}, {0x1F26, 0x345, 0x1F96},
+    {0x1F27, 0x345, 0x1F97}, {0x1F28, 0x300, 0x1F2A}, {0x1F28, 0x301, 0x1F2C}, {0x1F28, 0x342, 0x1F2E},
+    {0x1F28, 0x345, 0x1F98}, {0x1F29, 0x300, 0x1F2B}, {0x1F29, 0x301, 0x1F2D}, {0x1F29, 0x342, 0x1F2F},
+    {0x1F29, 0x345, 0x1F99}, {0x1F2A, 0x345, 0x1F9A}, {0x1F2B, 0x345, 0x1F9B}, {0x1F2C, 0x345, 0x1F9C},
+    {0x1F2D, 0x345, 0x1F9D}, {0x1F2E, 0x345, 0x1F9E}, {0x1F2F, 0x345, 0x1F9F}, {0x1F30, 0x300, 0x1F32},
+    {0x1F30, 0x301, 0x1F34}, {0x1F30, 0x342, 0x1F36}, {0x1F31, 0x300, 0x1F33}, {0x1F31, 0x301, 0x1F35},
+    {0x1F31, 0x342, 0x1F37}, {0x1F38, 0x300, 0x1F3A}, {0x1F38, 0x301, 0x1F3C}, {0x1F38, 0x342, 0x1F3E},
+    {0x1F39, 0x300, 0x1F3B}, {0x1F39, 0x301, 0x1F3D}, {0x1F39, 0x342, 0x1F3F}, {0x1F40, 0x300, 0x1F42},
+    {0x1F40, 0x301, 0x1F44}, {0x1F41, 0x300, 0x1F43}, {0x1F41, 0x301, 0x1F45}, {0x1F48, 0x300, 0x1F4A},
+    {0x1F48, 0x301, 0x1F4C}, {0x1F49, 0x300, 0x1F4B}, {0x1F49, 0x301, 0x1F4D}, {0x1F50, 0x300, 0x1F52},
+    {0x1F50, 0x301, 0x1F54}, {0x1F50, 0x342, 0x1F56}, {0x1F51, 0x300, 0x1F53}, {0x1F51, 0x301, 0x1F55},
+    {0x1F51, 0x342, 0x1F57}, {0x1F59, 0x300, 0x1F5B}, {0x1F59, 0x301, 0x1F5D}, {0x1F59, 0x342, 0x1F5F},
+    {0x1F60, 0x300, 0x1F62}, {0x1F60, 0x301, 0x1F64}, {0x1F60, 0x342, 0x1F66}, {0x1F60, 0x345, 0x1FA0},
+    {0x1F61, 0x300, 0x1F63}, {0x1F61, 0x301, 0x1F65}, {0x1F61, 0x342, 0x1F67}, {0x1F61, 0x345, 0x1FA1},
+    {0x1F62, 0x345, 0x1FA2}, {0x1F63, 0x345, 0x1FA3}, {0x1F64, 0x345, 0x1FA4}, {0x1F65, 0x345, 0x1FA5},
+    {0x1F66, 0x345, 0x1FA6}, {0x1F67, 0x345, 0x1FA7}, {0x1F68, 0x300, 0x1F6A}, {0x1F68, 0x301, 0x1F6C},
+    {0x1F68, 0x342, 0x1F6E}, {0x1F68, 0x345, 0x1FA8}, {0x1F69, 0x300, 0x1F6B}, {0x1F69, 0x301, 0x1F6D},
+    {0x1F69, 0x342, 0x1F6F}, {0x1F69, 0x345, 0x1FA9}, {0x1F6A, 0x345, 0x1FAA}, {0x1F6B, 0x345, 0x1FAB},
+    {0x1F6C, 0x345, 0x1FAC}, {0x1F6D, 0x345, 0x1FAD}, {0x1F6E, 0x345, 0x1FAE}, {0x1F6F, 0x345, 0x1FAF},
+    {0x1F70, 0x345, 0x1FB2}, {0x1F74, 0x345, 0x1FC2}, {0x1F7C, 0x345, 0x1FF2}, {0x1FB6, 0x345, 0x1FB7},
+    {0x1FBF, 0x300, 0x1FCD}, {0x1FBF, 0x301, 0x1FCE}, {0x1FBF, 0x342, 0x1FCF}, {0x1FC6, 0x345, 0x1FC7},
+    {0x1FF6, 0x345, 0x1FF7}, {0x1FFE, 0x300, 0x1FDD}, {0x1FFE, 0x301, 0x1FDE}, {0x1FFE, 0x342, 0x1FDF},
+    {0x2190, 0x338, 0x219A}, {0x2192, 0x338, 0x219B}, {0x2194, 0x338, 0x21AE}, {0x21D0, 0x338, 0x21CD},
+    {0x21D2, 0x338, 0x21CF}, {0x21D4, 0x338, 0x21CE}, {0x2203, 0x338, 0x2204}, {0x2208, 0x338, 0x2209},
+    {0x220B, 0x338, 0x220C}, {0x2223, 0x338, 0x2224}, {0x2225, 0x338, 0x2226}, {0x223C, 0x338, 0x2241},
+    {0x2243, 0x338, 0x2244}, {0x2245, 0x338, 0x2247}, {0x2248, 0x338, 0x2249}, {0x224D, 0x338, 0x226D},
+    {0x2261, 0x338, 0x2262}, {0x2264, 0x338, 0x2270}, {0x2265, 0x338, 0x2271}, {0x2272, 0x338, 0x2274},
+    {0x2273, 0x338, 0x2275}, {0x2276, 0x338, 0x2278}, {0x2277, 0x338, 0x2279}, {0x227A, 0x338, 0x2280},
+    {0x227B, 0x338, 0x2281}, {0x227C, 0x338, 0x22E0}, {0x227D, 0x338, 0x22E1}, {0x2282, 0x338, 0x2284},
+    {0x2283, 0x338, 0x2285}, {0x2286, 0x338, 0x2288}, {0x2287, 0x338, 0x2289}, {0x2291, 0x338, 0x22E2},
+    {0x2292, 0x338, 0x22E3}, {0x22A2, 0x338, 0x22AC}, {0x22A8, 0x338, 0x22AD}, {0x22A9, 0x338, 0x22AE},
+    {0x22AB, 0x338, 0x22AF}, {0x22B2, 0x338, 0x22EA}, {0x22B3, 0x338, 0x22EB}, {0x22B4, 0x338, 0x22EC},
+    {0x22B5, 0x338, 0x22ED}, {0x3046, 0x3099, 0x3094}, {0x304B, 0x3099, 0x304C},
+    {0x304D, 0x3099, 0x304E}, {0x304F, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052},
+    {0x3053, 0x3099, 0x3054}, {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A}, {0x305B, 0x3099, 0x305C}, {0x305D, 0x3099, 0x305E},
+    {0x305F, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306F, 0x3099, 0x3070},
+    {0x306F, 0x309A, 0x3071}, {0x3072, 0x3099, 0x3073}, {0x3072, 0x309A, 0x3074},
+    {0x3075, 0x3099, 0x3076}, {0x3075, 0x309A, 0x3077}, {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309A, 0x307A}, {0x307B, 0x3099, 0x307C}, {0x307B, 0x309A, 0x307D},
+    {0x309D, 0x3099, 0x309E}, {0x30A6, 0x3099, 0x30F4}, {0x30AB, 0x3099, 0x30AC},
+    {0x30AD, 0x3099, 0x30AE}, {0x30AF, 0x3099, 0x30B0}, {0x30B1, 0x3099, 0x30B2},
+    {0x30B3, 0x3099, 0x30B4}, {0x30B5, 0x3099, 0x30B6}, {0x30B7, 0x3099, 0x30B8},
+    {0x30B9, 0x3099, 0x30BA}, {0x30BB, 0x3099, 0x30BC}, {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0}, {0x30C1, 0x3099, 0x30C2}, {0x30C4, 0x3099, 0x30C5},
+    {0x30C6, 0x3099, 0x30C7}, {0x30C8, 0x3099, 0x30C9}, {0x30CF, 0x3099, 0x30D0},
+    {0x30CF, 0x309A, 0x30D1}, {0x30D2, 0x3099, 0x30D3}, {0x30D2, 0x309A, 0x30D4},
+    {0x30D5, 0x3099, 0x30D6}, {0x30D5, 0x309A, 0x30D7}, {0x30D8, 0x3099, 0x30D9},
+    {0x30D8, 0x309A, 0x30DA}, {0x30DB, 0x3099, 0x30DC}, {0x30DB, 0x309A, 0x30DD},
+    {0x30EF, 0x3099, 0x30F7}, {0x30F0, 0x3099, 0x30F8}, {0x30F1, 0x3099, 0x30F9},
+    {0x30F2, 0x3099, 0x30FA}, {0x30FD, 0x3099, 0x30FE}, {0x11099, 0x110BA, 0x1109A},
+    {0x1109B, 0x110BA, 0x1109C}, {0x110A5, 0x110BA, 0x110AB}, {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F}, {0x11347, 0x1133E, 0x1134B}, {0x11347, 0x11357, 0x1134C},
+    {0x114B9, 0x114B0, 0x114BC}, {0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA}, {0x115B9, 0x115AF, 0x115BB}, {0x11935, 0x11930, 0x11938},
+};
+
+//NOTE: Grapheme_Cluster_Break values (UAX #29). Extended_Pictographic is
+//folded in as one more value since those codepoints are all Other.
+//Codepoints not listed are Other. Hangul syllables (LV, LVT) are computed.
+#define UTF8_GCB_OTHER          0
+#define UTF8_GCB_CR             1
+#define UTF8_GCB_LF             2
+#define UTF8_GCB_CONTROL        3
+#define UTF8_GCB_EXTEND         4
+#define UTF8_GCB_ZWJ            5
+#define UTF8_GCB_RI             6
+#define UTF8_GCB_PREPEND        7
+#define UTF8_GCB_SPACINGMARK    8
+#define UTF8_GCB_L              9
+#define UTF8_GCB_V              10
+#define UTF8_GCB_T              11
+#define UTF8_GCB_LV             12
+#define UTF8_GCB_LVT            13
+#define UTF8_GCB_EXT_PICT       14
+
+typedef struct utf8_grapheme_range {
+    unsigned int first;
+    unsigned int last;
+    unsigned char prop;
+} utf8_grapheme_range;
+
+static const utf8_grapheme_range utf8_grapheme_table[] = {
+    {0x0, 0x9, UTF8_GCB_CONTROL}, {0xA, 0xA, UTF8_GCB_LF}, {0xB, 0xC, UTF8_GCB_CONTROL},
+    {0xD, 0xD, UTF8_GCB_CR}, {0xE, 0x1F, UTF8_GCB_CONTROL}, {0x7F, 0x9F, UTF8_GCB_CONTROL},
+    {0xA9, 0xA9, UTF8_GCB_EXT_PICT}, {0xAD, 0xAD, UTF8_GCB_CONTROL}, {0xAE, 0xAE, UTF8_GCB_EXT_PICT},
+    {0x300, 0x36F, UTF8_GCB_EXTEND}, {0x483, 0x489, UTF8_GCB_EXTEND}, {0x591, 0x5BD, UTF8_GCB_EXTEND},
+    {0x5BF, 0x5BF, UTF8_GCB_EXTEND}, {0x5C1, 0x5C2, UTF8_GCB_EXTEND}, {0x5C4, 0x5C5, UTF8_GCB_EXTEND},
+    {0x5C7, 0x5C7, UTF8_GCB_EXTEND}, {0x600, 0x605, UTF8_GCB_PREPEND}, {0x610, 0x61A, UTF8_GCB_EXTEND},
+    {0x61C, 0x61C, UTF8_GCB_CONTROL}, {0x64B, 0x65F, UTF8_GCB_EXTEND}, {0x670, 0x670, UTF8_GCB_EXTEND},
+    {0x6D6, 0x6DC, UTF8_GCB_EXTEND}, {0x6DD, 0x6DD, UTF8_GCB_PREPEND}, {0x6DF, 0x6E4, UTF8_GCB_EXTEND},
+    {0x6E7, 0x6E8, UTF8_GCB_EXTEND}, {0x6EA, 0x6ED, UTF8_GCB_EXTEND}, {0x70F, 0x70F, UTF8_GCB_PREPEND},
+    {0x711, 0x711, UTF8_GCB_EXTEND}, {0x730, 0x74A, UTF8_GCB_EXTEND}, {0x7A6, 0x7B0, UTF8_GCB_EXTEND},
+    {0x7EB, 0x7F3, UTF8_GCB_EXTEND}, {0x7FD, 0x7FD, UTF8_GCB_EXTEND}, {0x816, 0x819, UTF8_GCB_EXTEND},
+    {0x81B, 0x823, UTF8_GCB_EXTEND}, {0x825, 0x827, UTF8_GCB_EXTEND}, {0x829, 0x82D, UTF8_GCB_EXTEND},
+    {0x859, 0x85B, UTF8_GCB_EXTEND}, {0x890, 0x891, UTF8_GCB_PREPEND}, {0x898, 0x89F, UTF8_GCB_EXTEND},
+    {0x8CA, 0x8E1, UTF8_GCB_EXTEND}, {0x8E2, 0x8E2, UTF8_GCB_PREPEND}, {0x8E3, 0x902, UTF8_GCB_EXTEND},
+    {0x903, 0x903, UTF8_GCB_SPACINGMARK}, {0x93A, 0x93A, UTF8_GCB_EXTEND},
+    {0x93B, 0x93B, UTF8_GCB_SPACINGMARK}, {0x93C, 0x93C, UTF8_GCB_EXTEND},
+    {0x93E, 0x940, UTF8_GCB_SPACINGMARK}, {0x941, 0x948, UTF8_GCB_EXTEND},
+    {0x949, 0x94C, UTF8_GCB_SPACINGMARK}, {0x94D, 0x94D, UTF8_GCB_EXTEND},
+    {0x94E, 0x94F, UTF8_GCB_SPACINGMARK}, {0x951, 0x957, UTF8_GCB_EXTEND},
+    {0x962, 0x963, UTF8_GCB_EXTEND}, {0x981, 0x981, UTF8_GCB_EXTEND},
+    {0x982, 0x983, UTF8_GCB_SPACINGMARK}, {0x9BC, 0x9BC, UTF8_GCB_EXTEND},
+    {0x9BE, 0x9BE, UTF8_GCB_EXTEND}, {0x9BF, 0x9C0, UTF8_GCB_SPACINGMARK},
+    {0x9C1, 0x9C4, UTF8_GCB_EXTEND}, {0x9C7, 0x9C8, UTF8_GCB_SPACINGMARK},
+    {0x9CB, 0x9CC, UTF8_GCB_SPACINGMARK}, {0x9CD, 0x9CD, UTF8_GCB_EXTEND},
+    {0x9D7, 0x9D7, UTF8_GCB_EXTEND}, {0x9E2, 0x9E3, UTF8_GCB_EXTEND}, {0x9FE, 0x9FE, UTF8_GCB_EXTEND},
+    {0xA01, 0xA02, UTF8_GCB_EXTEND}, {0xA03, 0xA03, UTF8_GCB_SPACINGMARK},
+    {0xA3C, 0xA3C, UTF8_GCB_EXTEND}, {0xA3E, 0xA40, UTF8_GCB_SPACINGMARK},
+    {0xA41, 0xA42, UTF8_GCB_EXTEND}, {0xA47, 0xA48, UTF8_GCB_EXTEND}, {0xA4B, 0xA4D, UTF8_GCB_EXTEND},
+    {0xA51, 0xA51, UTF8_GCB_EXTEND}, {0xA70, 0xA71, UTF8_GCB_EXTEND}, {0xA75, 0xA75, UTF8_GCB_EXTEND},
+    {0xA81, 0xA82, UTF8_GCB_EXTEND}, {0xA83, 0xA83, UTF8_GCB_SPACINGMARK},
+    {0xABC, 0xABC, UTF8_GCB_EXTEND}, {0xABE, 0xAC0, UTF8_GCB_SPACINGMARK},
+    {0xAC1, 0xAC5, UTF8_GCB_EXTEND}, {0xAC7, 0xAC8, UTF8_GCB_EXTEND},
+    {0xAC9, 0xAC9, UTF8_GCB_SPACINGMARK}, {0xACB, 0xACC, UTF8_GCB_SPACINGMARK},
+    {0xACD, 0xACD, UTF8_GCB_EXTEND}, {0xAE2, 0xAE3, UTF8_GCB_EXTEND}, {0xAFA, 0xAFF, UTF8_GCB_EXTEND},
+    {0xB01, 0xB01, UTF8_GCB_EXTEND}, {0xB02, 0xB03, UTF8_GCB_SPACINGMARK},
+    {0xB3C, 0xB3C, UTF8_GCB_EXTEND}, {0xB3E, 0xB3F, UTF8_GCB_EXTEND},
+    {0xB40, 0xB40, UTF8_GCB_SPACINGMARK}, {0xB41, 0xB44, UTF8_GCB_EXTEND},
+    {0xB47, 0xB48, UTF8_GCB_SPACINGMARK}, {0xB4B, 0xB4C, UTF8_GCB_SPACINGMARK},
+    {0xB4D, 0xB4D, UTF8_GCB_EXTEND}, {0xB55, 0xB57, UTF8_GCB_EXTEND}, {0xB62, 0xB63, UTF8_GCB_EXTEND},
+    {0xB82, 0xB82, UTF8_GCB_EXTEND}, {0xBBE, 0xBBE, UTF8_GCB_EXTEND},
+    {0xBBF, 0xBBF, UTF8_GCB_SPACINGMARK}, {0xBC0, 0xBC0, UTF8_GCB_EXTEND},
+    {0xBC1, 0xBC2, UTF8_GCB_SPACINGMARK}, {0xBC6, 0xBC8, UTF8_GCB_SPACINGMARK},
+    {0xBCA, 0xBCC, UTF8_GCB_SPACINGMARK}, {0xBCD, 0xBCD, UTF8_GCB_EXTEND},
+    {0xBD7, 0xBD7, UTF8_GCB_EXTEND}, {0xC00, 0xC00, UTF8_GCB_EXTEND},
+    {0xC01, 0xC03, UTF8_GCB_SPACINGMARK}, {0xC04, 0xC04, UTF8_GCB_EXTEND},
+    {0xC3C, 0xC3C, UTF8_GCB_EXTEND}, {0xC3E, 0xC40, UTF8_GCB_EXTEND},
+    {0xC41, 0xC44, UTF8_GCB_SPACINGMARK}, {0xC46, 0xC48, UTF8_GCB_EXTEND},
+    {0xC4A, 0xC4D, UTF8_GCB_EXTEND}, {0xC55, 0xC56, UTF8_GCB_EXTEND}, {0xC62, 0xC63, UTF8_GCB_EXTEND},
+    {0xC81, 0xC81, UTF8_GCB_EXTEND}, {0xC82, 0xC83, UTF8_GCB_SPACINGMARK},
+    {0xCBC, 0xCBC, UTF8_GCB_EXTEND}, {0xCBE, 0xCBE, UTF8_GCB_SPACINGMARK},
+    {0xCBF, 0xCBF, UTF8_GCB_EXTEND}, {0xCC0, 0xCC1, UTF8_GCB_SPACINGMARK},
+    {0xCC2, 0xCC2, UTF8_GCB_EXTEND}, {0xCC3, 0xCC4, UTF8_GCB_SPACINGMARK},
+    {0xCC6, 0xCC6, UTF8_GCB_EXTEND}, {0xCC7, 0xCC8, UTF8_GCB_SPACINGMARK},
+    {0xCCA, 0xCCB, UTF8_GCB_SPACINGMARK}, {0xCCC, 0xCCD, UTF8_GCB_EXTEND},
+    {0xCD5, 0xCD6, UTF8_GCB_EXTEND}, {0xCE2, 0xCE3, UTF8_GCB_EXTEND}, {0xD00, 0xD01, UTF8_GCB_EXTEND},
+    {0xD02, 0xD03, UTF8_GCB_SPACINGMARK}, {0xD3B, 0xD3C, UTF8_GCB_EXTEND},
+    {0xD3E, 0xD3E, UTF8_GCB_EXTEND}, {0xD3F, 0xD40, UTF8_GCB_SPACINGMARK},
+    {0xD41, 0xD44, UTF8_GCB_EXTEND}, {0xD46, 0xD48, UTF8_GCB_SPACINGMARK},
+    {0xD4A, 0xD4C, UTF8_GCB_SPACINGMARK}, {0xD4D, 0xD4D, UTF8_GCB_EXTEND},
+    {0xD4E, 0xD4E, UTF8_GCB_PREPEND}, {0xD57, 0xD57, UTF8_GCB_EXTEND}, {0xD62, 0xD63, UTF8_GCB_EXTEND},
+    {0xD81, 0xD81, UTF8_GCB_EXTEND}, {0xD82, 0xD83, UTF8_GCB_SPACINGMARK},
+    {0xDCA, 0xDCA, UTF8_GCB_EXTEND}, {0xDCF, 0xDCF, UTF8_GCB_EXTEND},
+    {0xDD0, 0xDD1, UTF8_GCB_SPACINGMARK}, {0xDD2, 0xDD4, UTF8_GCB_EXTEND},
+    {0xDD6, 0xDD6, UTF8_GCB_EXTEND}, {0xDD8, 0xDDE, UTF8_GCB_SPACINGMARK},
+    {0xDDF, 0xDDF, UTF8_GCB_EXTEND}, {0xDF2, 0xDF3, UTF8_GCB_SPACINGMARK},
+    {0xE31, 0xE31, UTF8_GCB_EXTEND}, {0xE33, 0xE33, UTF8_GCB_SPACINGMARK},
+    {0xE34, 0xE3A, UTF8_GCB_EXTEND}, {0xE47, 0xE4E, UTF8_GCB_EXTEND}, {0xEB1, 0xEB1, UTF8_GCB_EXTEND},
+    {0xEB3, 0xEB3, UTF8_GCB_SPACINGMARK}, {0xEB4, 0xEBC, UTF8_GCB_EXTEND},
+    {0xEC8, 0xECD, UTF8_GCB_EXTEND}, {0xF18, 0xF19, UTF8_GCB_EXTEND}, {0xF35, 0xF35, UTF8_GCB_EXTEND},
+    {0xF37, 0xF37, UTF8_GCB_EXTEND}, {0xF39, 0xF39, UTF8_GCB_EXTEND},
+    {0xF3E, 0xF3F, UTF8_GCB_SPACINGMARK}, {0xF71, 0xF7E, UTF8_GCB_EXTEND},
+    {0xF7F, 0xF7F, UTF8_GCB_SPACINGMARK}, {0xF80, 0xF84, UTF8_GCB_EXTEND},
+    {0xF86, 0xF87, UTF8_GCB_EXTEND}, {0xF8D, 0xF97, UTF8_GCB_EXTEND}, {0xF99, 0xFBC, UTF8_GCB_EXTEND},
+    {0xFC6, 0xFC6, UTF8_GCB_EXTEND}, {0x102D, 0x1030, UTF8_GCB_EXTEND},
+    {0x1031, 0x1031, UTF8_GCB_SPACINGMARK}, {0x1032, 0x1037, UTF8_GCB_EXTEND},
+    {0x1039, 0x103A, UTF8_GCB_EXTEND}, {0x103B, 0x103C, UTF8_GCB_SPACINGMARK},
+    {0x103D, 0x103E, UTF8_GCB_EXTEND}, {0x1056, 0x1057, UTF8_GCB_SPACINGMARK},
+    {0x1058, 0x1059, UTF8_GCB_EXTEND}, {0x105E, 0x1060, UTF8_GCB_EXTEND},
+    {0x1071, 0x1074, UTF8_GCB_EXTEND}, {0x1082, 0x1082, UTF8_GCB_EXTEND},
+    {0x1084, 0x1084, UTF8_GCB_SPACINGMARK}, {0x1085, 0x1086, UTF8_GCB_EXTEND},
+    {0x108D, 0x108D, UTF8_GCB_EXTEND}, {0x109D, 0x109D, UTF8_GCB_EXTEND}, {0x1100, 0x115F, UTF8_GCB_L},
+    {0x1160, 0x11A7, UTF8_GCB_V}, {0x11A8, 0x11FF, UTF8_GCB_T}, {0x135D, 0x135F, UTF8_GCB_EXTEND},
+    {0x1712, 0x1714, UTF8_GCB_EXTEND}, {0x1715, 0x1715, UTF8_GCB_SPACINGMARK},
+    {0x1732, 0x1733, UTF8_GCB_EXTEND}, {0x1734, 0x1734, UTF8_GCB_SPACINGMARK},
+    {0x1752, 0x1753, UTF8_GCB_EXTEND}, {0x1772, 0x1773, UTF8_GCB_EXTEND},
+    {0x17B4, 0x17B5, UTF8_GCB_EXTEND}, {0x17B6, 0x17B6, UTF8_GCB_SPACINGMARK},
+    {0x17B7, 0x17BD, UTF8_GCB_EXTEND}, {0x17BE, 0x17C5, UTF8_GCB_SPACINGMARK},
+    {0x17C6, 0x17C6, UTF8_GCB_EXTEND}, {0x17C7, 0x17C8, UTF8_GCB_SPACINGMARK},
+    {0x17C9, 0x17D3, UTF8_GCB_EXTEND}, {0x17DD, 0x17DD, UTF8_GCB_EXTEND},
+    {0x180B, 0x180D, UTF8_GCB_EXTEND}, {0x180E, 0x180E, UTF8_GCB_CONTROL},
+    {0x180F, 0x180F, UTF8_GCB_EXTEND}, {0x1885, 0x1886, UTF8_GCB_EXTEND},
+    {0x18A9, 0x18A9, UTF8_GCB_EXTEND}, {0x1920, 0x1922, UTF8_GCB_EXTEND},
+    {0x1923, 0x1926, UTF8_GCB_SPACINGMARK}, {0x1927, 0x1928, UTF8_GCB_EXTEND},
+    {0x1929, 0x192B, UTF8_GCB_SPACINGMARK}, {0x1930, 0x1931, UTF8_GCB_SPACINGMARK},
+    {0x1932, 0x1932, UTF8_GCB_EXTEND}, {0x1933, 0x1938, UTF8_GCB_SPACINGMARK},
+    {0x1939, 0x193B, UTF8_GCB_EXTEND}, {0x1A17, 0x1A18, UTF8_GCB_EXTEND},
+    {0x1A19, 0x1A1A, UTF8_GCB_SPACINGMARK}, {0x1A1B, 0x1A1B, UTF8_GCB_EXTEND},
+    {0x1A55, 0x1A55, UTF8_GCB_SPACINGMARK}, {0x1A56, 0x1A56, UTF8_GCB_EXTEND},
+    {0x1A57, 0x1A57, UTF8_GCB_SPACINGMARK}, {0x1A58, 0x1A5E, UTF8_GCB_EXTEND},
+    {0x1A60, 0x1A60, UTF8_GCB_EXTEND}, {0x1A62, 0x1A62, UTF8_GCB_EXTEND},
+    {0x1A65, 0x1A6C, UTF8_GCB_EXTEND}, {0x1A6D, 0x1A72, UTF8_GCB_SPACINGMARK},
+    {0x1A73, 0x1A7C, UTF8_GCB_EXTEND}, {0x1A7F, 0x1A7F, UTF8_GCB_EXTEND},
+    {0x1AB0, 0x1ACE, UTF8_GCB_EXTEND}, {0x1B00, 0x1B03, UTF8_GCB_EXTEND},
+    {0x1B04, 0x1B04, UTF8_GCB_SPACINGMARK}, {0x1B34, 0x1B3A, UTF8_GCB_EXTEND},
+    {0x1B3B, 0x1B3B, UTF8_GCB_SPACINGMARK}, {0x1B3C, 0x1B3C, UTF8_GCB_EXTEND},
+    {0x1B3D, 0x1B41, UTF8_GCB_SPACINGMARK}, {0x1B42, 0x1B42, UTF8_GCB_EXTEND},
+    {0x1B43, 0x1B44, UTF8_GCB_SPACINGMARK}, {0x1B6B, 0x1B73, UTF8_GCB_EXTEND},
+    {0x1B80, 0x1B81, UTF8_GCB_EXTEND}, {0x1B82, 0x1B82, UTF8_GCB_SPACINGMARK},
+    {0x1BA1, 0x1BA1, UTF8_GCB_SPACINGMARK}, {0x1BA2, 0x1BA5, UTF8_GCB_EXTEND},
+    {0x1BA6, 0x1BA7, UTF8_GCB_SPACINGMARK}, {0x1BA8, 0x1BA9, UTF8_GCB_EXTEND},
+    {0x1BAA, 0x1BAA, UTF8_GCB_SPACINGMARK}, {0x1BAB, 0x1BAD, UTF8_GCB_EXTEND},
+    {0x1BE6, 0x1BE6, UTF8_GCB_EXTEND}, {0x1BE7, 0x1BE7, UTF8_GCB_SPACINGMARK},
+    {0x1BE8, 0x1BE9, UTF8_GCB_EXTEND}, {0x1BEA, 0x1BEC, UTF8_GCB_SPACINGMARK},
+    {0x1BED, 0x1BED, UTF8_GCB_EXTEND}, {0x1BEE, 0x1BEE, UTF8_GCB_SPACINGMARK},
+    {0x1BEF, 0x1BF1, UTF8_GCB_EXTEND}, {0x1BF2, 0x1BF3, UTF8_GCB_SPACINGMARK},
+    {0x1C24, 0x1C2B, UTF8_GCB_SPACINGMARK}, {0x1C2C, 0x1C33, UTF8_GCB_EXTEND},
+    {0x1C34, 0x1C35, UTF8_GCB_SPACINGMARK}, {0x1C36, 0x1C37, UTF8_GCB_EXTEND},
+    {0x1CD0, 0x1CD2, UTF8_GCB_EXTEND}, {0x1CD4, 0x1CE0, UTF8_GCB_EXTEND},
+    {0x1CE1, 0x1CE1, UTF8_GCB_SPACINGMARK}, {0x1CE2, 0x1CE8, UTF8_GCB_EXTEND},
+    {0x1CED, 0x1CED, UTF8_GCB_EXTEND}, {0x1CF4, 0x1CF4, UTF8_GCB_EXTEND},
+    {0x1CF7, 0x1CF7, UTF8_GCB_SPACINGMARK}, {0x1CF8, 0x1CF9, UTF8_GCB_EXTEND},
+    {0x1DC0, 0x1DFF, UTF8_GCB_EXTEND}, {0x200B, 0x200B, UTF8_GCB_CONTROL},
+    {0x200C, 0x200C, UTF8_GCB_EXTEND}, {0x200D, 0x200D, UTF8_GCB_ZWJ},
+    {0x200E, 0x200F, UTF8_GCB_CONTROL}, {0x2028, 0x202E, UTF8_GCB_CONTROL},
+    {0x203C, 0x203C, UTF8_GCB_EXT_PICT}, {0x2049, 0x2049, UTF8_GCB_EXT_PICT},
+    {0x2060, 0x206F, UTF8_GCB_CONTROL}, {0x20D0, 0x20F0, UTF8_GCB_EXTEND},
+    {0x2122, 0x2122, UTF8_GCB_EXT_PICT}, {0x2139, 0x2139, UTF8_GCB_EXT_PICT},
+    {0x2194, 0x2199, UTF8_GCB_EXT_PICT}, {0x21A9, 0x21AA, UTF8_GCB_EXT_PICT},
+    {0x231A, 0x231B, UTF8_GCB_EXT_PICT}, {0x2328, 0x2328, UTF8_GCB_EXT_PICT},
+    {0x2388, 0x2388, UTF8_GCB_EXT_PICT}, {0x23CF, 0x23CF, UTF8_GCB_EXT_PICT},
+    {0x23E9, 0x23F3, UTF8_GCB_EXT_PICT}, {0x23F8, 0x23FA, UTF8_GCB_EXT_PICT},
+    {0x24C2, 0x24C2, UTF8_GCB_EXT_PICT}, {0x25AA, 0x25AB, UTF8_GCB_EXT_PICT},
+    {0x25B6, 0x25B6, UTF8_GCB_EXT_PICT}, {0x25C0, 0x25C0, UTF8_GCB_EXT_PICT},
+    {0x25FB, 0x25FE, UTF8_GCB_EXT_PICT}, {0x2600, 0x2605, UTF8_GCB_EXT_PICT},
+    {0x2607, 0x2612, UTF8_GCB_EXT_PICT}, {0x2614, 0x2685, UTF8_GCB_EXT_PICT},
+    {0x2690, 0x2705, UTF8_GCB_EXT_PICT}, {0x2708, 0x2712, UTF8_GCB_EXT_PICT},
+    {0x2714, 0x2714, UTF8_GCB_EXT_PICT}, {0x2716, 0x2716, UTF8_GCB_EXT_PICT},
+    {0x271D, 0x271D, UTF8_GCB_EXT_PICT}, {0x2721, 0x2721, UTF8_GCB_EXT_PICT},
+    {0x2728, 0x2728, UTF8_GCB_EXT_PICT}, {0x2733, 0x2734, UTF8_GCB_EXT_PICT},
+    {0x2744, 0x2744, UTF8_GCB_EXT_PICT}, {0x2747, 0x2747, UTF8_GCB_EXT_PICT},
+    {0x274C, 0x274C, UTF8_GCB_EXT_PICT}, {0x274E, 0x274E, UTF8_GCB_EXT_PICT},
+    {0x2753, 0x2755, UTF8_GCB_EXT_PICT}, {0x2757, 0x2757, UTF8_GCB_EXT_PICT},
+    {0x2763, 0x2767, UTF8_GCB_EXT_PICT}, {0x2795, 0x2797, UTF8_GCB_EXT_PICT},
+    {0x27A1, 0x27A1, UTF8_GCB_EXT_PICT}, {0x27B0, 0x27B0, UTF8_GCB_EXT_PICT},
+    {0x27BF, 0x27BF, UTF8_GCB_EXT_PICT}, {0x2934, 0x2935, UTF8_GCB_EXT_PICT},
+    {0x2B05, 0x2B07, UTF8_GCB_EXT_PICT}, {0x2B1B, 0x2B1C, UTF8_GCB_EXT_PICT},
+    {0x2B50, 0x2B50, UTF8_GCB_EXT_PICT}, {0x2B55, 0x2B55, UTF8_GCB_EXT_PICT},
+    {0x2CEF, 0x2CF1, UTF8_GCB_EXTEND}, {0x2D7F, 0x2D7F, UTF8_GCB_EXTEND},
+    {0x2DE0, 0x2DFF, UTF8_GCB_EXTEND}, {0x302A, 0x302F, UTF8_GCB_EXTEND},
+    {0x3030, 0x3030, UTF8_GCB_EXT_PICT}, {0x303D, 0x303D, UTF8_GCB_EXT_PICT},
+    {0x3099, 0x309A, UTF8_GCB_EXTEND}, {0x3297, 0x3297, UTF8_GCB_EXT_PICT},
+    {0x3299, 0x3299, UTF8_GCB_EXT_PICT}, {0xA66F, 0xA672, UTF8_GCB_EXTEND},
+    {0xA674, 0xA67D, UTF8_GCB_EXTEND}, {0xA69E, 0xA69F, UTF8_GCB_EXTEND},
+    {0xA6F0, 0xA6F1, UTF8_GCB_EXTEND}, {0xA802, 0xA802, UTF8_GCB_EXTEND},
+    {0xA806, 0xA806, UTF8_GCB_EXTEND}, {0xA80B, 0xA80B, UTF8_GCB_EXTEND},
+    {0xA823, 0xA824, UTF8_GCB_SPACINGMARK}, {0xA825, 0xA826, UTF8_GCB_EXTEND},
+    {0xA827, 0xA827, UTF8_GCB_SPACINGMARK}, {0xA82C, 0xA82C, UTF8_GCB_EXTEND},
+    {0xA880, 0xA881, UTF8_GCB_SPACINGMARK}, {0xA8B4, 0xA8C3, UTF8_GCB_SPACINGMARK},
+    {0xA8C4, 0xA8C5, UTF8_GCB_EXTEND}, {0xA8E0, 0xA8F1, UTF8_GCB_EXTEND},
+    {0xA8FF, 0xA8FF, UTF8_GCB_EXTEND}, {0xA926, 0xA92D, UTF8_GCB_EXTEND},
+    {0xA947, 0xA951, UTF8_GCB_EXTEND}, {0xA952, 0xA953, UTF8_GCB_SPACINGMARK},
+    {0xA960, 0xA97C, UTF8_GCB_L}, {0xA980, 0xA982, UTF8_GCB_EXTEND},
+    {0xA983, 0xA983, UTF8_GCB_SPACINGMARK}, {0xA9B3, 0xA9B3, UTF8_GCB_EXTEND},
+    {0xA9B4, 0xA9B5, UTF8_GCB_SPACINGMARK}, {0xA9B6, 0xA9B9, UTF8_GCB_EXTEND},
+    {0xA9BA, 0xA9BB, UTF8_GCB_SPACINGMARK}, {0xA9BC, 0xA9BD, UTF8_GCB_EXTEND},
+    {0xA9BE, 0xA9C0, UTF8_GCB_SPACINGMARK}, {0xA9E5, 0xA9E5, UTF8_GCB_EXTEND},
+    {0xAA29, 0xAA2E, UTF8_GCB_EXTEND}, {0xAA2F, 0xAA30, UTF8_GCB_SPACINGMARK},
+    {0xAA31, 0xAA32, UTF8_GCB_EXTEND}, {0xAA33, 0xAA34, UTF8_GCB_SPACINGMARK},
+    {0xAA35, 0xAA36, UTF8_GCB_EXTEND}, {0xAA43, 0xAA43, UTF8_GCB_EXTEND},
+    {0xAA4C, 0xAA4C, UTF8_GCB_EXTEND}, {0xAA4D, 0xAA4D, UTF8_GCB_SPACINGMARK},
+    {0xAA7C, 0xAA7C, UTF8_GCB_EXTEND}, {0xAAB0, 0xAAB0, UTF8_GCB_EXTEND},
+    {0xAAB2, 0xAAB4, UTF8_GCB_EXTEND}, {0xAAB7, 0xAAB8, UTF8_GCB_EXTEND},
+    {0xAABE, 0xAABF, UTF8_GCB_EXTEND}, {0xAAC1, 0xAAC1, UTF8_GCB_EXTEND},
+    {0xAAEB, 0xAAEB, UTF8_GCB_SPACINGMARK}, {0xAAEC, 0xAAED, UTF8_GCB_EXTEND},
+    {0xAAEE, 0xAAEF, UTF8_GCB_SPACINGMARK}, {0xAAF5, 0xAAF5, UTF8_GCB_SPACINGMARK},
+    {0xAAF6, 0xAAF6, UTF8_GCB_EXTEND}, {0xABE3, 0xABE4, UTF8_GCB_SPACINGMARK},
+    {0xABE5, 0xABE5, UTF8_GCB_EXTEND}, {0xABE6, 0xABE7, UTF8_GCB_SPACINGMARK},
+    {0xABE8, 0xABE8, UTF8_GCB_EXTEND}, {0xABE9, 0xABEA, UTF8_GCB_SPACINGMARK},
+    {0xABEC, 0xABEC, UTF8_GCB_SPACINGMARK}, {0xABED, 0xABED, UTF8_GCB_EXTEND},
+    {0xD7B0, 0xD7C6, UTF8_GCB_V}, {0xD7CB, 0xD7FB, UTF8_GCB_T}, {0xFB1E, 0xFB1E, UTF8_GCB_EXTEND},
+    {0xFE00, 0xFE0F, UTF8_GCB_EXTEND}, {0xFE20, 0xFE2F, UTF8_GCB_EXTEND},
+    {0xFEFF, 0xFEFF, UTF8_GCB_CONTROL}, {0xFF9E, 0xFF9F, UTF8_GCB_EXTEND},
+    {0xFFF0, 0xFFFB, UTF8_GCB_CONTROL}, {0x101FD, 0x101FD, UTF8_GCB_EXTEND},
+    {0x102E0, 0x102E0, UTF8_GCB_EXTEND}, {0x10376, 0x1037A, UTF8_GCB_EXTEND},
+    {0x10A01, 0x10A03, UTF8_GCB_EXTEND}, {0x10A05, 0x10A06, UTF8_GCB_EXTEND},
+    {0x10A0C, 0x10A0F, UTF8_GCB_EXTEND}, {0x10A38, 0x10A3A, UTF8_GCB_EXTEND},
+    {0x10A3F, 0x10A3F, UTF8_GCB_EXTEND}, {0x10AE5, 0x10AE6, UTF8_GCB_EXTEND},
+    {0x10D24, 0x10D27, UTF8_GCB_EXTEND}, {0x10EAB, 0x10EAC, UTF8_GCB_EXTEND},
+    {0x10F46, 0x10F50, UTF8_GCB_EXTEND}, {0x10F82, 0x10F85, UTF8_GCB_EXTEND},
+    {0x11000, 0x11000, UTF8_GCB_SPACINGMARK}, {0x11001, 0x11001, UTF8_GCB_EXTEND},
+    {0x11002, 0x11002, UTF8_GCB_SPACINGMARK}, {0x11038, 0x11046, UTF8_GCB_EXTEND},
+    {0x11070, 0x11070, UTF8_GCB_EXTEND}, {0x11073, 0x11074, UTF8_GCB_EXTEND},
+    {0x1107F, 0x11081, UTF8_GCB_EXTEND}, {0x11082, 0x11082, UTF8_GCB_SPACINGMARK},
+    {0x110B0, 0x110B2, UTF8_GCB_SPACINGMARK}, {0x110B3, 0x110B6, UTF8_GCB_EXTEND},
+    {0x110B7, 0x110B8, UTF8_GCB_SPACINGMARK}, {0x110B9, 0x110BA, UTF8_GCB_EXTEND},
+    {0x110BD, 0x110BD, UTF8_GCB_PREPEND}, {0x110C2, 0x110C2, UTF8_GCB_EXTEND},
+    {0x110CD, 0x110CD, UTF8_GCB_PREPEND}, {0x11100, 0x11102, UTF8_GCB_EXTEND},
+    {0x11127, 0x1112B, UTF8_GCB_EXTEND}, {0x1112C, 0x1112C, UTF8_GCB_SPACINGMARK},
+    {0x1112D, 0x11134, UTF8_GCB_EXTEND}, {0x11145, 0x11146, UTF8_GCB_SPACINGMARK},
+    {0x11173, 0x11173, UTF8_GCB_EXTEND}, {0x11180, 0x11181, UTF8_GCB_EXTEND},
+    {0x11182, 0x11182, UTF8_GCB_SPACINGMARK}, {0x111B3, 0x111B5, UTF8_GCB_SPACINGMARK},
+    {0x111B6, 0x111BE, UTF8_GCB_EXTEND}, {0x111BF, 0x111C0, UTF8_GCB_SPACINGMARK},
+    {0x111C2, 0x111C3, UTF8_GCB_PREPEND}, {0x111C9, 0x111CC, UTF8_GCB_EXTEND},
+    {0x111CE, 0x111CE, UTF8_GCB_SPACINGMARK}, {0x111CF, 0x111CF, UTF8_GCB_EXTEND},
+    {0x1122C, 0x1122E, UTF8_GCB_SPACINGMARK}, {0x1122F, 0x11231, UTF8_GCB_EXTEND},
+    {0x11232, 0x11233, UTF8_GCB_SPACINGMARK}, {0x11234, 0x11234, UTF8_GCB_EXTEND},
+    {0x11235, 0x11235, UTF8_GCB_SPACINGMARK}, {0x11236, 0x11237, UTF8_GCB_EXTEND},
+    {0x1123E, 0x1123E, UTF8_GCB_EXTEND}, {0x112DF, 0x112DF, UTF8_GCB_EXTEND},
+    {0x112E0, 0x112E2, UTF8_GCB_SPACINGMARK}, {0x112E3, 0x112EA, UTF8_GCB_EXTEND},
+    {0x11300, 0x11301, UTF8_GCB_EXTEND}, {0x11302, 0x11303, UTF8_GCB_SPACINGMARK},
+    {0x1133B, 0x1133C, UTF8_GCB_EXTEND}, {0x1133E, 0x1133E, UTF8_GCB_EXTEND},
+    {0x1133F, 0x1133F, UTF8_GCB_SPACINGMARK}, {0x11340, 0x11340, UTF8_GCB_EXTEND},
+    {0x11341, 0x11344, UTF8_GCB_SPACINGMARK}, {0x11347, 0x11348, UTF8_GCB_SPACINGMARK},
+    {0x1134B, 0x1134D, UTF8_GCB_SPACINGMARK}, {0x11357, 0x11357, UTF8_GCB_EXTEND},
+    {0x11362, 0x11363, UTF8_GCB_SPACINGMARK}, {0x11366, 0x1136C, UTF8_GCB_EXTEND},
+    {0x11370, 0x11374, UTF8_GCB_EXTEND}, {0x11435, 0x11437, UTF8_GCB_SPACINGMARK},
+    {0x11438, 0x1143F, UTF8_GCB_EXTEND}, {0x11440, 0x11441, UTF8_GCB_SPACINGMARK},
+    {0x11442, 0x11444, UTF8_GCB_EXTEND}, {0x11445, 0x11445, UTF8_GCB_SPACINGMARK},
+    {0x11446, 0x11446, UTF8_GCB_EXTEND}, {0x1145E, 0x1145E, UTF8_GCB_EXTEND},
+    {0x114B0, 0x114B0, UTF8_GCB_EXTEND}, {0x114B1, 0x114B2, UTF8_GCB_SPACINGMARK},
+    {0x114B3, 0x114B8, UTF8_GCB_EXTEND}, {0x114B9, 0x114B9, UTF8_GCB_SPACINGMARK},
+    {0x114BA, 0x114BA, UTF8_GCB_EXTEND}, {0x114BB, 0x114BC, UTF8_GCB_SPACINGMARK},
+    {0x114BD, 0x114BD, UTF8_GCB_EXTEND}, {0x114BE, 0x114BE, UTF8_GCB_SPACINGMARK},
+    {0x114BF, 0x114C0, UTF8_GCB_EXTEND}, {0x114C1, 0x114C1, UTF8_GCB_SPACINGMARK},
+    {0x114C2, 0x114C3, UTF8_GCB_EXTEND}, {0x115AF, 0x115AF, UTF8_GCB_EXTEND},
+    {0x115B0, 0x115B1, UTF8_GCB_SPACINGMARK}, {0x115B2, 0x115B5, UTF8_GCB_EXTEND},
+    {0x115B8, 0x115BB, UTF8_GCB_SPACINGMARK}, {0x115BC, 0x115BD, UTF8_GCB_EXTEND},
+    {0x115BE, 0x115BE, UTF8_GCB_SPACINGMARK}, {0x115BF, 0x115C0, UTF8_GCB_EXTEND},
+    {0x115DC, 0x115DD, UTF8_GCB_EXTEND}, {0x11630, 0x11632, UTF8_GCB_SPACINGMARK},
+    {0x11633, 0x1163A, UTF8_GCB_EXTEND}, {0x1163B, 0x1163C, UTF8_GCB_SPACINGMARK},
+    {0x1163D, 0x1163D, UTF8_GCB_EXTEND}, {0x1163E, 0x1163E, UTF8_GCB_SPACINGMARK},
+    {0x1163F, 0x11640, UTF8_GCB_EXTEND}, {0x116AB, 0x116AB, UTF8_GCB_EXTEND},
+    {0x116AC, 0x116AC, UTF8_GCB_SPACINGMARK}, {0x116AD, 0x116AD, UTF8_GCB_EXTEND},
+    {0x116AE, 0x116AF, UTF8_GCB_SPACINGMARK}, {0x116B0, 0x116B5, UTF8_GCB_EXTEND},
+    {0x116B6, 0x116B6, UTF8_GCB_SPACINGMARK}, {0x116B7, 0x116B7, UTF8_GCB_EXTEND},
+    {0x1171D, 0x1171F, UTF8_GCB_EXTEND}, {0x11722, 0x11725, UTF8_GCB_EXTEND},
+    {0x11726, 0x11726, UTF8_GCB_SPACINGMARK}, {0x11727, 0x1172B, UTF8_GCB_EXTEND},
+    {0x1182C, 0x1182E, UTF8_GCB_SPACINGMARK}, {0x1182F, 0x11837, UTF8_GCB_EXTEND},
+    {0x11838, 0x11838, UTF8_GCB_SPACINGMARK}, {0x11839, 0x1183A, UTF8_GCB_EXTEND},
+    {0x11930, 0x11930, UTF8_GCB_EXTEND}, {0x11931, 0x11935, UTF8_GCB_SPACINGMARK},
+    {0x11937, 0x11938, UTF8_GCB_SPACINGMARK}, {0x1193B, 0x1193C, UTF8_GCB_EXTEND},
+    {0x1193D, 0x1193D, UTF8_GCB_SPACINGMARK}, {0x1193E, 0x1193E, UTF8_GCB_EXTEND},
+    {0x1193F, 0x1193F, UTF8_GCB_PREPEND}, {0x11940, 0x11940, UTF8_GCB_SPACINGMARK},
+    {0x11941, 0x11941, UTF8_GCB_PREPEND}, {0x11942, 0x11942, UTF8_GCB_SPACINGMARK},
+    {0x11943, 0x11943, UTF8_GCB_EXTEND}, {0x119D1, 0x119D3, UTF8_GCB_SPACINGMARK},
+    {0x119D4, 0x119D7, UTF8_GCB_EXTEND}, {0x119DA, 0x119DB, UTF8_GCB_EXTEND},
+    {0x119DC, 0x119DF, UTF8_GCB_SPACINGMARK}, {0x119E0, 0x119E0, UTF8_GCB_EXTEND},
+    {0x119E4, 0x119E4, UTF8_GCB_SPACINGMARK}, {0x11A01, 0x11A0A, UTF8_GCB_EXTEND},
+    {0x11A33, 0x11A38, UTF8_GCB_EXTEND}, {0x11A39, 0x11A39, UTF8_GCB_SPACINGMARK},
+    {0x11A3A, 0x11A3A, UTF8_GCB_PREPEND}, {0x11A3B, 0x11A3E, UTF8_GCB_EXTEND},
+    {0x11A47, 0x11A47, UTF8_GCB_EXTEND}, {0x11A51, 0x11A56, UTF8_GCB_EXTEND},
+    {0x11A57, 0x11A58, UTF8_GCB_SPACINGMARK}, {0x11A59, 0x11A5B, UTF8_GCB_EXTEND},
+    {0x11A84, 0x11A89, UTF8_GCB_PREPEND}, {0x11A8A, 0x11A96, UTF8_GCB_EXTEND},
+    {0x11A97, 0x11A97, UTF8_GCB_SPACINGMARK}, {0x11A98, 0x11A99, UTF8_GCB_EXTEND},
+    {0x11C2F, 0x11C2F, UTF8_GCB_SPACINGMARK}, {0x11C30, 0x11C36, UTF8_GCB_EXTEND},
+    {0x11C38, 0x11C3D, UTF8_GCB_EXTEND}, {0x11C3E, 0x11C3E, UTF8_GCB_SPACINGMARK},
+    {0x11C3F, 0x11C3F, UTF8_GCB_EXTEND}, {0x11C92, 0x11CA7, UTF8_GCB_EXTEND},
+    {0x11CA9, 0x11CA9, UTF8_GCB_SPACINGMARK}, {0x11CAA, 0x11CB0, UTF8_GCB_EXTEND},
+    {0x11CB1, 0x11CB1, UTF8_GCB_SPACINGMARK}, {0x11CB2, 0x11CB3, UTF8_GCB_EXTEND},
+    {0x11CB4, 0x11CB4, UTF8_GCB_SPACINGMARK}, {0x11CB5, 0x11CB6, UTF8_GCB_EXTEND},
+    {0x11D31, 0x11D36, UTF8_GCB_EXTEND}, {0x11D3A, 0x11D3A, UTF8_GCB_EXTEND},
+    {0x11D3C, 0x11D3D, UTF8_GCB_EXTEND}, {0x11D3F, 0x11D45, UTF8_GCB_EXTEND},
+    {0x11D46, 0x11D46, UTF8_GCB_PREPEND}, {0x11D47, 0x11D47, UTF8_GCB_EXTEND},
+    {0x11D8A, 0x11D8E, UTF8_GCB_SPACINGMARK}, {0x11D90, 0x11D91, UTF8_GCB_EXTEND},
+    {0x11D93, 0x11D94, UTF8_GCB_SPACINGMARK}, {0x11D95, 0x11D95, UTF8_GCB_EXTEND},
+    {0x11D96, 0x11D96, UTF8_GCB_SPACINGMARK}, {0x11D97, 0x11D97, UTF8_GCB_EXTEND},
+    {0x11EF3, 0x11EF4, UTF8_GCB_EXTEND}, {0x11EF5, 0x11EF6, UTF8_GCB_SPACINGMARK},
+    {0x13430, 0x13438, UTF8_GCB_CONTROL}, {0x16AF0, 0x16AF4, UTF8_GCB_EXTEND},
+    {0x16B30, 0x16B36, UTF8_GCB_EXTEND}, {0x16F4F, 0x16F4F, UTF8_GCB_EXTEND},
+    {0x16F51, 0x16F87, UTF8_GCB_SPACINGMARK}, {0x16F8F, 0x16F92, UTF8_GCB_EXTEND},
+    {0x16FE4, 0x16FE4, UTF8_GCB_EXTEND}, {0x16FF0, 0x16FF1, UTF8_GCB_SPACINGMARK},
+    {0x1BC9D, 0x1BC9E, UTF8_GCB_EXTEND}, {0x1BCA0, 0x1BCA3, UTF8_GCB_CONTROL},
+    {0x1CF00, 0x1CF2D, UTF8_GCB_EXTEND}, {0x1CF30, 0x1CF46, UTF8_GCB_EXTEND},
+    {0x1D165, 0x1D165, UTF8_GCB_EXTEND}, {0x1D166, 0x1D166, UTF8_GCB_SPACINGMARK},
+    {0x1D167, 0x1D169, UTF8_GCB_EXTEND}, {0x1D16D, 0x1D16D, UTF8_GCB_SPACINGMARK},
+    {0x1D16E, 0x1D172, UTF8_GCB_EXTEND}, {0x1D173, 0x1D17A, UTF8_GCB_CONTROL},
+    {0x1D17B, 0x1D182, UTF8_GCB_EXTEND}, {0x1D185, 0x1D18B, UTF8_GCB_EXTEND},
+    {0x1D1AA, 0x1D1AD, UTF8_GCB_EXTEND}, {0x1D242, 0x1D244, UTF8_GCB_EXTEND},
+    {0x1DA00, 0x1DA36, UTF8_GCB_EXTEND}, {0x1DA3B, 0x1DA6C, UTF8_GCB_EXTEND},
+    {0x1DA75, 0x1DA75, UTF8_GCB_EXTEND}, {0x1DA84, 0x1DA84, UTF8_GCB_EXTEND},
+    {0x1DA9B, 0x1DA9F, UTF8_GCB_EXTEND}, {0x1DAA1, 0x1DAAF, UTF8_GCB_EXTEND},
+    {0x1E000, 0x1E006, UTF8_GCB_EXTEND}, {0x1E008, 0x1E018, UTF8_GCB_EXTEND},
+    {0x1E01B, 0x1E021, UTF8_GCB_EXTEND}, {0x1E023, 0x1E024, UTF8_GCB_EXTEND},
+    {0x1E026, 0x1E02A, UTF8_GCB_EXTEND}, {0x1E130, 0x1E136, UTF8_GCB_EXTEND},
+    {0x1E2AE, 0x1E2AE, UTF8_GCB_EXTEND}, {0x1E2EC, 0x1E2EF, UTF8_GCB_EXTEND},
+    {0x1E8D0, 0x1E8D6, UTF8_GCB_EXTEND}, {0x1E944, 0x1E94A, UTF8_GCB_EXTEND},
+    {0x1F000, 0x1F0FF, UTF8_GCB_EXT_PICT}, {0x1F10D, 0x1F10F, UTF8_GCB_EXT_PICT},
+    {0x1F12F, 0x1F12F, UTF8_GCB_EXT_PICT}, {0x1F16C, 0x1F171, UTF8_GCB_EXT_PICT},
+    {0x1F17E, 0x1F17F, UTF8_GCB_EXT_PICT}, {0x1F18E, 0x1F18E, UTF8_GCB_EXT_PICT},
+    {0x1F191, 0x1F19A, UTF8_GCB_EXT_PICT}, {0x1F1AD, 0x1F1E5, UTF8_GCB_EXT_PICT},
+    {0x1F1E6, 0x1F1FF, UTF8_GCB_RI}, {0x1F201, 0x1F20F, UTF8_GCB_EXT_PICT},
+    {0x1F21A, 0x1F21A, UTF8_GCB_EXT_PICT}, {0x1F22F, 0x1F22F, UTF8_GCB_EXT_PICT},
+    {0x1F232, 0x1F23A, UTF8_GCB_EXT_PICT}, {0x1F23C, 0x1F23F, UTF8_GCB_EXT_PICT},
+    {0x1F249, 0x1F3FA, UTF8_GCB_EXT_PICT}, {0x1F3FB, 0x1F3FF, UTF8_GCB_EXTEND},
+    {0x1F400, 0x1F53D, UTF8_GCB_EXT_PICT}, {0x1F546, 0x1F64F, UTF8_GCB_EXT_PICT},
+    {0x1F680, 0x1F6FF, UTF8_GCB_EXT_PICT}, {0x1F774, 0x1F77F, UTF8_GCB_EXT_PICT},
+    {0x1F7D5, 0x1F7FF, UTF8_GCB_EXT_PICT}, {0x1F80C, 0x1F80F, UTF8_GCB_EXT_PICT},
+    {0x1F848, 0x1F84F, UTF8_GCB_EXT_PICT}, {0x1F85A, 0x1F85F, UTF8_GCB_EXT_PICT},
+    {0x1F888, 0x1F88F, UTF8_GCB_EXT_PICT}, {0x1F8AE, 0x1F8FF, UTF8_GCB_EXT_PICT},
+    {0x1F90C, 0x1F93A, UTF8_GCB_EXT_PICT}, {0x1F93C, 0x1F945, UTF8_GCB_EXT_PICT},
+    {0x1F947, 0x1FAFF, UTF8_GCB_EXT_PICT}, {0x1FC00, 0x1FFFD, UTF8_GCB_EXT_PICT},
+    {0xE0000, 0xE001F, UTF8_GCB_CONTROL}, {0xE0020, 0xE007F, UTF8_GCB_EXTEND},
+    {0xE0080, 0xE00FF, UTF8_GCB_CONTROL}, {0xE0100, 0xE01EF, UTF8_GCB_EXTEND},
+    {0xE01F0, 0xE0FFF, UTF8_GCB_CONTROL},
+};
+
+//NOTE: Display width in terminal columns, 2 bits per codepoint. stage1 picks
+//a 256 codepoint block, stage2 holds the deduplicated blocks, 4 codepoints per byte.
+//0: combining marks (Mn, Me), format characters (Cf) and Hangul medial/final jamo.
+//U+00AD SOFT HYPHEN is Cf but stays 1, as in wcwidth, since terminals print it
+//as a visible hyphen.
+//2: East Asian Wide and Fullwidth, including unassigned CJK ideograph ranges.
+//1: everything else, Ambiguous and other unassigned codepoints included.
+static const unsigned char utf8_width_stage1[0x110000 >> 8] = {
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x19, 0x00, 0x1A, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x27, 0x00, 0x28, 0x00, 0x29, 0x2A, 0x2B, 0x2C, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x2E, 0x00, 0x00, 0x2F, 0x30,
+    0x00, 0x31, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x48, 0x00, 0x00, 0x00, 0x49,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x4A, 0x25, 0x25, 0x25, 0x25, 0x4B, 0x4C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+    0x25, 0x4E, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+    0x00, 0x52, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x48, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x00, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x63,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char utf8_width_stage2[][64] = {
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+     0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x15, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,},
+    {0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+     0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+     0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,},
+    {0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+     0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
+     0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+     0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,},
+    {0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+     0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
+     0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+     0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+     0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
+     0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
+     0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
+     0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+     0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+     0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+     0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+     0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
+     0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,},
+    {0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69,
+     0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59,},
+    {0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A,
+     0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x81, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,},
+    {0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56,
+     0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
+     0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+     0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x5A, 0x55, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,},
+    {0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+     0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
+     0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51,
+     0x45, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
+     0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+     0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+     0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+     0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+     0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
+     0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+     0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
+     0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+     0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
+     0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x54, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x54, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xA9, 0xAA, 0x69,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+     0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+     0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x6A, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,
+     0xAA, 0xAA, 0x56, 0x55, 0x5A, 0x55, 0x55, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A,
+     0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+     0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0x55, 0xA9, 0x55, 0x55, 0x95, 0x56, 0x55, 0xAA, 0xAA, 0x56,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x56, 0x55, 0x55, 0x55,},
+    {0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA,
+     0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,},
+    {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56, 0xAA, 0x56,
+     0xAA, 0x6A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0x6A, 0x55,
+     0xAA, 0x5A, 0x55, 0x55, 0xAA, 0xAA, 0x5A, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55,},
+    {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+     0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,},
+    {0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+     0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,},
+};
+
+#endif